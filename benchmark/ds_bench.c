@@ -0,0 +1,1453 @@
+/**
+ * ds_bench.c: 자료구조/알고리즘 통합 벤치마크
+ *
+ * 각 장(chapter)의 자료구조와 알고리즘을 같은 조건에서 측정한다.
+ * 측정 대상은 libds 정적 라이브러리 (서비스에 링크되는 코드와 동일).
+ * - 스택, 큐, 덱, 연결 리스트, 힙, BST, 그래프, 정렬, 선택(top-k), 탐색
+ * - 크기: --min ~ --max 구간을 10배씩 증가 (기본 1e3 ~ 1e6, 최대 1e8)
+ * - 단조 증가 고해상도 시계 (clock_gettime(CLOCK_MONOTONIC))
+ * - 워밍업 후 반복 측정, 백분위수(p50/p90/p99) 보고
+ * - 출력 형식: table (기본), csv, json
+ *
+ * 사용법:
+ *   ds_bench [--min N] [--max N] [--reps R] [--warmup W]
+ *            [--format table|csv|json] [--filter 이름] [--seed S] [--list]
+ *
+ * 예:
+ *   ds_bench --max 1e7 --reps 7 --format csv > result.csv
+ *   ds_bench --filter sort/ --format json
+ *
+ * 측정 방식:
+ *   prepare(크기당 1회) → [reset → run(시간 측정)] × (warmup + reps) → release
+ *   reset과 prepare는 측정에서 제외되므로 입력 복사 비용이 결과에 섞이지 않는다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ds_stack.h"
+#include "ds_queue.h"
+#include "ds_list.h"
+#include "ds_bst.h"
+#include "ds_heap.h"
+#include "ds_pqueue.h"
+#include "ds_dary_heap.h"
+#include "ds_index_heap.h"
+#include "ds_pairing_heap.h"
+#include "ds_radix_heap.h"
+#include "ds_graph.h"
+#include "ds_huffman.h"
+#include "ds_lpt.h"
+#include "ds_sort.h"
+#include "ds_generic_sort.h"
+#include "ds_small_sort.h"
+#include "ds_timsort.h"
+#include "ds_parallel_sort.h"
+#include "ds_radix.h"
+#include "ds_search.h"
+
+#define DEFAULT_MIN_N   1000
+#define DEFAULT_MAX_N   1000000
+#define DEFAULT_REPS    5
+#define DEFAULT_WARMUP  1
+#define GRAPH_DEGREE    4      // 그래프 벤치마크의 정점당 평균 간선 수
+#define MAX_WEIGHT      100    // 다익스트라 간선 가중치 상한
+
+
+// ==================== 시간 측정 / 난수 ====================
+
+/**
+ * 단조 증가 시계의 현재 시각 (나노초)
+ */
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * xorshift64* 난수 생성기 (시드 고정으로 재현 가능한 입력)
+ */
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 2685821657736338717ull;
+}
+
+static void rng_seed(uint64_t seed) {
+    rng_state = seed ? seed : 88172645463325252ull;
+}
+
+/**
+ * 메모리 할당 (실패 시 NULL, 호출 측에서 건너뛰기 처리)
+ */
+static void *bench_alloc(size_t count, size_t size) {
+    if (count != 0 && size > SIZE_MAX / count) {
+        return NULL;
+    }
+    return malloc(count * size);
+}
+
+
+// ==================== 벤치마크 컨텍스트 ====================
+
+// 크기별 공유 입력과 벤치마크별 작업 데이터
+typedef struct {
+    size_t n;          // 입력 크기
+    int *src;          // 원본 난수 배열 (모든 벤치마크 공유)
+    int *work;         // 측정 대상이 수정하는 작업 배열
+    int *sorted;       // 정렬된 배열 (탐색용)
+    void *aux;         // 벤치마크 고유 데이터 (그래프 등)
+    uint64_t sink;     // 최적화로 연산이 제거되지 않도록 결과 누적
+} BenchContext;
+
+// 벤치마크 항목
+typedef struct {
+    const char *name;                       // "분류/이름"
+    size_t max_n;                           // 적용 가능한 최대 크기 (0: 제한 없음)
+    int (*prepare)(BenchContext *ctx);      // 크기당 1회 준비 (0: 실패)
+    void (*reset)(BenchContext *ctx);       // 매 반복 전 입력 복구
+    void (*run)(BenchContext *ctx);         // 측정 대상
+    void (*release)(BenchContext *ctx);     // 준비 데이터 해제
+    void (*verify)(const BenchContext *ctx, const char *name);   // 측정 후 결과 검사 (NULL: 없음)
+} BenchCase;
+
+// 측정 결과
+typedef struct {
+    const char *name;
+    size_t n;
+    int reps;
+    double min, p50, p90, p99, max, mean;   // 단위: 나노초
+} BenchResult;
+
+/**
+ * 작업 배열을 원본으로 복구한다 (정렬 벤치마크 공통 reset)
+ */
+static void reset_copy_src(BenchContext *ctx) {
+    memcpy(ctx->work, ctx->src, ctx->n * sizeof(int));
+}
+
+static int prepare_none(BenchContext *ctx) {
+    (void)ctx;
+    return 1;
+}
+
+static void reset_none(BenchContext *ctx) {
+    (void)ctx;
+}
+
+static void release_none(BenchContext *ctx) {
+    (void)ctx;
+}
+
+
+// ==================== Chapter 04: 동적 배열 스택 ====================
+
+static void run_stack(BenchContext *ctx) {
+    DsStack s;
+    uint64_t sum = 0;
+    int item;
+
+    ds_stack_init(&s);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_stack_push(&s, ctx->src[i]);
+    }
+    while (ds_stack_pop(&s, &item)) {
+        sum += (uint64_t)item;
+    }
+    ds_stack_destroy(&s);
+
+    ctx->sink += sum;
+}
+
+
+// ==================== Chapter 05: 원형 큐 / 덱 ====================
+
+// 원형 큐: enqueue n회 → dequeue n회
+static void run_circular_queue(BenchContext *ctx) {
+    DsQueue q;
+    uint64_t sum = 0;
+    int item;
+
+    ds_queue_init(&q);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_enqueue(&q, ctx->src[i]);
+    }
+    while (ds_dequeue(&q, &item)) {
+        sum += (uint64_t)item;
+    }
+    ds_queue_destroy(&q);
+
+    ctx->sink += sum;
+}
+
+// 덱: 전단/후단 번갈아 삽입 후 번갈아 삭제
+static void run_deque(BenchContext *ctx) {
+    DsDeque dq;
+    uint64_t sum = 0;
+    int item;
+
+    ds_deque_init(&dq);
+    for (size_t i = 0; i < ctx->n; i++) {
+        if (i & 1) {
+            ds_deque_add_front(&dq, ctx->src[i]);
+        } else {
+            ds_deque_add_rear(&dq, ctx->src[i]);
+        }
+    }
+    for (size_t i = 0; !ds_deque_is_empty(&dq); i++) {
+        if (i & 1) {
+            ds_deque_delete_front(&dq, &item);
+        } else {
+            ds_deque_delete_rear(&dq, &item);
+        }
+        sum += (uint64_t)item;
+    }
+    ds_deque_destroy(&dq);
+
+    ctx->sink += sum;
+}
+
+
+// ==================== Chapter 06/07: 연결 리스트 ====================
+
+// 단일 연결 리스트: insert_first n회 → 순회 → 해제
+static void run_singly_list(BenchContext *ctx) {
+    DsList list;
+    uint64_t sum = 0;
+
+    ds_list_init(&list);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_list_insert_first(&list, ctx->src[i]);
+    }
+    for (const DsListNode *p = list.head; p != NULL; p = p->link) {
+        sum += (uint64_t)p->data;
+    }
+    ds_list_clear(&list);
+
+    ctx->sink += sum;
+}
+
+// 이중 연결 리스트: insert_last n회 → delete_first n회 (큐처럼 사용)
+static void run_doubly_list(BenchContext *ctx) {
+    DsDList list;
+    uint64_t sum = 0;
+    int item;
+
+    ds_dlist_init(&list);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_dlist_insert_last(&list, ctx->src[i]);
+    }
+    while (ds_dlist_delete_first(&list, &item)) {
+        sum += (uint64_t)item;
+    }
+
+    ctx->sink += sum;
+}
+
+
+// ==================== Chapter 08: 이진 탐색 트리 ====================
+
+static void run_bst(BenchContext *ctx) {
+    DsBST tree;
+    uint64_t found = 0;
+
+    ds_bst_init(&tree);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_bst_insert(&tree, ctx->src[i]);
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        found += ds_bst_contains(&tree, ctx->src[(i * 7) % ctx->n]);
+    }
+    ds_bst_destroy(&tree);
+
+    ctx->sink += found;
+}
+
+
+// ==================== Chapter 09: 힙 / 우선순위 큐 ====================
+
+// insert_heap n회 → delete_heap n회
+static void run_heap(BenchContext *ctx) {
+    DsHeap h;
+    uint64_t sum = 0;
+    int item;
+
+    ds_heap_init(&h, DS_HEAP_MAX);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_heap_push(&h, ctx->src[i]);
+    }
+    while (ds_heap_pop(&h, &item)) {
+        sum += (uint64_t)item;
+    }
+    ds_heap_destroy(&h);
+
+    ctx->sink += sum;
+}
+
+// 16바이트 타이머(마감 시각 + ID)로 같은 push n회 → pop n회 (타입 소거 우선순위 큐)
+typedef struct {
+    uint64_t deadline;
+    uint64_t id;
+} BenchTimer;
+
+static int compare_timer(const void *a, const void *b) {
+    const BenchTimer *x = a;
+    const BenchTimer *y = b;
+    return (x->deadline > y->deadline) - (x->deadline < y->deadline);
+}
+
+static void run_pqueue(BenchContext *ctx) {
+    DsPQueue pq;
+    BenchTimer timer;
+    uint64_t sum = 0;
+
+    ds_pqueue_init(&pq, sizeof(BenchTimer), compare_timer, DS_HEAP_MIN);
+    for (size_t i = 0; i < ctx->n; i++) {
+        timer = (BenchTimer){(uint64_t)ctx->src[i], i};
+        ds_pqueue_push(&pq, &timer);
+    }
+    while (ds_pqueue_pop(&pq, &timer)) {
+        sum += timer.id;
+    }
+    ds_pqueue_destroy(&pq);
+
+    ctx->sink += sum;
+}
+
+/**
+ * d진 힙 (uint64_t 키, Min-Heap): 이진(2) / 4진 / 8진(자식 8개 = 캐시 라인 하나)
+ * - push_pop: push n회 → pop n회
+ * - hold: n개를 넣은 뒤 "최솟값 꺼내고 더 늦은 값 넣기" n회 (이벤트 시뮬레이션 모사)
+ */
+#define U64_BEFORE(a, b) ((a) < (b))
+
+DS_DEFINE_DARY_HEAP(bench_u64_2, uint64_t, 2, U64_BEFORE)
+DS_DEFINE_DARY_HEAP(bench_u64_4, uint64_t, 4, U64_BEFORE)
+DS_DEFINE_DARY_HEAP(bench_u64_8, uint64_t, 8, U64_BEFORE)
+
+#define DEFINE_DARY_RUN(d)                                             \
+    static void run_dary##d##_push_pop(BenchContext *ctx) {            \
+        bench_u64_##d##_DaryHeap h;                                    \
+        uint64_t item, sum = 0;                                        \
+        bench_u64_##d##_dary_heap_init(&h);                            \
+        for (size_t i = 0; i < ctx->n; i++) {                          \
+            bench_u64_##d##_dary_heap_push(&h, (uint64_t)ctx->src[i]); \
+        }                                                              \
+        while (bench_u64_##d##_dary_heap_pop(&h, &item)) {             \
+            sum += item;                                               \
+        }                                                              \
+        bench_u64_##d##_dary_heap_destroy(&h);                         \
+        ctx->sink += sum;                                              \
+    }                                                                  \
+                                                                       \
+    static void run_dary##d##_hold(BenchContext *ctx) {                \
+        bench_u64_##d##_DaryHeap h;                                    \
+        uint64_t item, sum = 0;                                        \
+        bench_u64_##d##_dary_heap_init(&h);                            \
+        for (size_t i = 0; i < ctx->n; i++) {                          \
+            bench_u64_##d##_dary_heap_push(&h, (uint64_t)ctx->src[i]); \
+        }                                                              \
+        for (size_t i = 0; i < ctx->n; i++) {                          \
+            if (!bench_u64_##d##_dary_heap_pop(&h, &item)) {           \
+                break;                                                 \
+            }                                                          \
+            sum += item;                                               \
+            item += (uint64_t)ctx->src[i];                             \
+            bench_u64_##d##_dary_heap_push(&h, item);                  \
+        }                                                              \
+        bench_u64_##d##_dary_heap_destroy(&h);                         \
+        ctx->sink += sum;                                              \
+    }
+
+DEFINE_DARY_RUN(2)
+DEFINE_DARY_RUN(4)
+DEFINE_DARY_RUN(8)
+
+/**
+ * 타이머 휠 모사 (단조 키): 타이머 n개를 걸어 둔 뒤 n번 "가장 이른 타이머 만료 →
+ * 현재 시각 + 짧은 지연(1~1024)으로 재등록". 꺼낸 시각보다 이른 마감은 생기지 않는다.
+ * 이진 힙(d진 힙 매크로, d = 2) vs 페어링 힙 vs 기수 힙
+ */
+#define TIMER_DELAY(ctx, i) (1 + ((uint64_t)(ctx)->src[i] & 1023))
+#define TIMER_BEFORE(a, b) ((a).deadline < (b).deadline)
+
+DS_DEFINE_DARY_HEAP(bench_timer_2, BenchTimer, 2, TIMER_BEFORE)
+
+static void run_timer_binary(BenchContext *ctx) {
+    bench_timer_2_DaryHeap h;
+    BenchTimer timer;
+    uint64_t sum = 0;
+
+    bench_timer_2_dary_heap_init(&h);
+    for (size_t i = 0; i < ctx->n; i++) {
+        bench_timer_2_dary_heap_push(&h, (BenchTimer){TIMER_DELAY(ctx, i), i});
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        if (!bench_timer_2_dary_heap_pop(&h, &timer)) {
+            break;
+        }
+        sum += timer.id;
+        timer.deadline += TIMER_DELAY(ctx, i);
+        bench_timer_2_dary_heap_push(&h, timer);
+    }
+    bench_timer_2_dary_heap_destroy(&h);
+    ctx->sink += sum;
+}
+
+// 타이머 i = nodes[i] (침입형 노드 배열을 한 번만 할당)
+static void run_timer_pairing(BenchContext *ctx) {
+    DsPairingNode *nodes = bench_alloc(ctx->n, sizeof(DsPairingNode));
+    DsPairingHeap h;
+    uint64_t sum = 0;
+
+    if (nodes == NULL) {
+        return;
+    }
+    ds_pairing_heap_init(&h);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_pairing_heap_push(&h, &nodes[i], TIMER_DELAY(ctx, i));
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        DsPairingNode *node = ds_pairing_heap_pop(&h);
+        sum += (uint64_t)(node - nodes);
+        ds_pairing_heap_push(&h, node, node->key + TIMER_DELAY(ctx, i));
+    }
+    free(nodes);
+    ctx->sink += sum;
+}
+
+static void run_timer_radix(BenchContext *ctx) {
+    DsRadixHeap h;
+    uint64_t deadline, id, sum = 0;
+
+    ds_radix_heap_init(&h);
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_radix_heap_push(&h, TIMER_DELAY(ctx, i), i);
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        if (!ds_radix_heap_pop(&h, &deadline, &id)) {
+            break;
+        }
+        sum += id;
+        ds_radix_heap_push(&h, deadline + TIMER_DELAY(ctx, i), id);
+    }
+    ds_radix_heap_destroy(&h);
+    ctx->sink += sum;
+}
+
+
+/**
+ * 온라인 LPT 스케줄러: 머신 1024대에 작업 n개를 도착 순서대로 배정.
+ * 진행 중 작업이 LPT_ONLINE_WINDOW개가 되면 가장 오래된 것부터 완료하고,
+ * LPT_ONLINE_CHURN번마다 머신 하나를 빼고(남은 작업은 그대로 완료) 하나를 추가한다.
+ */
+#define LPT_ONLINE_MACHINES 1024
+#define LPT_ONLINE_WINDOW   8192
+#define LPT_ONLINE_CHURN    4096
+
+static void run_lpt_online(BenchContext *ctx) {
+    DsLptOnline s;
+    uint32_t window[LPT_ONLINE_WINDOW];   // 진행 중 작업 번호 (링 버퍼)
+    uint32_t job, machine;
+    uint64_t load, sum = 0;
+
+    if (!ds_lpt_online_init(&s, LPT_ONLINE_MACHINES)) {
+        return;
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        size_t slot = i % LPT_ONLINE_WINDOW;
+        if (i >= LPT_ONLINE_WINDOW) {
+            ds_lpt_online_complete(&s, window[slot]);
+        }
+        if (i % LPT_ONLINE_CHURN == LPT_ONLINE_CHURN - 1
+            && ds_lpt_online_peek(&s, &machine, &load)) {
+            ds_lpt_online_remove_machine(&s, machine);
+            ds_lpt_online_add_machine(&s, NULL);
+        }
+        ds_lpt_online_submit(&s, 1 + ((uint32_t)ctx->src[i] & 1023), &job, &machine);
+        window[slot] = job;
+        sum += machine;
+    }
+    ds_lpt_online_destroy(&s);
+    ctx->sink += sum;
+}
+
+
+/**
+ * 허프만 압축/복원: n바이트 (기하 분포 기호 약 20종 = 문자당 약 2~3비트 엔트로피)
+ * 출력 버퍼는 prepare에서 한 번 채워 두어 페이지 폴트가 측정에 섞이지 않게 한다.
+ */
+typedef struct {
+    uint8_t *text;
+    uint8_t *packed;
+    uint8_t *restored;
+    size_t capacity;
+    size_t packed_size;
+} BenchHuffman;
+
+static void release_huffman(BenchContext *ctx) {
+    BenchHuffman *bh = ctx->aux;
+    if (bh != NULL) {
+        free(bh->text);
+        free(bh->packed);
+        free(bh->restored);
+        free(bh);
+    }
+    ctx->aux = NULL;
+}
+
+static int prepare_huffman(BenchContext *ctx) {
+    BenchHuffman *bh = calloc(1, sizeof(BenchHuffman));
+    ctx->aux = bh;
+    if (bh == NULL) {
+        return 0;
+    }
+    bh->capacity = ds_huffman_compress_bound(ctx->n);
+    bh->text = bench_alloc(ctx->n, 1);
+    bh->packed = bench_alloc(bh->capacity, 1);
+    bh->restored = bench_alloc(ctx->n, 1);
+    if (bh->text == NULL || bh->packed == NULL || bh->restored == NULL) {
+        release_huffman(ctx);
+        return 0;
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        uint32_t x = (uint32_t)ctx->src[i] * 2654435761u ^ (uint32_t)i * 40503u;
+        bh->text[i] = (uint8_t)('a' + __builtin_ctz(x | 1u << 16) + ((x >> 30) & 3));
+    }
+    memset(bh->restored, 0, ctx->n);
+    if (!ds_huffman_compress(bh->text, ctx->n, bh->packed, bh->capacity, &bh->packed_size)) {
+        release_huffman(ctx);
+        return 0;
+    }
+    return 1;
+}
+
+static void run_huffman_compress(BenchContext *ctx) {
+    BenchHuffman *bh = ctx->aux;
+    size_t size = 0;
+    ds_huffman_compress(bh->text, ctx->n, bh->packed, bh->capacity, &size);
+    ctx->sink += size;
+}
+
+static void run_huffman_decompress(BenchContext *ctx) {
+    BenchHuffman *bh = ctx->aux;
+    size_t size = 0;
+    ds_huffman_decompress(bh->packed, bh->packed_size, bh->restored, ctx->n, &size);
+    ctx->sink += size + bh->restored[size / 2];
+}
+
+
+// ==================== Chapter 10/11: 그래프 ====================
+
+typedef struct {
+    DsGraph graph;
+    int *order;      // BFS 방문 순서
+    int *distance;   // 다익스트라 거리
+} BenchGraph;
+
+// 정점 n개, 간선 GRAPH_DEGREE·n개의 무작위 방향 그래프 생성
+static int prepare_graph(BenchContext *ctx) {
+    size_t n = ctx->n;
+    BenchGraph *bg = calloc(1, sizeof(BenchGraph));
+
+    if (bg == NULL) {
+        return 0;
+    }
+    ctx->aux = bg;
+    bg->order = bench_alloc(n, sizeof(int));
+    bg->distance = bench_alloc(n, sizeof(int));
+    if (!ds_graph_init(&bg->graph, (int)n) || !bg->order || !bg->distance) {
+        return 0;
+    }
+
+    for (size_t e = 0; e < n * GRAPH_DEGREE; e++) {
+        int from = (int)(rng_next() % n);
+        int to = (int)(rng_next() % n);
+        int weight = (int)(rng_next() % MAX_WEIGHT) + 1;
+        if (!ds_graph_add_edge(&bg->graph, from, to, weight)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void release_graph(BenchContext *ctx) {
+    BenchGraph *bg = ctx->aux;
+    if (bg != NULL) {
+        ds_graph_destroy(&bg->graph);
+        free(bg->order);
+        free(bg->distance);
+        free(bg);
+    }
+    ctx->aux = NULL;
+}
+
+static void run_bfs(BenchContext *ctx) {
+    BenchGraph *bg = ctx->aux;
+    ctx->sink += ds_graph_bfs(&bg->graph, 0, bg->order);
+}
+
+static void run_dijkstra(BenchContext *ctx) {
+    BenchGraph *bg = ctx->aux;
+    if (ds_graph_dijkstra(&bg->graph, 0, bg->distance, NULL)) {
+        ctx->sink += (uint64_t)bg->distance[bg->graph.num_vertices - 1];
+    }
+}
+
+// 색인 힙 다익스트라: 힙에 정점당 항목 1개, 더 짧은 경로는 decrease-key (지연 삭제 없음)
+static void run_dijkstra_indexed(BenchContext *ctx) {
+    BenchGraph *bg = ctx->aux;
+    const DsGraph *g = &bg->graph;
+    int *distance = bg->distance;
+    DsIndexHeap heap;
+
+    if (!ds_index_heap_init(&heap, (size_t)g->num_vertices)) {
+        return;
+    }
+    for (int v = 0; v < g->num_vertices; v++) {
+        distance[v] = DS_GRAPH_INF;
+    }
+    distance[0] = 0;
+    ds_index_heap_push(&heap, 0, 0);
+
+    int u, d;
+    while (ds_index_heap_pop(&heap, &u, &d)) {
+        for (int e = g->head[u]; e != -1; e = g->edges[e].next) {
+            int w = g->edges[e].to;
+            int new_distance = d + g->edges[e].weight;
+            if (new_distance < distance[w]) {
+                distance[w] = new_distance;
+                ds_index_heap_push_or_decrease(&heap, w, new_distance);
+            }
+        }
+    }
+    ds_index_heap_destroy(&heap);
+    ctx->sink += (uint64_t)distance[g->num_vertices - 1];
+}
+
+// 페어링 힙 다익스트라: 정점 v = nodes[v], 처음 도달하면 push, 더 짧은 경로는 O(1) decrease-key
+static void run_dijkstra_pairing(BenchContext *ctx) {
+    BenchGraph *bg = ctx->aux;
+    const DsGraph *g = &bg->graph;
+    int *distance = bg->distance;
+    DsPairingNode *nodes = bench_alloc((size_t)g->num_vertices, sizeof(DsPairingNode));
+    DsPairingHeap heap;
+
+    if (nodes == NULL) {
+        return;
+    }
+    for (int v = 0; v < g->num_vertices; v++) {
+        distance[v] = DS_GRAPH_INF;
+    }
+    distance[0] = 0;
+    ds_pairing_heap_init(&heap);
+    ds_pairing_heap_push(&heap, &nodes[0], 0);
+
+    DsPairingNode *top;
+    while ((top = ds_pairing_heap_pop(&heap)) != NULL) {
+        int u = (int)(top - nodes);
+        int d = (int)top->key;
+        for (int e = g->head[u]; e != -1; e = g->edges[e].next) {
+            int w = g->edges[e].to;
+            int new_distance = d + g->edges[e].weight;
+            if (new_distance < distance[w]) {
+                if (distance[w] == DS_GRAPH_INF) {
+                    ds_pairing_heap_push(&heap, &nodes[w], (uint64_t)new_distance);
+                } else {
+                    ds_pairing_heap_decrease_key(&heap, &nodes[w], (uint64_t)new_distance);
+                }
+                distance[w] = new_distance;
+            }
+        }
+    }
+    free(nodes);
+    ctx->sink += (uint64_t)distance[g->num_vertices - 1];
+}
+
+// 기수 힙 다익스트라: 지연 삭제 (꺼낸 거리가 distance보다 크면 낡은 항목)
+static void run_dijkstra_radix(BenchContext *ctx) {
+    BenchGraph *bg = ctx->aux;
+    const DsGraph *g = &bg->graph;
+    int *distance = bg->distance;
+    DsRadixHeap heap;
+
+    for (int v = 0; v < g->num_vertices; v++) {
+        distance[v] = DS_GRAPH_INF;
+    }
+    distance[0] = 0;
+    ds_radix_heap_init(&heap);
+    ds_radix_heap_push(&heap, 0, 0);
+
+    uint64_t key, vertex;
+    while (ds_radix_heap_pop(&heap, &key, &vertex)) {
+        int u = (int)vertex;
+        int d = (int)key;
+        if (d > distance[u]) {
+            continue;
+        }
+        for (int e = g->head[u]; e != -1; e = g->edges[e].next) {
+            int w = g->edges[e].to;
+            int new_distance = d + g->edges[e].weight;
+            if (new_distance < distance[w]) {
+                distance[w] = new_distance;
+                ds_radix_heap_push(&heap, (uint64_t)new_distance, (uint64_t)w);
+            }
+        }
+    }
+    ds_radix_heap_destroy(&heap);
+    ctx->sink += (uint64_t)distance[g->num_vertices - 1];
+}
+
+
+// ==================== Chapter 12: 정렬 ====================
+
+// 비교 기준: C 표준 라이브러리 qsort
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static void libc_qsort(int arr[], size_t n) {
+    qsort(arr, n, sizeof(int), compare_int);
+}
+
+// 병렬 정렬은 온라인 코어 전부 사용
+static void parallel_merge_sort_all(int arr[], size_t n) {
+    ds_parallel_merge_sort(arr, n, 0);
+}
+
+// 쉘 정렬 간격 수열별 비교 (sort/shell은 기본값 Ciura)
+static void shell_knuth(int arr[], size_t n) {
+    ds_shell_sort_gaps(arr, n, DS_SHELL_GAPS_KNUTH);
+}
+
+static void shell_tokuda(int arr[], size_t n) {
+    ds_shell_sort_gaps(arr, n, DS_SHELL_GAPS_TOKUDA);
+}
+
+static void shell_sedgewick(int arr[], size_t n) {
+    ds_shell_sort_gaps(arr, n, DS_SHELL_GAPS_SEDGEWICK);
+}
+
+static void shell_pratt(int arr[], size_t n) {
+    ds_shell_sort_gaps(arr, n, DS_SHELL_GAPS_PRATT);
+}
+
+// 팀 정렬 (런 통계는 측정에서 제외)
+static void tim_sort(int arr[], size_t n) {
+    ds_tim_sort(arr, n, NULL);
+}
+
+// 11비트 자릿수 LSD 기수 정렬 (부호 있는 32비트 키)
+static void radix_lsd_i32(int arr[], size_t n) {
+    ds_radix_sort_i32((int32_t *)arr, n);
+}
+
+// MSD American flag 정렬 (입력 값은 0 이상이므로 부호 없는 키로 정렬해도 순서 동일)
+static void radix_msd_u32(int arr[], size_t n) {
+    ds_msd_radix_sort_u32((uint32_t *)arr, n, 0);
+}
+
+static int prepare_sort(BenchContext *ctx) {
+    ctx->work = bench_alloc(ctx->n, sizeof(int));
+    return ctx->work != NULL;
+}
+
+static void release_sort(BenchContext *ctx) {
+    free(ctx->work);
+    ctx->work = NULL;
+}
+
+/**
+ * 거의 정렬된 입력: 원본을 정렬한 뒤 1%의 위치만 무작위로 교환
+ * (배치 작업에서 흔한 패턴, 고정 피벗 퀵 정렬의 최악 경우에 가까움)
+ */
+static int prepare_sort_nearly_sorted(BenchContext *ctx) {
+    int *pattern = bench_alloc(ctx->n, sizeof(int));
+    ctx->aux = pattern;
+    if (!prepare_sort(ctx) || pattern == NULL) {
+        return 0;
+    }
+    memcpy(pattern, ctx->src, ctx->n * sizeof(int));
+    qsort(pattern, ctx->n, sizeof(int), compare_int);
+    for (size_t k = 0; k < ctx->n / 100; k++) {
+        size_t i = (size_t)(rng_next() % ctx->n);
+        size_t j = (size_t)(rng_next() % ctx->n);
+        int temp = pattern[i];
+        pattern[i] = pattern[j];
+        pattern[j] = temp;
+    }
+    return 1;
+}
+
+static void reset_copy_pattern(BenchContext *ctx) {
+    memcpy(ctx->work, ctx->aux, ctx->n * sizeof(int));
+}
+
+static void release_sort_pattern(BenchContext *ctx) {
+    release_sort(ctx);
+    free(ctx->aux);
+    ctx->aux = NULL;
+}
+
+// 정렬 결과 검증 (측정 제외, 검증 실패는 stderr로 보고)
+static void check_sorted(const BenchContext *ctx, const char *name) {
+    for (size_t i = 1; i < ctx->n; i++) {
+        if (ctx->work[i - 1] > ctx->work[i]) {
+            fprintf(stderr, "[%s] 정렬 실패 (n=%zu, i=%zu)\n", name, ctx->n, i);
+            return;
+        }
+    }
+}
+
+#define DEFINE_SORT_RUN(fn)                     \
+    static void run_##fn(BenchContext *ctx) {   \
+        fn(ctx->work, ctx->n);                  \
+        ctx->sink += (uint64_t)ctx->work[0];    \
+    }
+
+DEFINE_SORT_RUN(ds_selection_sort)
+DEFINE_SORT_RUN(ds_insertion_sort)
+DEFINE_SORT_RUN(ds_shell_sort)
+DEFINE_SORT_RUN(shell_knuth)
+DEFINE_SORT_RUN(shell_tokuda)
+DEFINE_SORT_RUN(shell_sedgewick)
+DEFINE_SORT_RUN(shell_pratt)
+DEFINE_SORT_RUN(ds_merge_sort)
+DEFINE_SORT_RUN(tim_sort)
+DEFINE_SORT_RUN(ds_quick_sort)
+DEFINE_SORT_RUN(ds_heap_sort)
+DEFINE_SORT_RUN(ds_heap_sort_top_down)
+DEFINE_SORT_RUN(ds_intro_sort)
+DEFINE_SORT_RUN(ds_pdq_sort)
+DEFINE_SORT_RUN(parallel_merge_sort_all)
+DEFINE_SORT_RUN(radix_lsd_i32)
+DEFINE_SORT_RUN(radix_msd_u32)
+
+/**
+ * 작은 배열 커널: 입력을 size개씩 끊어 독립된 작은 정렬 n/size번 (집계 연산자 모사)
+ * 작업 배열은 aux에 두어 전체 정렬 검사(check_sorted)를 건너뛴다.
+ */
+static int prepare_small_chunks(BenchContext *ctx) {
+    ctx->aux = bench_alloc(ctx->n, sizeof(int));
+    return ctx->aux != NULL;
+}
+
+static void reset_small_chunks(BenchContext *ctx) {
+    memcpy(ctx->aux, ctx->src, ctx->n * sizeof(int));
+}
+
+static void release_small_chunks(BenchContext *ctx) {
+    free(ctx->aux);
+    ctx->aux = NULL;
+}
+
+#define DEFINE_SMALL_RUN(name, fn, size)                       \
+    static void run_small##size##_##name(BenchContext *ctx) {  \
+        int *arr = ctx->aux;                                   \
+        for (size_t i = 0; i + size <= ctx->n; i += size) {    \
+            fn(arr + i, size);                                 \
+        }                                                      \
+        ctx->sink += (uint64_t)arr[0];                         \
+    }
+
+DEFINE_SMALL_RUN(insertion, ds_insertion_sort, 16)
+DEFINE_SMALL_RUN(binary, ds_binary_insertion_sort, 16)
+DEFINE_SMALL_RUN(branchless, ds_branchless_insertion_sort, 16)
+DEFINE_SMALL_RUN(network, ds_small_sort, 16)
+DEFINE_SMALL_RUN(insertion, ds_insertion_sort, 64)
+DEFINE_SMALL_RUN(network, ds_small_sort, 64)
+
+// 문자열 정렬: 원본 값을 10진 문자열로 만든 가변 길이 키 (ID 문자열 모사)
+typedef struct {
+    char *text;          // 모든 문자열을 담은 연속 버퍼
+    DsByteString *src;   // 원본 순서
+    DsByteString *work;  // 측정 대상이 정렬하는 배열
+} BenchStrings;
+
+static int prepare_strings(BenchContext *ctx) {
+    BenchStrings *bs = calloc(1, sizeof(BenchStrings));
+    if (bs == NULL) {
+        return 0;
+    }
+    ctx->aux = bs;
+    bs->text = bench_alloc(ctx->n, 12);
+    bs->src = bench_alloc(ctx->n, sizeof(DsByteString));
+    bs->work = bench_alloc(ctx->n, sizeof(DsByteString));
+    if (!bs->text || !bs->src || !bs->work) {
+        return 0;
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        char *slot = bs->text + i * 12;
+        int length = snprintf(slot, 12, "%d", ctx->src[i]);
+        bs->src[i] = (DsByteString){(const unsigned char *)slot, (size_t)length};
+    }
+    return 1;
+}
+
+static void reset_strings(BenchContext *ctx) {
+    BenchStrings *bs = ctx->aux;
+    memcpy(bs->work, bs->src, ctx->n * sizeof(DsByteString));
+}
+
+static void release_strings(BenchContext *ctx) {
+    BenchStrings *bs = ctx->aux;
+    if (bs != NULL) {
+        free(bs->text);
+        free(bs->src);
+        free(bs->work);
+        free(bs);
+    }
+    ctx->aux = NULL;
+}
+
+static int compare_byte_string(const void *a, const void *b) {
+    const DsByteString *x = a;
+    const DsByteString *y = b;
+    size_t common = x->length < y->length ? x->length : y->length;
+    int order = memcmp(x->data, y->data, common);
+    if (order != 0) {
+        return order;
+    }
+    return (x->length > y->length) - (x->length < y->length);
+}
+
+static void run_strings_msd(BenchContext *ctx) {
+    BenchStrings *bs = ctx->aux;
+    ds_msd_radix_sort_strings(bs->work, ctx->n, 0);
+    ctx->sink += bs->work[0].length;
+}
+
+static void run_strings_qsort(BenchContext *ctx) {
+    BenchStrings *bs = ctx->aux;
+    qsort(bs->work, ctx->n, sizeof(DsByteString), compare_byte_string);
+    ctx->sink += bs->work[0].length;
+}
+
+/**
+ * 레코드 정렬: 16바이트 구조체 (8바이트 키 + 8바이트 값)
+ * 같은 알고리즘을 qsort 방식 간접 호출(타입 소거)과 매크로 특수화로 비교한다.
+ */
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+} BenchRecord;
+
+#define BENCH_RECORD_LESS(a, b) ((a).key < (b).key)
+#define BENCH_RECORD_KEY(a)     ((a).key)
+
+DS_DEFINE_SORT(bench_record, BenchRecord, BENCH_RECORD_LESS)
+DS_DEFINE_RADIX_SORT(bench_record, BenchRecord, BENCH_RECORD_KEY)
+DS_DEFINE_TIM_SORT(bench_record, BenchRecord, BENCH_RECORD_LESS)
+
+typedef struct {
+    BenchRecord *src;
+    BenchRecord *work;
+} BenchRecords;
+
+static int compare_record(const void *a, const void *b) {
+    const BenchRecord *x = a;
+    const BenchRecord *y = b;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+static uint64_t record_key(const void *elem) {
+    return ((const BenchRecord *)elem)->key;
+}
+
+static int prepare_records(BenchContext *ctx) {
+    BenchRecords *br = calloc(1, sizeof(BenchRecords));
+    if (br == NULL) {
+        return 0;
+    }
+    ctx->aux = br;
+    br->src = bench_alloc(ctx->n, sizeof(BenchRecord));
+    br->work = bench_alloc(ctx->n, sizeof(BenchRecord));
+    if (!br->src || !br->work) {
+        return 0;
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        br->src[i] = (BenchRecord){rng_next(), i};
+    }
+    return 1;
+}
+
+static void reset_records(BenchContext *ctx) {
+    BenchRecords *br = ctx->aux;
+    memcpy(br->work, br->src, ctx->n * sizeof(BenchRecord));
+}
+
+static void release_records(BenchContext *ctx) {
+    BenchRecords *br = ctx->aux;
+    if (br != NULL) {
+        free(br->src);
+        free(br->work);
+        free(br);
+    }
+    ctx->aux = NULL;
+}
+
+// check_sorted의 레코드판 (키 순서만 확인)
+static void check_sorted_records(const BenchContext *ctx, const char *name) {
+    const BenchRecords *br = ctx->aux;
+    for (size_t i = 1; i < ctx->n; i++) {
+        if (br->work[i - 1].key > br->work[i].key) {
+            fprintf(stderr, "[%s] 정렬 실패 (n=%zu, i=%zu)\n", name, ctx->n, i);
+            return;
+        }
+    }
+}
+
+#define DEFINE_RECORD_RUN(name, call)                  \
+    static void run_records_##name(BenchContext *ctx) { \
+        BenchRecords *br = ctx->aux;                    \
+        BenchRecord *arr = br->work;                    \
+        size_t n = ctx->n;                              \
+        call;                                           \
+        ctx->sink += arr[0].value;                      \
+    }
+
+DEFINE_RECORD_RUN(qsort, qsort(arr, n, sizeof(BenchRecord), compare_record))
+DEFINE_RECORD_RUN(generic_quick, ds_generic_quick_sort(arr, n, sizeof(BenchRecord), compare_record))
+DEFINE_RECORD_RUN(generic_merge, ds_generic_merge_sort(arr, n, sizeof(BenchRecord), compare_record))
+DEFINE_RECORD_RUN(generic_radix, ds_generic_radix_sort(arr, n, sizeof(BenchRecord), record_key))
+DEFINE_RECORD_RUN(quick, bench_record_quick_sort(arr, n))
+DEFINE_RECORD_RUN(merge, bench_record_merge_sort(arr, n))
+DEFINE_RECORD_RUN(tim, bench_record_tim_sort(arr, n, NULL))
+DEFINE_RECORD_RUN(heap, bench_record_heap_sort(arr, n))
+DEFINE_RECORD_RUN(radix, bench_record_radix_sort(arr, n))
+
+DEFINE_SORT_RUN(ds_radix_sort)
+DEFINE_SORT_RUN(libc_qsort)
+
+/**
+ * 선택: 전체 정렬 대신 필요한 만큼만 (sort/intro와 비교)
+ * 결과가 정렬 상태가 아니므로 작업 배열은 aux에 둔다 (check_sorted 제외).
+ */
+#define SELECT_TOP_K 100
+
+static int prepare_select(BenchContext *ctx) {
+    ctx->aux = bench_alloc(ctx->n, sizeof(int));
+    return ctx->aux != NULL;
+}
+
+static void reset_select(BenchContext *ctx) {
+    memcpy(ctx->aux, ctx->src, ctx->n * sizeof(int));
+}
+
+static void release_select(BenchContext *ctx) {
+    free(ctx->aux);
+    ctx->aux = NULL;
+}
+
+static void run_nth_element(BenchContext *ctx) {
+    int *arr = ctx->aux;
+    ds_nth_element(arr, ctx->n, ctx->n / 2);
+    ctx->sink += (uint64_t)arr[ctx->n / 2];
+}
+
+static void run_partial_sort(BenchContext *ctx) {
+    int *arr = ctx->aux;
+    size_t k = ctx->n < SELECT_TOP_K ? ctx->n : SELECT_TOP_K;
+    ds_partial_sort(arr, ctx->n, k);
+    ctx->sink += (uint64_t)arr[k - 1];
+}
+
+// 입력 배열을 스트림으로 보고 가장 큰 100개 유지 (원본은 읽기만 함)
+static void run_topk_stream(BenchContext *ctx) {
+    DsTopK top;
+    int out[SELECT_TOP_K];
+    if (!ds_topk_init(&top, SELECT_TOP_K)) {
+        return;
+    }
+    for (size_t i = 0; i < ctx->n; i++) {
+        ds_topk_push(&top, ctx->src[i]);
+    }
+    size_t count = ds_topk_result(&top, out);
+    ctx->sink += (uint64_t)out[count - 1];
+    ds_topk_destroy(&top);
+}
+
+
+// ==================== Chapter 13: 탐색 ====================
+
+static int prepare_search(BenchContext *ctx) {
+    ctx->sorted = bench_alloc(ctx->n, sizeof(int));
+    if (ctx->sorted == NULL) {
+        return 0;
+    }
+    memcpy(ctx->sorted, ctx->src, ctx->n * sizeof(int));
+    qsort(ctx->sorted, ctx->n, sizeof(int), compare_int);
+    return 1;
+}
+
+static void release_search(BenchContext *ctx) {
+    free(ctx->sorted);
+    ctx->sorted = NULL;
+}
+
+#define DEFINE_SEARCH_RUN(fn)                                   \
+    static void run_##fn(BenchContext *ctx) {                   \
+        uint64_t found = 0;                                     \
+        for (size_t i = 0; i < ctx->n; i++) {                   \
+            found += fn(ctx->sorted, ctx->n, ctx->src[i]) >= 0; \
+        }                                                       \
+        ctx->sink += found;                                     \
+    }
+
+DEFINE_SEARCH_RUN(ds_binary_search)
+DEFINE_SEARCH_RUN(ds_interpolation_search)
+DEFINE_SEARCH_RUN(ds_sequential_search)
+
+
+// ==================== 벤치마크 목록 ====================
+
+static const BenchCase bench_cases[] = {
+    // {이름, 최대 크기 (0: 제한 없음), prepare, reset, run, release, verify}
+    {"stack/dynamic_push_pop",     0,        prepare_none,               reset_none,         run_stack,                   release_none, NULL},
+    {"queue/circular",             0,        prepare_none,               reset_none,         run_circular_queue,          release_none, NULL},
+    {"deque/both_ends",            0,        prepare_none,               reset_none,         run_deque,                   release_none, NULL},
+    {"list/singly_insert_first",   10000000, prepare_none,               reset_none,         run_singly_list,             release_none, NULL},
+    {"list/doubly_queue",          10000000, prepare_none,               reset_none,         run_doubly_list,             release_none, NULL},
+    {"heap/max_push_pop",          0,        prepare_none,               reset_none,         run_heap,                    release_none, NULL},
+    {"heap/dary2_push_pop",        0,        prepare_none,               reset_none,         run_dary2_push_pop,          release_none, NULL},
+    {"heap/dary4_push_pop",        0,        prepare_none,               reset_none,         run_dary4_push_pop,          release_none, NULL},
+    {"heap/dary8_push_pop",        0,        prepare_none,               reset_none,         run_dary8_push_pop,          release_none, NULL},
+    {"heap/dary2_hold",            0,        prepare_none,               reset_none,         run_dary2_hold,              release_none, NULL},
+    {"heap/dary4_hold",            0,        prepare_none,               reset_none,         run_dary4_hold,              release_none, NULL},
+    {"heap/dary8_hold",            0,        prepare_none,               reset_none,         run_dary8_hold,              release_none, NULL},
+    {"heap/pqueue_timer_push_pop", 0,        prepare_none,               reset_none,         run_pqueue,                  release_none, NULL},
+    {"heap/timer_binary",          0,        prepare_none,               reset_none,         run_timer_binary,            release_none, NULL},
+    {"heap/timer_pairing",         0,        prepare_none,               reset_none,         run_timer_pairing,           release_none, NULL},
+    {"heap/timer_radix",           0,        prepare_none,               reset_none,         run_timer_radix,             release_none, NULL},
+    {"huffman/compress",           0,        prepare_huffman,            reset_none,         run_huffman_compress,        release_huffman, NULL},
+    {"huffman/decompress",         0,        prepare_huffman,            reset_none,         run_huffman_decompress,      release_huffman, NULL},
+    {"sched/lpt_online",           0,        prepare_none,               reset_none,         run_lpt_online,              release_none, NULL},
+    {"bst/insert_search",          10000000, prepare_none,               reset_none,         run_bst,                     release_none, NULL},
+    {"graph/bfs_list",             10000000, prepare_graph,              reset_none,         run_bfs,                     release_graph, NULL},
+    {"graph/dijkstra",             10000000, prepare_graph,              reset_none,         run_dijkstra,                release_graph, NULL},
+    {"graph/dijkstra_indexed",     10000000, prepare_graph,              reset_none,         run_dijkstra_indexed,        release_graph, NULL},
+    {"graph/dijkstra_pairing",     10000000, prepare_graph,              reset_none,         run_dijkstra_pairing,        release_graph, NULL},
+    {"graph/dijkstra_radix",       10000000, prepare_graph,              reset_none,         run_dijkstra_radix,          release_graph, NULL},
+    {"sort/selection",             100000,   prepare_sort,               reset_copy_src,     run_ds_selection_sort,       release_sort, NULL},
+    {"sort/insertion",             100000,   prepare_sort,               reset_copy_src,     run_ds_insertion_sort,       release_sort, NULL},
+    {"sort/shell",                 0,        prepare_sort,               reset_copy_src,     run_ds_shell_sort,           release_sort, NULL},
+    {"sort/shell_knuth",           0,        prepare_sort,               reset_copy_src,     run_shell_knuth,             release_sort, NULL},
+    {"sort/shell_tokuda",          0,        prepare_sort,               reset_copy_src,     run_shell_tokuda,            release_sort, NULL},
+    {"sort/shell_sedgewick",       0,        prepare_sort,               reset_copy_src,     run_shell_sedgewick,         release_sort, NULL},
+    {"sort/shell_pratt",           0,        prepare_sort,               reset_copy_src,     run_shell_pratt,             release_sort, NULL},
+    {"sort/merge",                 0,        prepare_sort,               reset_copy_src,     run_ds_merge_sort,           release_sort, NULL},
+    {"sort/merge_nearly_sorted",   0,        prepare_sort_nearly_sorted, reset_copy_pattern, run_ds_merge_sort,           release_sort_pattern, NULL},
+    {"sort/tim",                   0,        prepare_sort,               reset_copy_src,     run_tim_sort,                release_sort, NULL},
+    {"sort/tim_nearly_sorted",     0,        prepare_sort_nearly_sorted, reset_copy_pattern, run_tim_sort,                release_sort_pattern, NULL},
+    {"sort/parallel_merge",        0,        prepare_sort,               reset_copy_src,     run_parallel_merge_sort_all, release_sort, NULL},
+    {"sort/quick",                 0,        prepare_sort,               reset_copy_src,     run_ds_quick_sort,           release_sort, NULL},
+    {"sort/heap",                  0,        prepare_sort,               reset_copy_src,     run_ds_heap_sort,            release_sort, NULL},
+    {"sort/heap_top_down",         0,        prepare_sort,               reset_copy_src,     run_ds_heap_sort_top_down,   release_sort, NULL},
+    {"sort/intro",                 0,        prepare_sort,               reset_copy_src,     run_ds_intro_sort,           release_sort, NULL},
+    {"sort/quick_nearly_sorted",   10000,    prepare_sort_nearly_sorted, reset_copy_pattern, run_ds_quick_sort,           release_sort_pattern, NULL},
+    {"sort/intro_nearly_sorted",   0,        prepare_sort_nearly_sorted, reset_copy_pattern, run_ds_intro_sort,           release_sort_pattern, NULL},
+    {"sort/pdq",                   0,        prepare_sort,               reset_copy_src,     run_ds_pdq_sort,             release_sort, NULL},
+    {"sort/pdq_nearly_sorted",     0,        prepare_sort_nearly_sorted, reset_copy_pattern, run_ds_pdq_sort,             release_sort_pattern, NULL},
+    {"sort/radix",                 0,        prepare_sort,               reset_copy_src,     run_ds_radix_sort,           release_sort, NULL},
+    {"sort/radix_lsd_i32",         0,        prepare_sort,               reset_copy_src,     run_radix_lsd_i32,           release_sort, NULL},
+    {"sort/radix_msd_u32",         0,        prepare_sort,               reset_copy_src,     run_radix_msd_u32,           release_sort, NULL},
+    {"sort/strings_msd",           0,        prepare_strings,            reset_strings,      run_strings_msd,             release_strings, NULL},
+    {"sort/strings_qsort",         0,        prepare_strings,            reset_strings,      run_strings_qsort,           release_strings, NULL},
+    {"sort/small16_insertion",     0,        prepare_small_chunks,       reset_small_chunks, run_small16_insertion,       release_small_chunks, NULL},
+    {"sort/small16_binary",        0,        prepare_small_chunks,       reset_small_chunks, run_small16_binary,          release_small_chunks, NULL},
+    {"sort/small16_branchless",    0,        prepare_small_chunks,       reset_small_chunks, run_small16_branchless,      release_small_chunks, NULL},
+    {"sort/small16_network",       0,        prepare_small_chunks,       reset_small_chunks, run_small16_network,         release_small_chunks, NULL},
+    {"sort/small64_insertion",     0,        prepare_small_chunks,       reset_small_chunks, run_small64_insertion,       release_small_chunks, NULL},
+    {"sort/small64_network",       0,        prepare_small_chunks,       reset_small_chunks, run_small64_network,         release_small_chunks, NULL},
+    {"sort/records_qsort",         0,        prepare_records,            reset_records,      run_records_qsort,           release_records, check_sorted_records},
+    {"sort/records_generic_quick", 0,        prepare_records,            reset_records,      run_records_generic_quick,   release_records, check_sorted_records},
+    {"sort/records_quick",         0,        prepare_records,            reset_records,      run_records_quick,           release_records, check_sorted_records},
+    {"sort/records_generic_merge", 0,        prepare_records,            reset_records,      run_records_generic_merge,   release_records, check_sorted_records},
+    {"sort/records_merge",         0,        prepare_records,            reset_records,      run_records_merge,           release_records, check_sorted_records},
+    {"sort/records_tim",           0,        prepare_records,            reset_records,      run_records_tim,             release_records, check_sorted_records},
+    {"sort/records_heap",          0,        prepare_records,            reset_records,      run_records_heap,            release_records, check_sorted_records},
+    {"sort/records_generic_radix", 0,        prepare_records,            reset_records,      run_records_generic_radix,   release_records, check_sorted_records},
+    {"sort/records_radix",         0,        prepare_records,            reset_records,      run_records_radix,           release_records, check_sorted_records},
+    {"sort/qsort_libc",            0,        prepare_sort,               reset_copy_src,     run_libc_qsort,              release_sort, NULL},
+    {"select/nth_element",         0,        prepare_select,             reset_select,       run_nth_element,             release_select, NULL},
+    {"select/partial_sort_100",    0,        prepare_select,             reset_select,       run_partial_sort,            release_select, NULL},
+    {"select/topk_stream_100",     0,        prepare_none,               reset_none,         run_topk_stream,             release_none, NULL},
+    {"search/binary",              0,        prepare_search,             reset_none,         run_ds_binary_search,        release_search, NULL},
+    {"search/interpolation",       0,        prepare_search,             reset_none,         run_ds_interpolation_search, release_search, NULL},
+    {"search/sequential",          10000,    prepare_search,             reset_none,         run_ds_sequential_search,    release_search, NULL},
+};
+
+#define NUM_BENCH_CASES (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+
+// ==================== 통계 / 출력 ====================
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * 정렬된 표본에서 백분위수를 구한다 (nearest-rank)
+ */
+static double percentile(const double sorted[], int count, double p) {
+    int rank = (int)(p / 100.0 * count + 0.999999);
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > count) {
+        rank = count;
+    }
+    return sorted[rank - 1];
+}
+
+typedef enum { FORMAT_TABLE, FORMAT_CSV, FORMAT_JSON } OutputFormat;
+
+static void print_header(OutputFormat format) {
+    switch (format) {
+    case FORMAT_TABLE:
+        printf("%-28s %11s %5s %12s %12s %12s %12s %12s %10s\n",
+               "benchmark", "n", "reps", "min(ms)", "p50(ms)", "p90(ms)",
+               "p99(ms)", "max(ms)", "ns/elem");
+        break;
+    case FORMAT_CSV:
+        printf("benchmark,n,reps,min_ns,p50_ns,p90_ns,p99_ns,max_ns,mean_ns,ns_per_elem\n");
+        break;
+    case FORMAT_JSON:
+        printf("[\n");
+        break;
+    }
+}
+
+static void print_result(OutputFormat format, const BenchResult *r, int first) {
+    double per_elem = r->p50 / (double)r->n;
+
+    switch (format) {
+    case FORMAT_TABLE:
+        printf("%-28s %11zu %5d %12.3f %12.3f %12.3f %12.3f %12.3f %10.2f\n",
+               r->name, r->n, r->reps, r->min / 1e6, r->p50 / 1e6, r->p90 / 1e6,
+               r->p99 / 1e6, r->max / 1e6, per_elem);
+        break;
+    case FORMAT_CSV:
+        printf("%s,%zu,%d,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,%.3f\n",
+               r->name, r->n, r->reps, r->min, r->p50, r->p90, r->p99, r->max,
+               r->mean, per_elem);
+        break;
+    case FORMAT_JSON:
+        printf("%s  {\"benchmark\": \"%s\", \"n\": %zu, \"reps\": %d, "
+               "\"min_ns\": %.0f, \"p50_ns\": %.0f, \"p90_ns\": %.0f, "
+               "\"p99_ns\": %.0f, \"max_ns\": %.0f, \"mean_ns\": %.0f, "
+               "\"ns_per_elem\": %.3f}",
+               first ? "" : ",\n", r->name, r->n, r->reps, r->min, r->p50,
+               r->p90, r->p99, r->max, r->mean, per_elem);
+        break;
+    }
+    fflush(stdout);
+}
+
+static void print_footer(OutputFormat format) {
+    if (format == FORMAT_JSON) {
+        printf("\n]\n");
+    }
+}
+
+
+// ==================== 실행 ====================
+
+typedef struct {
+    size_t min_n;
+    size_t max_n;
+    int reps;
+    int warmup;
+    uint64_t seed;
+    OutputFormat format;
+    const char *filter;
+} BenchOptions;
+
+/**
+ * 벤치마크 하나를 크기 n에서 측정한다
+ * @return 측정 성공 시 1, 건너뛰면 0
+ */
+static int run_case(const BenchCase *bc, BenchContext *ctx, const BenchOptions *opt,
+                    double samples[], BenchResult *result) {
+    if (!bc->prepare(ctx)) {
+        bc->release(ctx);
+        fprintf(stderr, "[%s] n=%zu 준비 실패 (메모리 부족) → 건너뜀\n", bc->name, ctx->n);
+        return 0;
+    }
+
+    for (int r = 0; r < opt->warmup + opt->reps; r++) {
+        bc->reset(ctx);
+        uint64_t start = now_ns();
+        bc->run(ctx);
+        uint64_t end = now_ns();
+        if (r >= opt->warmup) {
+            samples[r - opt->warmup] = (double)(end - start);
+        }
+    }
+    if (ctx->work != NULL) {
+        check_sorted(ctx, bc->name);
+    }
+    if (bc->verify != NULL) {
+        bc->verify(ctx, bc->name);
+    }
+    bc->release(ctx);
+
+    qsort(samples, (size_t)opt->reps, sizeof(double), compare_double);
+
+    double sum = 0.0;
+    for (int i = 0; i < opt->reps; i++) {
+        sum += samples[i];
+    }
+    result->name = bc->name;
+    result->n = ctx->n;
+    result->reps = opt->reps;
+    result->min = samples[0];
+    result->p50 = percentile(samples, opt->reps, 50.0);
+    result->p90 = percentile(samples, opt->reps, 90.0);
+    result->p99 = percentile(samples, opt->reps, 99.0);
+    result->max = samples[opt->reps - 1];
+    result->mean = sum / opt->reps;
+    return 1;
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "사용법: %s [--min N] [--max N] [--reps R] [--warmup W]\n"
+            "          [--format table|csv|json] [--filter 이름] [--seed S] [--list]\n"
+            "  N은 1e6 같은 지수 표기 허용 (기본: --min 1e3 --max 1e6)\n",
+            prog);
+}
+
+static int parse_size(const char *text, size_t *out) {
+    char *end;
+    double value = strtod(text, &end);
+    if (end == text || *end != '\0' || value < 1.0 || value > 1e12) {
+        return 0;
+    }
+    *out = (size_t)value;
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    BenchOptions opt = {DEFAULT_MIN_N, DEFAULT_MAX_N, DEFAULT_REPS, DEFAULT_WARMUP,
+                        0, FORMAT_TABLE, NULL};
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--list") == 0) {
+            for (size_t c = 0; c < NUM_BENCH_CASES; c++) {
+                printf("%s\n", bench_cases[c].name);
+            }
+            return 0;
+        }
+        if (value == NULL) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        int ok = 1;
+        if (strcmp(arg, "--min") == 0) {
+            ok = parse_size(value, &opt.min_n);
+        } else if (strcmp(arg, "--max") == 0) {
+            ok = parse_size(value, &opt.max_n);
+        } else if (strcmp(arg, "--reps") == 0) {
+            opt.reps = atoi(value);
+            ok = opt.reps > 0;
+        } else if (strcmp(arg, "--warmup") == 0) {
+            opt.warmup = atoi(value);
+            ok = opt.warmup >= 0;
+        } else if (strcmp(arg, "--seed") == 0) {
+            opt.seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--filter") == 0) {
+            opt.filter = value;
+        } else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "table") == 0) {
+                opt.format = FORMAT_TABLE;
+            } else if (strcmp(value, "csv") == 0) {
+                opt.format = FORMAT_CSV;
+            } else if (strcmp(value, "json") == 0) {
+                opt.format = FORMAT_JSON;
+            } else {
+                ok = 0;
+            }
+        } else {
+            ok = 0;
+        }
+        if (!ok) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+    if (opt.min_n > opt.max_n) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    double *samples = bench_alloc((size_t)opt.reps, sizeof(double));
+    if (samples == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return 1;
+    }
+
+    print_header(opt.format);
+    int first = 1;
+    uint64_t sink = 0;
+
+    for (size_t n = opt.min_n; n <= opt.max_n; n *= 10) {
+        BenchContext ctx = {0};
+        ctx.n = n;
+        ctx.src = bench_alloc(n, sizeof(int));
+        if (ctx.src == NULL) {
+            fprintf(stderr, "n=%zu 입력 할당 실패 → 중단\n", n);
+            break;
+        }
+        // 값 범위 [0, n): 중복이 적당히 섞인 무작위 입력
+        rng_seed(opt.seed + n);
+        for (size_t i = 0; i < n; i++) {
+            ctx.src[i] = (int)(rng_next() % n);
+        }
+
+        for (size_t c = 0; c < NUM_BENCH_CASES; c++) {
+            const BenchCase *bc = &bench_cases[c];
+            BenchResult result;
+
+            if (opt.filter != NULL && strstr(bc->name, opt.filter) == NULL) {
+                continue;
+            }
+            if (bc->max_n != 0 && n > bc->max_n) {
+                continue;
+            }
+            if (run_case(bc, &ctx, &opt, samples, &result)) {
+                print_result(opt.format, &result, first);
+                first = 0;
+            }
+        }
+
+        sink += ctx.sink;
+        free(ctx.src);
+        if (n > opt.max_n / 10) {
+            break;   // 다음 단계에서 오버플로우 방지
+        }
+    }
+
+    print_footer(opt.format);
+    fprintf(stderr, "checksum: %llu\n", (unsigned long long)sink);
+
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,291 @@
+/**
+ * pq_scaling.c: 동시 우선순위 큐 처리량 (스레드 1 ~ 64)
+ *
+ * 작업 분배기처럼 여러 스레드가 한 큐에 push/pop을 섞어 호출할 때의 전체 처리량을 잰다.
+ * - mutex_heap: 뮤텍스 하나로 감싼 DsPQueue (지금 분배기 구조)
+ * - multiqueue: DsMultiQueue, 샤드 = 2 × 스레드 / 4 × 스레드
+ *
+ * 작업량: 큐를 --prefill개로 채운 뒤, 모든 스레드가 동시에 시작해 연산을 반씩 나눠
+ * push(무작위 키)와 pop을 번갈아 호출한다. 전체 연산 수(--ops)는 스레드 수와 무관하게 같다.
+ * 출력: 스레드 수별 초당 연산 수(Mops/s)와 1스레드 대비 배율.
+ * 코어 수보다 많은 스레드에서는 잠금 보유 스레드의 선점 비용이 그대로 드러난다.
+ *
+ * 사용법:
+ *   pq_scaling [--threads MAX] [--ops N] [--prefill N] [--format table|csv] [--seed S]
+ *
+ * 예:
+ *   pq_scaling --threads 64 --ops 1e7
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ds_multiqueue.h"
+#include "ds_pqueue.h"
+#include "ds_thread_pool.h"
+
+#define DEFAULT_MAX_THREADS 64
+#define DEFAULT_OPS         4000000
+#define DEFAULT_PREFILL     1000000
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// xorshift64* (스레드마다 자기 상태를 가진다)
+static uint64_t rng_next(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+
+// ==================== 대상 큐 ====================
+
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+} Job;
+
+static int compare_job(const void *a, const void *b) {
+    const Job *x = a;
+    const Job *y = b;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+// 뮤텍스 하나 + 힙 하나 (비교 기준)
+typedef struct {
+    pthread_mutex_t lock;
+    DsPQueue heap;
+} LockedHeap;
+
+typedef struct {
+    const char *name;
+    size_t shards_per_thread;   // 0: 뮤텍스 힙
+} QueueKind;
+
+static const QueueKind kinds[] = {
+    {"mutex_heap", 0},
+    {"multiqueue_c2", 2},
+    {"multiqueue_c4", 4},
+};
+
+typedef struct {
+    const QueueKind *kind;
+    LockedHeap locked;
+    DsMultiQueue mq;
+} Queue;
+
+static bool queue_init(Queue *q, const QueueKind *kind, unsigned threads) {
+    q->kind = kind;
+    if (kind->shards_per_thread == 0) {
+        // ds_pqueue_init은 실패하지 않는다 (메모리는 첫 push 때 할당)
+        ds_pqueue_init(&q->locked.heap, sizeof(Job), compare_job, DS_HEAP_MIN);
+        return pthread_mutex_init(&q->locked.lock, NULL) == 0;
+    }
+    return ds_multiqueue_init(&q->mq, kind->shards_per_thread * threads);
+}
+
+static void queue_destroy(Queue *q) {
+    if (q->kind->shards_per_thread == 0) {
+        ds_pqueue_destroy(&q->locked.heap);
+        pthread_mutex_destroy(&q->locked.lock);
+    } else {
+        ds_multiqueue_destroy(&q->mq);
+    }
+}
+
+static bool queue_push(Queue *q, uint64_t key, uint64_t value) {
+    if (q->kind->shards_per_thread != 0) {
+        return ds_multiqueue_push(&q->mq, key, value);
+    }
+    Job job = {key, value};
+    pthread_mutex_lock(&q->locked.lock);
+    bool ok = ds_pqueue_push(&q->locked.heap, &job);
+    pthread_mutex_unlock(&q->locked.lock);
+    return ok;
+}
+
+static bool queue_pop(Queue *q, uint64_t *key) {
+    if (q->kind->shards_per_thread != 0) {
+        return ds_multiqueue_pop(&q->mq, key, NULL);
+    }
+    Job job;
+    pthread_mutex_lock(&q->locked.lock);
+    bool ok = ds_pqueue_pop(&q->locked.heap, &job);
+    pthread_mutex_unlock(&q->locked.lock);
+    if (ok) {
+        *key = job.key;
+    }
+    return ok;
+}
+
+
+// ==================== 측정 ====================
+
+typedef struct {
+    Queue *queue;
+    pthread_barrier_t *start;
+    size_t ops;
+    uint64_t seed;
+    uint64_t sink;
+} Worker;
+
+static void *worker_main(void *arg) {
+    Worker *w = arg;
+    uint64_t state = w->seed;
+    uint64_t key, sum = 0;
+
+    pthread_barrier_wait(w->start);
+    for (size_t i = 0; i < w->ops; i += 2) {
+        queue_push(w->queue, rng_next(&state) >> 32, i);
+        if (queue_pop(w->queue, &key)) {
+            sum += key;
+        }
+    }
+    w->sink = sum;
+    return NULL;
+}
+
+/**
+ * threads개 스레드로 전체 ops번 연산한 시간 (나노초), 실패 시 0
+ */
+static uint64_t measure(const QueueKind *kind, unsigned threads, size_t ops, size_t prefill,
+                        uint64_t seed, uint64_t *sink) {
+    Queue queue;
+    if (!queue_init(&queue, kind, threads)) {
+        return 0;
+    }
+    uint64_t state = seed | 1;
+    for (size_t i = 0; i < prefill; i++) {
+        queue_push(&queue, rng_next(&state) >> 32, i);
+    }
+
+    Worker *workers = calloc(threads, sizeof(Worker));
+    pthread_t *tids = calloc(threads, sizeof(pthread_t));
+    pthread_barrier_t start;
+    uint64_t elapsed = 0;
+    unsigned started = 0;
+
+    if (workers != NULL && tids != NULL && pthread_barrier_init(&start, NULL, threads + 1) == 0) {
+        for (; started < threads; started++) {
+            workers[started] = (Worker){&queue, &start, ops / threads, seed + started + 1, 0};
+            if (pthread_create(&tids[started], NULL, worker_main, &workers[started]) != 0) {
+                break;
+            }
+        }
+        if (started == threads) {
+            pthread_barrier_wait(&start);
+            uint64_t t0 = now_ns();
+            for (unsigned i = 0; i < threads; i++) {
+                pthread_join(tids[i], NULL);
+                *sink += workers[i].sink;
+            }
+            elapsed = now_ns() - t0;
+        } else {
+            fprintf(stderr, "스레드 생성 실패 (%u개)\n", started);
+            exit(1);   // 이미 만든 스레드가 장벽에서 기다리므로 정리할 수 없음
+        }
+        pthread_barrier_destroy(&start);
+    }
+    free(workers);
+    free(tids);
+    queue_destroy(&queue);
+    return elapsed;
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "사용법: %s [--threads MAX] [--ops N] [--prefill N] [--format table|csv] [--seed S]\n"
+            "  N은 1e7 같은 지수 표기 허용 (기본: 스레드 %d, 연산 %d, 초기 원소 %d)\n",
+            prog, DEFAULT_MAX_THREADS, DEFAULT_OPS, DEFAULT_PREFILL);
+}
+
+static int parse_size(const char *text, size_t *out) {
+    char *end;
+    double value = strtod(text, &end);
+    if (end == text || *end != '\0' || value < 0.0 || value > 1e10) {
+        return 0;
+    }
+    *out = (size_t)value;
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    size_t max_threads = DEFAULT_MAX_THREADS;
+    size_t ops = DEFAULT_OPS;
+    size_t prefill = DEFAULT_PREFILL;
+    uint64_t seed = 88172645463325252ull;
+    bool csv = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (value == NULL) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        int ok = 1;
+        if (strcmp(arg, "--threads") == 0) {
+            ok = parse_size(value, &max_threads) && max_threads >= 1 && max_threads <= 1024;
+        } else if (strcmp(arg, "--ops") == 0) {
+            ok = parse_size(value, &ops) && ops >= 2;
+        } else if (strcmp(arg, "--prefill") == 0) {
+            ok = parse_size(value, &prefill);
+        } else if (strcmp(arg, "--seed") == 0) {
+            seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--format") == 0) {
+            csv = strcmp(value, "csv") == 0;
+            ok = csv || strcmp(value, "table") == 0;
+        } else {
+            ok = 0;
+        }
+        if (!ok) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    if (csv) {
+        printf("queue,threads,ops,ms,mops_per_s,speedup\n");
+    } else {
+        printf("CPU 코어 %u개, 연산 %zu회, 초기 원소 %zu개\n", ds_cpu_count(), ops, prefill);
+        printf("%-16s %8s %12s %12s %9s\n", "queue", "threads", "ms", "Mops/s", "speedup");
+    }
+
+    uint64_t sink = 0;
+    for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+        double base = 0.0;
+        for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+            uint64_t ns = measure(&kinds[k], threads, ops, prefill, seed, &sink);
+            if (ns == 0) {
+                fprintf(stderr, "[%s/%u] 메모리 할당 실패\n", kinds[k].name, threads);
+                break;
+            }
+            double mops = (double)(ops / threads * threads) * 1e3 / (double)ns;
+            if (threads == 1) {
+                base = mops;
+            }
+            if (csv) {
+                printf("%s,%u,%zu,%.3f,%.3f,%.2f\n", kinds[k].name, threads, ops, ns / 1e6, mops,
+                       mops / base);
+            } else {
+                printf("%-16s %8u %12.3f %12.3f %8.2fx\n", kinds[k].name, threads, ns / 1e6, mops,
+                       mops / base);
+            }
+        }
+    }
+    fprintf(stderr, "checksum: %llu\n", (unsigned long long)sink);
+    return 0;
+}
@@ -0,0 +1,500 @@
+/**
+ * sort_profile.c: 정렬/탐색 알고리즘 작업량 프로파일 (알고리즘 × 입력 분포 표)
+ *
+ * ds_bench가 시간만 재는 것과 달리 알고리즘이 한 일을 센다.
+ * ds_counted(DS_COUNTERS_ENABLED=1로 빌드한 libds)를 링크해 비교/교환/이동 횟수를 얻고,
+ * --perf를 주면 perf_event_open으로 사이클, LLC 미스, 분기 예측 실패도 읽는다.
+ *
+ * - 입력 분포: random, sorted, reversed, few-unique(16가지 값), zipf(s = 1)
+ * - 정렬: 원소당 값 (cmp/n, swap/n, move/n, cycles/n ...)
+ * - 탐색: 분포의 정렬본에서 배열에 있는 키를 조회, 조회당 값
+ * - 시간에는 카운터 증가 비용이 포함된다 (순수 시간 비교는 ds_bench)
+ *
+ * 사용법:
+ *   sort_profile [--n N] [--perf] [--filter 이름] [--format table|csv] [--seed S]
+ *
+ * 예:
+ *   sort_profile --n 1e5 --perf
+ *   sort_profile --filter sort/intro --format csv > intro.csv
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ds_counters.h"
+#include "ds_generic_sort.h"
+#include "ds_radix.h"
+#include "ds_search.h"
+#include "ds_small_sort.h"
+#include "ds_sort.h"
+#include "ds_timsort.h"
+
+#if !DS_COUNTERS_ENABLED
+#error "sort_profile은 ds_counted(DS_COUNTERS_ENABLED=1)와 함께 빌드해야 합니다"
+#endif
+
+#define DEFAULT_N        100000
+#define QUADRATIC_MAX_N  20000    // O(n²) 정렬(과 고정 피벗 퀵 정렬)의 크기 상한
+#define SEARCH_QUERIES   10000
+#define FEW_UNIQUE       16
+#define ZIPF_VALUES      65536    // zipf 분포의 서로 다른 값 수
+
+// ==================== 시간 측정 / 난수 ====================
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// xorshift64* 난수 생성기 (시드 고정으로 재현 가능한 입력)
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 2685821657736338717ull;
+}
+
+static void rng_seed(uint64_t seed) {
+    rng_state = seed ? seed : 88172645463325252ull;
+}
+
+// ==================== 입력 분포 ====================
+
+typedef enum { DIST_RANDOM, DIST_SORTED, DIST_REVERSED, DIST_FEW_UNIQUE, DIST_ZIPF, NUM_DISTS } Dist;
+
+static const char *const dist_names[NUM_DISTS] = {
+    "random", "sorted", "reversed", "few-unique", "zipf",
+};
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * zipf(s = 1): 순위 k(1부터)의 확률 ∝ 1/k, 값 = 순위
+ * 누적 분포를 만들어 두고 균등 난수를 이진 탐색으로 순위에 대응시킨다.
+ */
+static int fill_zipf(int arr[], size_t n) {
+    double *cdf = malloc(ZIPF_VALUES * sizeof(double));
+    if (cdf == NULL) {
+        return 0;
+    }
+    double total = 0.0;
+    for (size_t k = 0; k < ZIPF_VALUES; k++) {
+        total += 1.0 / (double)(k + 1);
+        cdf[k] = total;
+    }
+    for (size_t i = 0; i < n; i++) {
+        double u = (double)(rng_next() >> 11) / 9007199254740992.0 * total;   // [0, total)
+        size_t low = 0, high = ZIPF_VALUES - 1;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (cdf[mid] <= u) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        arr[i] = (int)low;
+    }
+    free(cdf);
+    return 1;
+}
+
+static int fill_dist(int arr[], size_t n, Dist dist) {
+    switch (dist) {
+    case DIST_SORTED:
+    case DIST_REVERSED:
+        for (size_t i = 0; i < n; i++) {
+            arr[i] = (int)(dist == DIST_SORTED ? i : n - i);
+        }
+        return 1;
+    case DIST_FEW_UNIQUE:
+        for (size_t i = 0; i < n; i++) {
+            arr[i] = (int)(rng_next() % FEW_UNIQUE);
+        }
+        return 1;
+    case DIST_ZIPF:
+        return fill_zipf(arr, n);
+    default:
+        for (size_t i = 0; i < n; i++) {
+            arr[i] = (int)(rng_next() % 1000000000u);
+        }
+        return 1;
+    }
+}
+
+// ==================== 측정 대상 ====================
+
+static void shell_knuth(int arr[], size_t n) {
+    ds_shell_sort_gaps(arr, n, DS_SHELL_GAPS_KNUTH);
+}
+
+static void merge_sort(int arr[], size_t n) {
+    ds_merge_sort(arr, n);
+}
+
+static void radix_decimal(int arr[], size_t n) {
+    ds_radix_sort(arr, n);
+}
+
+static void radix_lsd_i32(int arr[], size_t n) {
+    ds_radix_sort_i32((int32_t *)arr, n);
+}
+
+// 입력 값은 모두 0 이상이므로 부호 없는 키로 정렬해도 순서 동일
+static void radix_msd_u32(int arr[], size_t n) {
+    ds_msd_radix_sort_u32((uint32_t *)arr, n, 1);
+}
+
+static void tim_sort(int arr[], size_t n) {
+    ds_tim_sort(arr, n, NULL);
+}
+
+static void generic_quick(int arr[], size_t n) {
+    ds_generic_quick_sort(arr, n, sizeof(int), compare_int);
+}
+
+static void generic_merge(int arr[], size_t n) {
+    ds_generic_merge_sort(arr, n, sizeof(int), compare_int);
+}
+
+static void generic_heap(int arr[], size_t n) {
+    ds_generic_heap_sort(arr, n, sizeof(int), compare_int);
+}
+
+typedef struct {
+    const char *name;
+    size_t max_n;                        // 0: 제한 없음
+    void (*sort)(int arr[], size_t n);
+} SortCase;
+
+static const SortCase sort_cases[] = {
+    {"sort/selection",     QUADRATIC_MAX_N, ds_selection_sort},
+    {"sort/insertion",     QUADRATIC_MAX_N, ds_insertion_sort},
+    {"sort/bubble",        QUADRATIC_MAX_N, ds_bubble_sort},
+    {"sort/shell",         0,               ds_shell_sort},
+    {"sort/shell_knuth",   0,               shell_knuth},
+    {"sort/merge",         0,               merge_sort},
+    {"sort/tim",           0,               tim_sort},
+    {"sort/quick",         QUADRATIC_MAX_N, ds_quick_sort},
+    {"sort/heap",          0,               ds_heap_sort},
+    {"sort/heap_top_down", 0,               ds_heap_sort_top_down},
+    {"sort/intro",         0,               ds_intro_sort},
+    {"sort/pdq",           0,               ds_pdq_sort},
+    {"sort/generic_quick", 0,               generic_quick},
+    {"sort/generic_merge", 0,               generic_merge},
+    {"sort/generic_heap",  0,               generic_heap},
+    {"sort/binary_insert", QUADRATIC_MAX_N, ds_binary_insertion_sort},
+    {"sort/radix",         0,               radix_decimal},
+    {"sort/radix_lsd_i32", 0,               radix_lsd_i32},
+    {"sort/radix_msd_u32", 0,               radix_msd_u32},
+};
+
+#define NUM_SORT_CASES (sizeof(sort_cases) / sizeof(sort_cases[0]))
+
+typedef struct {
+    const int *sorted;
+    size_t n;
+    const DsIndexEntry *table;
+    size_t m;
+} SearchInput;
+
+static long search_sequential(const SearchInput *in, int key) {
+    return ds_sequential_search(in->sorted, in->n, key);
+}
+
+static long search_binary(const SearchInput *in, int key) {
+    return ds_binary_search(in->sorted, in->n, key);
+}
+
+static long search_interpolation(const SearchInput *in, int key) {
+    return ds_interpolation_search(in->sorted, in->n, key);
+}
+
+static long search_indexed(const SearchInput *in, int key) {
+    return ds_indexed_search(in->sorted, in->n, in->table, in->m, key);
+}
+
+typedef struct {
+    const char *name;
+    size_t max_n;
+    long (*search)(const SearchInput *in, int key);
+} SearchCase;
+
+static const SearchCase search_cases[] = {
+    {"search/sequential",    QUADRATIC_MAX_N, search_sequential},
+    {"search/binary",        0,               search_binary},
+    {"search/interpolation", 0,               search_interpolation},
+    {"search/indexed",       0,               search_indexed},
+};
+
+#define NUM_SEARCH_CASES (sizeof(search_cases) / sizeof(search_cases[0]))
+
+// ==================== 측정 / 출력 ====================
+
+typedef enum { FORMAT_TABLE, FORMAT_CSV } OutputFormat;
+
+typedef struct {
+    size_t n;
+    bool use_perf;
+    const char *filter;
+    OutputFormat format;
+    uint64_t seed;
+} ProfileOptions;
+
+// 한 번의 측정 결과 (per: 정규화 단위 수, 정렬은 n, 탐색은 조회 수)
+typedef struct {
+    const char *name;
+    const char *dist;
+    size_t n;
+    double per;
+    DsCounters counters;
+    DsPerfSample perf;
+    double ms;
+} Profile;
+
+static void print_header(const ProfileOptions *opt) {
+    if (opt->format == FORMAT_CSV) {
+        printf("name,dist,n,comparisons,swaps,moves,cycles,llc_misses,branch_misses,ms\n");
+        return;
+    }
+    printf("%-22s %-11s %9s %10s %9s %9s", "name", "dist", "n", "cmp/unit", "swap/unit",
+           "move/unit");
+    if (opt->use_perf) {
+        printf(" %11s %10s %11s", "cycles/unit", "llc/unit", "brmiss/unit");
+    }
+    printf(" %10s\n", "ms");
+}
+
+static void print_perf_value(uint64_t value, double per, int width) {
+    if (value == DS_PERF_UNAVAILABLE) {
+        printf(" %*s", width, "-");
+    } else {
+        printf(" %*.3f", width, (double)value / per);
+    }
+}
+
+static void print_profile(const ProfileOptions *opt, const Profile *p) {
+    if (opt->format == FORMAT_CSV) {
+        printf("%s,%s,%zu,%llu,%llu,%llu", p->name, p->dist, p->n,
+               (unsigned long long)p->counters.comparisons,
+               (unsigned long long)p->counters.swaps, (unsigned long long)p->counters.moves);
+        for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+            if (!opt->use_perf || p->perf.value[e] == DS_PERF_UNAVAILABLE) {
+                printf(",");
+            } else {
+                printf(",%llu", (unsigned long long)p->perf.value[e]);
+            }
+        }
+        printf(",%.3f\n", p->ms);
+        return;
+    }
+    printf("%-22s %-11s %9zu %10.2f %9.2f %9.2f", p->name, p->dist, p->n,
+           (double)p->counters.comparisons / p->per, (double)p->counters.swaps / p->per,
+           (double)p->counters.moves / p->per);
+    if (opt->use_perf) {
+        print_perf_value(p->perf.value[DS_PERF_CYCLES], p->per, 11);
+        print_perf_value(p->perf.value[DS_PERF_LLC_MISSES], p->per, 10);
+        print_perf_value(p->perf.value[DS_PERF_BRANCH_MISSES], p->per, 11);
+    }
+    printf(" %10.3f\n", p->ms);
+}
+
+static bool matches(const ProfileOptions *opt, const char *name) {
+    return opt->filter == NULL || strstr(name, opt->filter) != NULL;
+}
+
+static void begin_measure(DsPerfCounters *perf, bool use_perf, uint64_t *start) {
+    ds_counters_reset();
+    if (use_perf) {
+        ds_perf_start(perf);
+    }
+    *start = now_ns();
+}
+
+static void end_measure(DsPerfCounters *perf, bool use_perf, uint64_t start, Profile *p) {
+    uint64_t elapsed = now_ns() - start;
+    if (use_perf) {
+        ds_perf_stop(perf, &p->perf);
+    }
+    p->counters = ds_counters;
+    p->ms = (double)elapsed / 1e6;
+}
+
+static bool is_sorted(const int arr[], size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void profile_sorts(const ProfileOptions *opt, DsPerfCounters *perf,
+                          const int *src, int *work, Dist dist) {
+    for (size_t c = 0; c < NUM_SORT_CASES; c++) {
+        const SortCase *sc = &sort_cases[c];
+        if (!matches(opt, sc->name)) {
+            continue;
+        }
+        size_t n = sc->max_n != 0 && opt->n > sc->max_n ? sc->max_n : opt->n;
+        memcpy(work, src, n * sizeof(int));
+
+        Profile p = {sc->name, dist_names[dist], n, (double)n, {0, 0, 0}, {{0}}, 0.0};
+        uint64_t start;
+        begin_measure(perf, opt->use_perf, &start);
+        sc->sort(work, n);
+        end_measure(perf, opt->use_perf, start, &p);
+        if (!is_sorted(work, n)) {
+            fprintf(stderr, "[%s/%s] 정렬 실패\n", sc->name, dist_names[dist]);
+        }
+        print_profile(opt, &p);
+    }
+}
+
+static void profile_searches(const ProfileOptions *opt, DsPerfCounters *perf,
+                             const int *src, int *work, int *keys, Dist dist) {
+    for (size_t c = 0; c < NUM_SEARCH_CASES; c++) {
+        const SearchCase *sc = &search_cases[c];
+        if (!matches(opt, sc->name)) {
+            continue;
+        }
+        size_t n = sc->max_n != 0 && opt->n > sc->max_n ? sc->max_n : opt->n;
+        memcpy(work, src, n * sizeof(int));
+        qsort(work, n, sizeof(int), compare_int);
+        for (size_t q = 0; q < SEARCH_QUERIES; q++) {
+            keys[q] = work[rng_next() % n];   // 모두 있는 키
+        }
+        size_t m = (size_t)sqrt((double)n);   // 색인 구간 수: O(m + n/m) 최소
+        DsIndexEntry *table = malloc((m ? m : 1) * sizeof(DsIndexEntry));
+        if (table == NULL) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            return;
+        }
+        ds_index_build(work, n, table, m ? m : 1);
+        SearchInput in = {work, n, table, m ? m : 1};
+
+        Profile p = {sc->name, dist_names[dist], n, SEARCH_QUERIES, {0, 0, 0}, {{0}}, 0.0};
+        size_t misses = 0;
+        uint64_t start;
+        begin_measure(perf, opt->use_perf, &start);
+        for (size_t q = 0; q < SEARCH_QUERIES; q++) {
+            long pos = sc->search(&in, keys[q]);
+            misses += pos < 0 || work[pos] != keys[q];
+        }
+        end_measure(perf, opt->use_perf, start, &p);
+        if (misses > 0) {
+            fprintf(stderr, "[%s/%s] %zu개 조회 실패\n", sc->name, dist_names[dist], misses);
+        }
+        print_profile(opt, &p);
+        free(table);
+    }
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "사용법: %s [--n N] [--perf] [--filter 이름] [--format table|csv] [--seed S]\n"
+            "  N은 1e5 같은 지수 표기 허용 (기본: 1e5, O(n²) 정렬은 %d개까지)\n",
+            prog, QUADRATIC_MAX_N);
+}
+
+static int parse_size(const char *text, size_t *out) {
+    char *end;
+    double value = strtod(text, &end);
+    if (end == text || *end != '\0' || value < 2.0 || value > 1e10) {
+        return 0;
+    }
+    *out = (size_t)value;
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    ProfileOptions opt = {DEFAULT_N, false, NULL, FORMAT_TABLE, 0};
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "--perf") == 0) {
+            opt.use_perf = true;
+            continue;
+        }
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (value == NULL) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        int ok = 1;
+        if (strcmp(arg, "--n") == 0) {
+            ok = parse_size(value, &opt.n);
+        } else if (strcmp(arg, "--filter") == 0) {
+            opt.filter = value;
+        } else if (strcmp(arg, "--seed") == 0) {
+            opt.seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "table") == 0) {
+                opt.format = FORMAT_TABLE;
+            } else if (strcmp(value, "csv") == 0) {
+                opt.format = FORMAT_CSV;
+            } else {
+                ok = 0;
+            }
+        } else {
+            ok = 0;
+        }
+        if (!ok) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    DsPerfCounters perf;
+    if (opt.use_perf && !ds_perf_open(&perf)) {
+        fprintf(stderr, "perf_event_open 실패 (%s): 하드웨어 카운터 없이 진행\n",
+                strerror(errno));
+        opt.use_perf = false;
+    }
+
+    int *src = malloc(opt.n * sizeof(int));
+    int *work = malloc(opt.n * sizeof(int));
+    int *keys = malloc(SEARCH_QUERIES * sizeof(int));
+    if (src == NULL || work == NULL || keys == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(src);
+        free(work);
+        free(keys);
+        return 1;
+    }
+
+    print_header(&opt);
+    for (Dist dist = DIST_RANDOM; dist < NUM_DISTS; dist++) {
+        rng_seed(opt.seed + dist);
+        if (!fill_dist(src, opt.n, dist)) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            break;
+        }
+        profile_sorts(&opt, &perf, src, work, dist);
+        profile_searches(&opt, &perf, src, work, keys, dist);
+    }
+
+    if (opt.use_perf) {
+        ds_perf_close(&perf);
+    }
+    free(src);
+    free(work);
+    free(keys);
+    return 0;
+}
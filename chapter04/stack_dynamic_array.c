@@ -9,6 +9,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "ds_trace.h"
+
 #define INIT_CAPACITY 10  /* 초기 용량 */
 
 typedef int element;
@@ -65,7 +67,7 @@ void resize_stack(StackType *s) {
 
     s->data = new_data;
     s->capacity = new_capacity;
-    printf("[용량 확장: %d → %d]\n", s->capacity / 2, s->capacity);
+    DS_TRACE("[용량 확장: %d → %d]\n", s->capacity / 2, s->capacity);
 }
 
 /*
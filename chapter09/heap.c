@@ -21,6 +21,9 @@
  * - 삽입 (insert_heap): O(log n) - 상향 이동 (up-heap)
  * - 삭제 (delete_heap): O(log n) - 하향 이동 (down-heap)
  * - 최댓값 찾기 (find_max): O(1)
+ *
+ * 크기가 MAX_HEAP_SIZE로 고정된 교육용 구현이다.
+ * 용량 자동 확장, 임의 원소 타입, Min/Max 모드는 timer_queue.c (libds/ds_pqueue.h) 참고.
  */
 
 #include <stdio.h>
@@ -19,9 +19,24 @@
  * 단점:
  * - 불안정 정렬(unstable sort)
  * - 실제로는 퀵 정렬보다 느린 경우가 많음
+ *
+ * 상향식 힙 정렬 (Bottom-up Heap Sort, Wegener):
+ * - heapify는 한 단계 내려갈 때마다 비교 2번 (왼쪽 vs 오른쪽, 큰 자식 vs 현재 값)
+ * - 루트로 올라온 값은 원래 마지막 리프였으므로 거의 항상 맨 아래까지 내려간다
+ * - 그렇다면 현재 값과의 비교를 생략하고 큰 자식 쪽으로 리프까지 먼저 내려간 뒤,
+ *   리프에서 값이 들어갈 자리까지 거슬러 올라가면 비교가 약 절반으로 줄어든다
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds_counters.h"
+#include "ds_sort.h"
+
+#if !DS_COUNTERS_ENABLED
+#error "heap_sort는 ds_counted(DS_COUNTERS_ENABLED=1)와 함께 빌드해야 합니다"
+#endif
 
 
 // ==================== 보조 함수 ====================
@@ -163,6 +178,73 @@ void heap_sort(int arr[], int n) {
 }
 
 
+// ==================== 의사코드: heapify_bottom_up ====================
+
+/*
+ALGORITHM heapify_bottom_up(arr, n, i)
+  item ← arr[i]
+  hole ← i
+
+  // 1단계: item과 비교하지 않고 큰 자식 쪽으로 리프까지 구멍을 내림
+  WHILE (2*hole + 1 < n) DO
+    child ← 2*hole + 1
+    IF (child + 1 < n AND arr[child + 1] > arr[child]) THEN
+      child ← child + 1
+    END IF
+    arr[hole] ← arr[child]
+    hole ← child
+  END WHILE
+
+  // 2단계: 리프에서 item이 들어갈 자리까지 거슬러 올라감
+  WHILE (hole > i AND arr[(hole-1)/2] < item) DO
+    arr[hole] ← arr[(hole-1)/2]
+    hole ← (hole-1)/2
+  END WHILE
+  arr[hole] ← item
+*/
+
+/**
+ * 상향식 하향 이동: 리프까지 먼저 내려간 뒤 올라오며 자리를 찾는다
+ * @param arr 배열
+ * @param n 현재 힙 크기
+ * @param i 시작 노드 인덱스
+ */
+void heapify_bottom_up(int arr[], int n, int i) {
+    int item = arr[i];
+    int hole = i;
+
+    // 1단계: 큰 자식을 한 칸씩 끌어올리며 리프까지 (단계당 비교 1번)
+    while (2 * hole + 1 < n) {
+        int child = 2 * hole + 1;
+        if (child + 1 < n && arr[child + 1] > arr[child]) {
+            child++;
+        }
+        arr[hole] = arr[child];
+        hole = child;
+    }
+
+    // 2단계: item보다 작은 부모를 끌어내리며 위로 (보통 1~2단계)
+    while (hole > i && arr[(hole - 1) / 2] < item) {
+        arr[hole] = arr[(hole - 1) / 2];
+        hole = (hole - 1) / 2;
+    }
+    arr[hole] = item;
+}
+
+/**
+ * 상향식 힙 정렬 (힙 구성과 추출 모두 heapify_bottom_up 사용)
+ */
+void heap_sort_bottom_up(int arr[], int n) {
+    for (int i = (n / 2) - 1; i >= 0; i--) {
+        heapify_bottom_up(arr, n, i);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        swap(&arr[0], &arr[i]);
+        heapify_bottom_up(arr, i, 0);
+    }
+}
+
+
 // ==================== 테스트 코드 ====================
 
 int main(void) {
@@ -256,7 +338,65 @@ int main(void) {
 
     printf("정렬 후: ");
     print_array(arr6, n6);
+    printf("\n\n");
+
+    // 테스트 케이스 7: 교재 방식 vs 상향식 비교 횟수
+    printf("========== 테스트 7: heapify vs heapify_bottom_up ==========\n");
+    int arr7[] = {5, 2, 8, 2, 9, 1, 5};
+    int n7 = sizeof(arr7) / sizeof(arr7[0]);
+
+    printf("정렬 전: ");
+    print_array(arr7, n7);
+    printf("\n");
+
+    heap_sort_bottom_up(arr7, n7);
+
+    printf("정렬 후: ");
+    print_array(arr7, n7);
     printf("\n");
 
+    // 비교 횟수는 같은 두 방식을 구현한 libds가 직접 센다 (ds_counted 링크, ds_counters.h)
+    enum { N_LARGE = 100000 };
+    int *original = malloc(N_LARGE * sizeof(int));
+    int *a = malloc(N_LARGE * sizeof(int));
+    int *b = malloc(N_LARGE * sizeof(int));
+    if (original == NULL || a == NULL || b == NULL) {
+        printf("메모리 할당 실패\n");
+        free(original);
+        free(a);
+        free(b);
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < N_LARGE; i++) {
+        original[i] = rand();
+    }
+
+    memcpy(a, original, N_LARGE * sizeof(int));
+    ds_counters_reset();
+    ds_heap_sort_top_down(a, N_LARGE);
+    unsigned long long top_down = (unsigned long long)ds_counters.comparisons;
+
+    memcpy(b, original, N_LARGE * sizeof(int));
+    ds_counters_reset();
+    ds_heap_sort(b, N_LARGE);
+    unsigned long long bottom_up = (unsigned long long)ds_counters.comparisons;
+
+    // 이 파일의 heap_sort / heap_sort_bottom_up도 같은 결과를 내는지 확인
+    int same = memcmp(a, b, N_LARGE * sizeof(int)) == 0;
+    memcpy(b, original, N_LARGE * sizeof(int));
+    heap_sort(b, N_LARGE);
+    same &= memcmp(a, b, N_LARGE * sizeof(int)) == 0;
+    memcpy(b, original, N_LARGE * sizeof(int));
+    heap_sort_bottom_up(b, N_LARGE);
+    same &= memcmp(a, b, N_LARGE * sizeof(int)) == 0;
+
+    printf("무작위 %d개 비교 횟수: 하향식 %llu, 상향식 %llu (%.2f배), 결과 %s\n",
+           N_LARGE, top_down, bottom_up, (double)top_down / (double)bottom_up,
+           same ? "같음" : "다름");
+    free(original);
+    free(a);
+    free(b);
+
     return 0;
 }
@@ -17,6 +17,9 @@
  * 예시: "abbccc"
  *   빈도: a=1, b=2, c=3
  *   코드: c=0, b=10, a=11 (빈도가 높을수록 짧은 코드)
+ *
+ * 실제 파일 압축/복원(비트 단위 출력, 정규 코드 헤더, 표 조회 복호)은 huffman_file.c (libds/ds_huffman.h)
+ * (트리를 한 비트씩 따라 내려가는 복호는 기호마다 분기가 코드 길이만큼 생겨 느리다)
  */
 
 #include <stdio.h>
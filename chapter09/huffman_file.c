@@ -0,0 +1,166 @@
+/**
+ * Chapter 09: 허프만 파일 압축기
+ *
+ * huffman.c는 코드를 '0'/'1' 문자열로 보여 주고 이론 압축률만 계산한다.
+ * 이 프로그램은 libds의 ds_huffman으로 실제 파일을 압축/복원한다.
+ *
+ *   1) 블록(256 KiB)마다 바이트 빈도 계산 → 코드 길이 (최대 15비트)
+ *   2) 헤더에는 기호별 코드 길이만 기록 (정규 코드: 길이만으로 코드 복원)
+ *   3) 코드를 64비트 비트 버퍼에 쌓아 8바이트씩 출력
+ *   4) 복원: 다음 11비트로 복호 표를 한 번 조회 → 짧은 코드면 기호 2~3개가 한꺼번에 나옴
+ *
+ *   코드 길이: a=1, b=2, c=3, d=3
+ *   정규 코드: a=0, b=10, c=110, d=111   (짧은 코드부터, 같은 길이는 기호 순으로 연속 번호)
+ *
+ * 사용법:
+ *   huffman_file compress <입력> <출력>
+ *   huffman_file decompress <입력> <출력>
+ *   huffman_file bench [MB]          로그 형태 텍스트를 메모리에서 압축/복원 (기본 64 MB)
+ *
+ * 예:
+ *   huffman_file compress access.log access.log.dshf
+ *   huffman_file decompress access.log.dshf restored.log && cmp access.log restored.log
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+
+#include "ds_huffman.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// xorshift64* 난수 (시드 고정으로 재현 가능한 입력)
+static uint64_t rng_next(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+static void print_stats(const char *title, const DsHuffmanStats *stats, double elapsed) {
+    printf("=== %s ===\n", title);
+    printf("입력        : %llu 바이트\n", (unsigned long long)stats->input_bytes);
+    printf("출력        : %llu 바이트\n", (unsigned long long)stats->output_bytes);
+    printf("블록        : %llu개 (원본 저장 %llu개)\n", (unsigned long long)stats->blocks,
+           (unsigned long long)stats->raw_blocks);
+    if (stats->input_bytes > 0) {
+        printf("크기 비율   : %.1f%%\n", 100.0 * stats->output_bytes / stats->input_bytes);
+    }
+    printf("소요 시간   : %.3f초 (입력 기준 %.1f MB/s)\n", elapsed,
+           elapsed > 0 ? stats->input_bytes / 1e6 / elapsed : 0.0);
+}
+
+static int process(const char *input_path, const char *output_path, int compress) {
+    DsHuffmanStats stats;
+    double start = now_seconds();
+    bool ok = compress ? ds_huffman_compress_file(input_path, output_path, &stats)
+                       : ds_huffman_decompress_file(input_path, output_path, &stats);
+    double elapsed = now_seconds() - start;
+    if (!ok) {
+        fprintf(stderr, "%s 실패: %s\n", compress ? "압축" : "복원",
+                errno == EINVAL ? "압축 파일 형식이 잘못됨" : strerror(errno));
+        return 1;
+    }
+    print_stats(compress ? "압축 결과" : "복원 결과", &stats, elapsed);
+    return 0;
+}
+
+/**
+ * 서비스 접근 로그 비슷한 텍스트 (시각, 수준, 작업자, 경로, 상태, 지연 시간)
+ */
+static void generate_log(uint8_t *buffer, size_t size) {
+    static const char *levels[] = {"INFO ", "INFO ", "INFO ", "DEBUG", "WARN ", "ERROR"};
+    static const char *paths[] = {"/api/v1/items", "/api/v1/users", "/api/v1/orders",
+                                  "/healthz", "/api/v2/search", "/static/app.js"};
+    static const int statuses[] = {200, 200, 200, 200, 201, 204, 304, 404, 500};
+    uint64_t state = 88172645463325252ull;
+    char line[160];
+    size_t pos = 0;
+    unsigned long long ms = 0;
+
+    while (pos < size) {
+        uint64_t r = rng_next(&state);
+        ms += r % 50;
+        int len = snprintf(line, sizeof(line),
+                           "2026-10-16 %02llu:%02llu:%02llu.%03llu %s [worker-%02u] "
+                           "request id=%06u path=%s status=%d latency_ms=%u\n",
+                           ms / 3600000 % 24, ms / 60000 % 60, ms / 1000 % 60, ms % 1000,
+                           levels[(r >> 8) % 6], (unsigned)(r >> 12) % 32,
+                           (unsigned)(r >> 20) % 1000000, paths[(r >> 40) % 6],
+                           statuses[(r >> 44) % 9], (unsigned)(r >> 52) % 400);
+        size_t copy = (size_t)len < size - pos ? (size_t)len : size - pos;
+        memcpy(buffer + pos, line, copy);
+        pos += copy;
+    }
+}
+
+static int bench(size_t megabytes) {
+    size_t n = megabytes << 20;
+    size_t capacity = ds_huffman_compress_bound(n);
+    uint8_t *original = malloc(n ? n : 1);
+    uint8_t *packed = malloc(capacity);
+    uint8_t *restored = malloc(n ? n : 1);
+    if (original == NULL || packed == NULL || restored == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(original);
+        free(packed);
+        free(restored);
+        return 1;
+    }
+    generate_log(original, n);
+    memset(packed, 0, capacity);   // 출력 버퍼 첫 접근(페이지 폴트)을 측정에서 제외
+    memset(restored, 0, n);
+
+    size_t packed_size = 0, restored_size = 0;
+    double t0 = now_seconds();
+    bool ok = ds_huffman_compress(original, n, packed, capacity, &packed_size);
+    double t1 = now_seconds();
+    ok = ok && ds_huffman_decompress(packed, packed_size, restored, n, &restored_size);
+    double t2 = now_seconds();
+    ok = ok && restored_size == n && memcmp(original, restored, n) == 0;
+
+    printf("=== 허프만 압축 메모리 벤치마크 (로그 형태 텍스트 %zu MB) ===\n", megabytes);
+    printf("압축 크기   : %zu 바이트 (%.1f%%)\n", packed_size,
+           n ? 100.0 * packed_size / n : 0.0);
+    printf("압축        : %8.1f ms  %8.1f MB/s\n", (t1 - t0) * 1e3, n / 1e6 / (t1 - t0));
+    printf("복원        : %8.1f ms  %8.1f MB/s\n", (t2 - t1) * 1e3, n / 1e6 / (t2 - t1));
+    printf("왕복 검증   : %s\n", ok ? "일치" : "불일치");
+
+    free(original);
+    free(packed);
+    free(restored);
+    return ok ? 0 : 1;
+}
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "사용법:\n"
+            "  %s compress <입력> <출력>\n"
+            "  %s decompress <입력> <출력>\n"
+            "  %s bench [MB]\n",
+            prog, prog, prog);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 4 && strcmp(argv[1], "compress") == 0) {
+        return process(argv[2], argv[3], 1);
+    }
+    if (argc == 4 && strcmp(argv[1], "decompress") == 0) {
+        return process(argv[2], argv[3], 0);
+    }
+    if (argc >= 2 && argc <= 3 && strcmp(argv[1], "bench") == 0) {
+        return bench(argc == 3 ? (size_t)strtoull(argv[2], NULL, 10) : 64);
+    }
+    print_usage(argv[0]);
+    return 1;
+}
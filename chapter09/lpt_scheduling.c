@@ -16,11 +16,22 @@
  * - 전체: O(n log m)
  *
  * 성능 보장: LPT는 최적해의 4/3 - 1/(3m) 배 이내의 해를 보장
+ *
+ * 대규모 실행: lpt_scheduling large [n] [m] (기본 작업 1e7개, 머신 1e4대)
+ * → libds/ds_lpt.h 엔진 (기수 정렬 + 머신 힙 루트 교체, 로컬 서치/MULTIFIT 개선)
+ * 온라인 실행: lpt_scheduling online [n] [m] (작업이 시간에 따라 도착, 완료 시 부하 감소)
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ds_lpt.h"
+#include "ds_dary_heap.h"
+#include "ds_trace.h"
 
 #define MAX_JOBS 100
 #define MAX_MACHINES 10
@@ -250,7 +261,7 @@ int lpt_schedule(Job jobs[], int n, int m, Machine machines[]) {
     }
 
     // 3단계: 작업 할당
-    printf("\n========== 작업 할당 과정 ==========\n");
+    DS_TRACE("\n========== 작업 할당 과정 ==========\n");
     while (job_heap_size > 0) {
         // 가장 긴 작업 추출
         Job job = extract_max_job(job_heap, &job_heap_size);
@@ -258,15 +269,15 @@ int lpt_schedule(Job jobs[], int n, int m, Machine machines[]) {
         // 가장 한가한 머신 추출
         Machine machine = extract_min_machine(machine_heap, &machine_heap_size);
 
-        printf("작업 J%d(%d) → 머신 M%d (이전 시간: %d)",
-               job.id, job.processing_time, machine.id, machine.total_time);
+        DS_TRACE("작업 J%d(%d) → 머신 M%d (이전 시간: %d)",
+                 job.id, job.processing_time, machine.id, machine.total_time);
 
         // 작업 할당
         machine.total_time += job.processing_time;
         machine.jobs[machine.job_count] = job.id;
         machine.job_count++;
 
-        printf(" → 새 시간: %d\n", machine.total_time);
+        DS_TRACE(" → 새 시간: %d\n", machine.total_time);
 
         // 머신을 다시 힙에 삽입
         reinsert_machine(machine_heap, &machine_heap_size, machine);
@@ -289,6 +300,176 @@ int lpt_schedule(Job jobs[], int n, int m, Machine machines[]) {
 }
 
 
+// ==================== 대규모 실행 (lpt_scheduling large [n] [m]) ====================
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * 무작위 작업 n개, 머신 m대를 libds LPT 엔진(libds/ds_lpt.h)으로 배정하고
+ * 개선 단계별 makespan / 하한 비율과 시간을 비교한다
+ */
+static int run_large(size_t n, uint32_t m) {
+    static const struct {
+        const char *name;
+        unsigned refine;
+    } modes[] = {
+        {"LPT", DS_LPT_REFINE_NONE},
+        {"LPT+local", DS_LPT_REFINE_LOCAL_SEARCH},
+        {"MULTIFIT", DS_LPT_REFINE_MULTIFIT},
+        {"MULTIFIT+local", DS_LPT_REFINE_MULTIFIT | DS_LPT_REFINE_LOCAL_SEARCH},
+    };
+
+    uint32_t *times = malloc(n * sizeof(uint32_t));
+    uint32_t *assignment = malloc(n * sizeof(uint32_t));
+    uint64_t *loads = malloc((size_t)m * sizeof(uint64_t));
+    if (times == NULL || assignment == NULL || loads == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(times);
+        free(assignment);
+        free(loads);
+        return 1;
+    }
+    srand(12345);
+    for (size_t i = 0; i < n; i++) {
+        times[i] = 1 + (uint32_t)(rand() % 1000);   // 처리 시간 1 ~ 1000
+    }
+
+    printf("=== 대규모 LPT (작업 %zu개, 머신 %u대) ===\n\n", n, m);
+    printf("방식              makespan         하한    비율   이동/교환  FFD 시험   시간(ms)\n");
+
+    int status = 0;
+    for (size_t k = 0; k < sizeof(modes) / sizeof(modes[0]); k++) {
+        DsLptOptions opt = DS_LPT_OPTIONS_DEFAULT;
+        opt.refine = modes[k].refine;
+        DsLptReport report;
+
+        double start = now_seconds();
+        bool ok = ds_lpt_schedule(times, n, m, assignment, loads, &opt, &report);
+        double elapsed = now_seconds() - start;
+        if (!ok) {
+            fprintf(stderr, "%s: 메모리 할당 실패\n", modes[k].name);
+            status = 1;
+            break;
+        }
+
+        // 검증: 모든 작업이 머신에 배정되고 부하 합이 처리 시간 합과 같아야 한다
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < m; i++) {
+            sum += loads[i];
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (assignment[i] >= m) {
+                sum = UINT64_MAX;
+                break;
+            }
+        }
+        if (sum != report.total_time || report.makespan > report.lpt_makespan) {
+            fprintf(stderr, "%s: 배정 검증 실패\n", modes[k].name);
+            status = 1;
+        }
+        printf("%-16s %12llu %12llu %7.4f %10zu %9u %10.1f\n", modes[k].name,
+               (unsigned long long)report.makespan, (unsigned long long)report.lower_bound,
+               (double)report.makespan / (double)report.lower_bound, report.moves,
+               report.multifit_probes, elapsed * 1e3);
+    }
+
+    free(times);
+    free(assignment);
+    free(loads);
+    return status;
+}
+
+
+// ==================== 온라인 실행 (lpt_scheduling online [n] [m]) ====================
+
+/**
+ * 클러스터 모사: 작업 n개가 일정 간격으로 도착해 가장 한가한 머신에 배정되고,
+ * 머신은 받은 작업을 순서대로 처리한다. 완료 시각은 4진 힙에 넣어 두었다가
+ * 시계가 지나면 ds_lpt_online_complete로 부하를 되돌린다 (완료 콜백 자리).
+ * 중간(n/2)에 머신 10%를 빼고, 3n/4에 다시 추가한다.
+ */
+typedef struct {
+    uint64_t deadline;   // 완료 시각
+    uint32_t job;
+} Completion;
+
+#define COMPLETION_BEFORE(a, b) ((a).deadline < (b).deadline)
+
+DS_DEFINE_DARY_HEAP(completion, Completion, 4, COMPLETION_BEFORE)
+
+static int run_online(size_t n, uint32_t m) {
+    DsLptOnline sched;
+    completion_DaryHeap finished;
+    uint64_t *busy_until = calloc(m, sizeof(uint64_t));  // 머신별 마지막 작업 완료 시각
+    uint32_t *removed = malloc((m / 10 + 1) * sizeof(uint32_t));
+    if (busy_until == NULL || removed == NULL || !ds_lpt_online_init(&sched, m)) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(busy_until);
+        free(removed);
+        return 1;
+    }
+    completion_dary_heap_init(&finished);
+
+    srand(12345);
+    uint32_t num_removed = 0;
+    uint64_t max_backlog = 0;   // 배정 직후 머신 부하의 최댓값 (대기 + 처리 시간)
+    double start = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        // 평균 처리 시간 500, 도착 간격 500 / (0.9 m) → 가동률 약 90%
+        uint64_t now = (uint64_t)i * 5000 / (9 * (uint64_t)m);
+        Completion done;
+        while (completion_dary_heap_peek(&finished, &done) && done.deadline <= now) {
+            completion_dary_heap_pop(&finished, &done);
+            ds_lpt_online_complete(&sched, done.job);
+        }
+
+        if (i == n / 2) {   // 머신 10% 제거: 새 작업은 받지 않고 남은 작업은 끝낸다
+            for (uint32_t k = 0; k < m / 10; k++) {
+                removed[num_removed] = k * 10;
+                num_removed += ds_lpt_online_remove_machine(&sched, k * 10);
+            }
+        } else if (i == n / 4 * 3) {
+            for (uint32_t k = 0; k < num_removed; k++) {
+                ds_lpt_online_add_machine(&sched, NULL);   // 빈 슬롯(제거된 번호)을 재사용
+            }
+        }
+
+        uint32_t time = 1 + (uint32_t)(rand() % 1000);
+        uint32_t job, machine;
+        if (!ds_lpt_online_submit(&sched, time, &job, &machine)) {
+            fprintf(stderr, "배정 실패 (작업 %zu)\n", i);
+            break;
+        }
+        // 제거 후 재추가된 머신은 빈 슬롯 번호를 재사용하므로 항상 machine < m
+        busy_until[machine] = (busy_until[machine] > now ? busy_until[machine] : now) + time;
+        if (!completion_dary_heap_push(&finished, (Completion){busy_until[machine], job})) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            break;
+        }
+        uint64_t load = ds_lpt_online_load(&sched, machine);
+        max_backlog = load > max_backlog ? load : max_backlog;
+    }
+    double elapsed = now_seconds() - start;
+
+    printf("=== 온라인 LPT (작업 %zu개, 머신 %u대, 가동률 약 90%%) ===\n\n", n, m);
+    printf("중간 제거/재추가 머신: %u대\n", num_removed);
+    printf("진행 중 작업 (마지막 시점): %zu개\n", ds_lpt_online_num_jobs(&sched));
+    printf("머신 최대 부하 (대기 + 처리): %llu\n", (unsigned long long)max_backlog);
+    printf("시간: %.1f ms, 초당 배정 %.2f백만 건 (완료 처리 포함)\n", elapsed * 1e3,
+           (double)n / elapsed / 1e6);
+
+    completion_dary_heap_destroy(&finished);
+    ds_lpt_online_destroy(&sched);
+    free(busy_until);
+    free(removed);
+    return 0;
+}
+
+
 // ==================== 테스트 코드 ====================
 
 /**
@@ -316,7 +497,26 @@ void print_schedule(Machine machines[], int m) {
     printf("\nMakespan (전체 완료 시간): %d\n", makespan);
 }
 
-int main(void) {
+int main(int argc, char *argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "large") == 0) {
+        size_t n = argc >= 3 ? (size_t)strtod(argv[2], NULL) : 10000000;
+        size_t m = argc >= 4 ? (size_t)strtod(argv[3], NULL) : 10000;
+        if (n == 0 || n > UINT32_MAX || m == 0 || m > UINT32_MAX) {
+            fprintf(stderr, "사용법: %s large [작업 수] [머신 수]\n", argv[0]);
+            return 1;
+        }
+        return run_large(n, (uint32_t)m);
+    }
+    if (argc >= 2 && strcmp(argv[1], "online") == 0) {
+        size_t n = argc >= 3 ? (size_t)strtod(argv[2], NULL) : 10000000;
+        size_t m = argc >= 4 ? (size_t)strtod(argv[3], NULL) : 1000;
+        if (m == 0 || m >= UINT32_MAX) {
+            fprintf(stderr, "사용법: %s online [작업 수] [머신 수]\n", argv[0]);
+            return 1;
+        }
+        return run_online(n, (uint32_t)m);
+    }
+
     printf("========== LPT (Longest Processing Time First) 스케줄링 ==========\n");
 
     // 테스트 케이스 1
@@ -0,0 +1,154 @@
+/**
+ * Chapter 09: 타이머 큐 - 동적 확장되는 임의 타입 우선순위 큐
+ *
+ * heap.c의 Heap은 int 100개 고정 배열이라 101번째 삽입에서 종료한다.
+ * 스케줄러는 수백만 개의 대기 타이머(마감 시각 + 작업 ID)를 들고 있으므로
+ * libds의 DsPQueue로 같은 힙을 다음처럼 일반화한다.
+ *
+ * - 원소 크기 + 비교 함수: 구조체 Timer를 그대로 저장
+ * - 용량이 차면 2배로 확장 (16 → 32 → 64 → ...)
+ * - Min 모드: 마감 시각이 가장 이른 타이머가 루트
+ * - 대량 등록은 배열로부터 O(n) 구성 (push n번은 O(n log n))
+ * - 타이머를 다 처리하면 shrink_to_fit으로 메모리 반환
+ *
+ * 사용법:
+ *   timer_queue        예제 + 타이머 1000000개
+ *   timer_queue [n]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ds_pqueue.h"
+
+typedef struct {
+    uint64_t deadline;   // 만료 시각 (ms)
+    uint32_t id;         // 작업 ID
+    uint32_t period;     // 0이 아니면 주기 타이머 (ms)
+} Timer;
+
+static int compare_timer(const void *a, const void *b) {
+    const Timer *x = a;
+    const Timer *y = b;
+    return (x->deadline > y->deadline) - (x->deadline < y->deadline);
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// xorshift64* 난수 (시드 고정으로 재현 가능한 입력)
+static uint64_t rng_next(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+static void demo(void) {
+    const Timer timers[] = {
+        {300, 1, 0}, {100, 2, 250}, {250, 3, 0}, {50, 4, 0}, {400, 5, 0},
+    };
+    size_t n = sizeof(timers) / sizeof(timers[0]);
+
+    DsPQueue queue;
+    ds_pqueue_init(&queue, sizeof(Timer), compare_timer, DS_HEAP_MIN);
+
+    printf("=== 타이머 등록 ===\n");
+    for (size_t i = 0; i < n; i++) {
+        if (!ds_pqueue_push(&queue, &timers[i])) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            ds_pqueue_destroy(&queue);
+            return;
+        }
+        const Timer *next = ds_pqueue_peek(&queue);
+        printf("등록: 작업 %u @%4llums → 다음 만료: 작업 %u @%4llums\n", timers[i].id,
+               (unsigned long long)timers[i].deadline, next->id,
+               (unsigned long long)next->deadline);
+    }
+
+    printf("\n=== 만료 순서 (작업 2는 250ms 주기) ===\n");
+    Timer fired;
+    unsigned repeats = 0;
+    while (!ds_pqueue_is_empty(&queue)) {
+        const Timer *next = ds_pqueue_peek(&queue);
+        if (next->period != 0 && repeats < 2) {
+            // 주기 타이머: 꺼내고 다시 넣는 대신 루트 교체 (하향 이동 한 번)
+            Timer again = *next;
+            again.deadline += again.period;
+            ds_pqueue_replace_top(&queue, &again, &fired);
+            repeats++;
+        } else {
+            ds_pqueue_pop(&queue, &fired);
+        }
+        printf("@%4llums 작업 %u 실행\n", (unsigned long long)fired.deadline, fired.id);
+    }
+    ds_pqueue_destroy(&queue);
+    printf("\n");
+}
+
+static void bulk(size_t n) {
+    Timer *pending = malloc(n * sizeof(Timer));
+    if (pending == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < n; i++) {
+        pending[i] = (Timer){rng_next(&state) % 3600000, (uint32_t)i, 0};   // 1시간 이내
+    }
+
+    printf("=== 타이머 %zu개 ===\n", n);
+    DsPQueue queue;
+    ds_pqueue_init(&queue, sizeof(Timer), compare_timer, DS_HEAP_MIN);
+
+    double start = now_seconds();
+    for (size_t i = 0; i < n; i++) {
+        if (!ds_pqueue_push(&queue, &pending[i])) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            break;
+        }
+    }
+    printf("하나씩 push     : %8.1f ms (용량 %zu)\n", (now_seconds() - start) * 1e3,
+           ds_pqueue_capacity(&queue));
+
+    start = now_seconds();
+    if (!ds_pqueue_build(&queue, pending, n)) {
+        fprintf(stderr, "메모리 할당 실패\n");
+    }
+    printf("배열로부터 구성 : %8.1f ms\n", (now_seconds() - start) * 1e3);
+
+    start = now_seconds();
+    Timer prev = {0, 0, 0};
+    Timer fired;
+    size_t out_of_order = 0;
+    while (ds_pqueue_size(&queue) > n / 2) {
+        ds_pqueue_pop(&queue, &fired);
+        out_of_order += fired.deadline < prev.deadline;
+        prev = fired;
+    }
+    printf("절반 만료       : %8.1f ms (순서 오류 %zu)\n", (now_seconds() - start) * 1e3,
+           out_of_order);
+
+    size_t before = ds_pqueue_capacity(&queue);
+    ds_pqueue_shrink_to_fit(&queue);
+    printf("shrink_to_fit   : 용량 %zu → %zu (%.1f MB 반환)\n", before,
+           ds_pqueue_capacity(&queue),
+           (double)(before - ds_pqueue_capacity(&queue)) * sizeof(Timer) / 1e6);
+
+    ds_pqueue_destroy(&queue);
+    free(pending);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    demo();
+    bulk(n);
+    return 0;
+}
@@ -13,193 +13,12 @@
 #include <stdbool.h>
 #include <limits.h>
 
+#include "ds_index_heap.h"
+#include "ds_trace.h"
+
 #define MAX_VERTICES 100
 #define INF          INT_MAX
 
-// ============================================================
-// Min-Heap 자료구조 (우선순위 큐)
-// ============================================================
-
-typedef struct {
-    int vertex;   // 정점 번호
-    int distance; // 시작점부터의 거리 (key)
-} HeapNode;
-
-typedef struct {
-    HeapNode *data;     // 힙 데이터 배열
-    int *pos;           // 정점별 힙 내 위치 (decrease_key용)
-    int size;           // 현재 힙 크기
-    int capacity;       // 힙 최대 용량
-} MinHeap;
-
-/**
- * 힙 생성
- * @param capacity 힙 최대 용량
- * @return 생성된 힙 포인터
- */
-MinHeap *heap_create(int capacity) {
-    MinHeap *heap = (MinHeap *)malloc(sizeof(MinHeap));
-    heap->data = (HeapNode *)malloc(capacity * sizeof(HeapNode));
-    heap->pos = (int *)malloc(capacity * sizeof(int));
-
-    // pos 배열 초기화: -1은 "힙에 없음"을 의미
-    for (int i = 0; i < capacity; i++) {
-        heap->pos[i] = -1;
-    }
-
-    heap->size = 0;
-    heap->capacity = capacity;
-    return heap;
-}
-
-/**
- * 힙 메모리 해제
- * @param heap 해제할 힙 포인터
- */
-void heap_destroy(MinHeap *heap) {
-    if (heap) {
-        free(heap->data);
-        free(heap->pos);
-        free(heap);
-    }
-}
-
-/**
- * 두 힙 노드 교환 (위치 정보도 함께 갱신)
- */
-void heap_swap_nodes(MinHeap *heap, int i, int j) {
-    HeapNode temp = heap->data[i];
-    heap->data[i] = heap->data[j];
-    heap->data[j] = temp;
-
-    // 위치 정보 갱신
-    heap->pos[heap->data[i].vertex] = i;
-    heap->pos[heap->data[j].vertex] = j;
-}
-
-/**
- * 힙 속성 유지 (위로 버블업)
- * @param heap 힙 포인터
- * @param index 현재 노드 인덱스
- */
-void heap_sift_up(MinHeap *heap, int index) {
-    int parent = (index - 1) / 2;
-
-    while (index > 0 && heap->data[index].distance < heap->data[parent].distance) {
-        heap_swap_nodes(heap, index, parent);
-        index = parent;
-        parent = (index - 1) / 2;
-    }
-}
-
-/**
- * 힙 속성 유지 (아래로 버블다운)
- * @param heap 힙 포인터
- * @param index 현재 노드 인덱스
- */
-void heap_sift_down(MinHeap *heap, int index) {
-    int smallest = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
-
-    if (left < heap->size && heap->data[left].distance < heap->data[smallest].distance) {
-        smallest = left;
-    }
-    if (right < heap->size && heap->data[right].distance < heap->data[smallest].distance) {
-        smallest = right;
-    }
-
-    if (smallest != index) {
-        heap_swap_nodes(heap, index, smallest);
-        heap_sift_down(heap, smallest);
-    }
-}
-
-/**
- * 힙에 노드 삽입
- * @param heap 힙 포인터
- * @param vertex 정점 번호
- * @param distance 시작점부터의 거리
- * @return 성공 시 true, 실패 시 false
- */
-bool heap_push(MinHeap *heap, int vertex, int distance) {
-    if (heap->size >= heap->capacity) {
-        return false;
-    }
-
-    heap->data[heap->size].vertex = vertex;
-    heap->data[heap->size].distance = distance;
-    heap->pos[vertex] = heap->size;
-    heap->size++;
-
-    heap_sift_up(heap, heap->size - 1);
-    return true;
-}
-
-/**
- * 힙에서 최소값 추출
- * @param heap 힙 포인터
- * @param vertex 추출된 정점 번호를 저장할 포인터
- * @param distance 추출된 거리를 저장할 포인터
- * @return 성공 시 true, 빈 힙이면 false
- */
-bool heap_pop(MinHeap *heap, int *vertex, int *distance) {
-    if (heap->size == 0) {
-        return false;
-    }
-
-    *vertex = heap->data[0].vertex;
-    *distance = heap->data[0].distance;
-
-    // 마지막 노드를 루트로 이동
-    heap->data[0] = heap->data[heap->size - 1];
-    heap->pos[heap->data[0].vertex] = 0;
-    heap->size--;
-
-    heap_sift_down(heap, 0);
-    return true;
-}
-
-/**
- * 힙 내 특정 정점의 거리 감소 (다익스트라 핵심 연산)
- * @param heap 힙 포인터
- * @param vertex 대상 정점
- * @param new_distance 새로운 (더 작은) 거리
- * @return 성공 시 true, 정점이 힙에 없으면 false
- */
-bool heap_decrease_key(MinHeap *heap, int vertex, int new_distance) {
-    int index = heap->pos[vertex];
-
-    // 정점이 힙에 없는 경우 (이미 추출됨)
-    if (index >= heap->size) {
-        return false;
-    }
-
-    heap->data[index].distance = new_distance;
-    heap_sift_up(heap, index);
-    return true;
-}
-
-/**
- * 힙이 비어있는지 확인
- * @param heap 힙 포인터
- * @return 비어있으면 true
- */
-bool heap_is_empty(const MinHeap *heap) {
-    return heap->size == 0;
-}
-
-/**
- * 정점이 힙에 있는지 확인
- * @param heap 힙 포인터
- * @param vertex 확인할 정점
- * @return 힙에 있으면 true
- */
-bool heap_contains(const MinHeap *heap, int vertex) {
-    int position = heap->pos[vertex];
-    return position >= 0 && position < heap->size;
-}
-
 // ============================================================
 // 그래프 자료구조 (인접 리스트)
 // ============================================================
@@ -336,18 +155,25 @@ void dijkstra_shortest_path(const Graph *graph, int start) {
     }
     parent[start] = start;
 
-    // 최소 힙 생성
-    MinHeap *heap = heap_create(num_vertices);
+    // 색인 최소 힙 생성 (libds/ds_index_heap.h: 정점별 힙 위치 표로 decrease-key)
+    DsIndexHeap heap;
+    if (!ds_index_heap_init(&heap, (size_t)num_vertices)) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(visited);
+        free(distance);
+        free(parent);
+        return;
+    }
 
     // 시작 정점을 힙에 추가 (거리 0)
-    heap_push(heap, start, 0);
+    ds_index_heap_push(&heap, start, 0);
 
-    printf("다익스트라 최단 경로 알고리즘\n");
-    printf("정점 수: %d, 시작 정점: %d\n\n", num_vertices, start);
+    DS_TRACE("다익스트라 최단 경로 알고리즘\n");
+    DS_TRACE("정점 수: %d, 시작 정점: %d\n\n", num_vertices, start);
 
-    while (!heap_is_empty(heap)) {
+    while (!ds_index_heap_is_empty(&heap)) {
         int current_vertex, current_distance;
-        heap_pop(heap, &current_vertex, &current_distance);
+        ds_index_heap_pop(&heap, &current_vertex, &current_distance);
 
         // 이미 방문한 정점이면 스킵
         if (visited[current_vertex]) {
@@ -355,7 +181,7 @@ void dijkstra_shortest_path(const Graph *graph, int start) {
         }
         visited[current_vertex] = true;
 
-        printf("정점 %d 확정 (거리: %d)\n", current_vertex, current_distance);
+        DS_TRACE("정점 %d 확정 (거리: %d)\n", current_vertex, current_distance);
 
         // 현재 정점의 모든 인접 정점 확인
         AdjNode *neighbor = graph->array[current_vertex].head;
@@ -373,15 +199,12 @@ void dijkstra_shortest_path(const Graph *graph, int start) {
                     distance[adjacent_vertex] = new_distance;
                     parent[adjacent_vertex] = current_vertex;
 
-                    if (heap_contains(heap, adjacent_vertex)) {
-                        heap_decrease_key(heap, adjacent_vertex, new_distance);
-                    } else {
-                        heap_push(heap, adjacent_vertex, new_distance);
-                    }
+                    // 힙에 있으면 O(log V) decrease-key, 없으면 삽입 (위치 조회 O(1))
+                    ds_index_heap_push_or_decrease(&heap, adjacent_vertex, new_distance);
 
-                    printf("  → %d 갱신: %d (경로: %d → %d)\n",
-                           adjacent_vertex, new_distance,
-                           current_vertex, adjacent_vertex);
+                    DS_TRACE("  → %d 갱신: %d (경로: %d → %d)\n",
+                             adjacent_vertex, new_distance,
+                             current_vertex, adjacent_vertex);
                 }
             }
             neighbor = neighbor->next;
@@ -403,7 +226,7 @@ void dijkstra_shortest_path(const Graph *graph, int start) {
     free(visited);
     free(distance);
     free(parent);
-    heap_destroy(heap);
+    ds_index_heap_destroy(&heap);
 }
 
 // ============================================================
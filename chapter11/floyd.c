@@ -13,6 +13,8 @@
 #include <limits.h>
 #include <stdbool.h>
 
+#include "ds_trace.h"
+
 #define MAX_VERTICES 100
 #define INF          INT_MAX
 
@@ -106,8 +108,8 @@ void graph_add_undirected_edge(Graph *graph, int vertex1, int vertex2, int weigh
 bool floyd_warshall(Graph *graph) {
     int num_vertices = graph->num_vertices;
 
-    printf("플로이드-워셜 알고리즘 실행\n");
-    printf("정점 수: %d\n\n", num_vertices);
+    DS_TRACE("플로이드-워셜 알고리즘 실행\n");
+    DS_TRACE("정점 수: %d\n\n", num_vertices);
 
     // k: 경유 정점
     for (int k = 0; k < num_vertices; k++) {
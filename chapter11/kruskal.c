@@ -9,6 +9,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "ds_trace.h"
+
 #define MAX_VERTICES 100
 #define MAX_EDGES    (2 * MAX_VERTICES)
 
@@ -162,8 +164,8 @@ void kruskal_mst(const Graph *g) {
     // 2단계: 간선을 가중치 오름차순 정렬
     qsort((void *)g->edges, g->num_edges, sizeof(Edge), compare_edges);
 
-    printf("Kruskal MST 알고리즘\n");
-    printf("정점 수: %d, 간선 수: %d\n\n", g->num_vertices, g->num_edges);
+    DS_TRACE("Kruskal MST 알고리즘\n");
+    DS_TRACE("정점 수: %d, 간선 수: %d\n\n", g->num_vertices, g->num_edges);
 
     // 3단계: 가중치가 작은 간선부터 순회하며 MST 구성
     for (int i = 0; i < g->num_edges && edges_in_mst < g->num_vertices - 1; i++) {
@@ -173,7 +175,7 @@ void kruskal_mst(const Graph *g) {
 
         if (root_u != root_v) {
             // 두 정점이 다른 집합에 속하면 사이클이 생기지 않음
-            printf("  간선 선택: (%d, %d) 가중치: %d\n", e.from, e.to, e.weight);
+            DS_TRACE("  간선 선택: (%d, %d) 가중치: %d\n", e.from, e.to, e.weight);
             dsu_union(&dsu, e.from, e.to);
             total_weight += e.weight;
             edges_in_mst++;
@@ -13,193 +13,12 @@
 #include <stdbool.h>
 #include <limits.h>
 
+#include "ds_index_heap.h"
+#include "ds_trace.h"
+
 #define MAX_VERTICES 100
 #define INF          INT_MAX
 
-// ============================================================
-// Min-Heap 자료구조 (우선순위 큐)
-// ============================================================
-
-typedef struct {
-    int vertex;   // 정점 번호
-    int weight;   // MST에서의 연결 비용 (key)
-} HeapNode;
-
-typedef struct {
-    HeapNode *data;     // 힙 데이터 배열
-    int *pos;           // 정점별 힙 내 위치 (decrease_key용)
-    int size;           // 현재 힙 크기
-    int capacity;       // 힙 최대 용량
-} MinHeap;
-
-/**
- * 힙 생성
- * @param capacity 힙 최대 용량
- * @return 생성된 힙 포인터
- */
-MinHeap *heap_create(int capacity) {
-    MinHeap *h = (MinHeap *)malloc(sizeof(MinHeap));
-    h->data = (HeapNode *)malloc(capacity * sizeof(HeapNode));
-    h->pos = (int *)malloc(capacity * sizeof(int));
-
-    // pos 배열 초기화: -1은 "힙에 없음"을 의미
-    for (int i = 0; i < capacity; i++) {
-        h->pos[i] = -1;
-    }
-
-    h->size = 0;
-    h->capacity = capacity;
-    return h;
-}
-
-/**
- * 힙 메모리 해제
- * @param h 해제할 힙 포인터
- */
-void heap_destroy(MinHeap *h) {
-    if (h) {
-        free(h->data);
-        free(h->pos);
-        free(h);
-    }
-}
-
-/**
- * 두 힙 노드 교환 (위치 정보도 함께 갱신)
- */
-void heap_swap_nodes(MinHeap *h, int i, int j) {
-    HeapNode temp = h->data[i];
-    h->data[i] = h->data[j];
-    h->data[j] = temp;
-
-    // 위치 정보 갱신
-    h->pos[h->data[i].vertex] = i;
-    h->pos[h->data[j].vertex] = j;
-}
-
-/**
- * 힙 속성 유지 (위로 버블업)
- * @param h  힙 포인터
- * @param idx 현재 노드 인덱스
- */
-void heap_sift_up(MinHeap *h, int idx) {
-    int parent = (idx - 1) / 2;
-
-    while (idx > 0 && h->data[idx].weight < h->data[parent].weight) {
-        heap_swap_nodes(h, idx, parent);
-        idx = parent;
-        parent = (idx - 1) / 2;
-    }
-}
-
-/**
- * 힙 속성 유지 (아래로 버블다운)
- * @param h  힙 포인터
- * @param idx 현재 노드 인덱스
- */
-void heap_sift_down(MinHeap *h, int idx) {
-    int smallest = idx;
-    int left = 2 * idx + 1;
-    int right = 2 * idx + 2;
-
-    if (left < h->size && h->data[left].weight < h->data[smallest].weight) {
-        smallest = left;
-    }
-    if (right < h->size && h->data[right].weight < h->data[smallest].weight) {
-        smallest = right;
-    }
-
-    if (smallest != idx) {
-        heap_swap_nodes(h, idx, smallest);
-        heap_sift_down(h, smallest);
-    }
-}
-
-/**
- * 힙에 노드 삽입
- * @param h      힙 포인터
- * @param vertex 정점 번호
- * @param weight 가중치 (key 값)
- * @return       성공 시 true, 실패 시 false
- */
-bool heap_push(MinHeap *h, int vertex, int weight) {
-    if (h->size >= h->capacity) {
-        return false;
-    }
-
-    h->data[h->size].vertex = vertex;
-    h->data[h->size].weight = weight;
-    h->pos[vertex] = h->size;
-    h->size++;
-
-    heap_sift_up(h, h->size - 1);
-    return true;
-}
-
-/**
- * 힙에서 최소값 추출
- * @param h  힙 포인터
- * @param vertex 추출된 정점 번호를 저장할 포인터
- * @param weight 추출된 가중치를 저장할 포인터
- * @return       성공 시 true, 빈 힙이면 false
- */
-bool heap_pop(MinHeap *h, int *vertex, int *weight) {
-    if (h->size == 0) {
-        return false;
-    }
-
-    *vertex = h->data[0].vertex;
-    *weight = h->data[0].weight;
-
-    // 마지막 노드를 루트로 이동
-    h->data[0] = h->data[h->size - 1];
-    h->pos[h->data[0].vertex] = 0;
-    h->size--;
-
-    heap_sift_down(h, 0);
-    return true;
-}
-
-/**
- * 힙 내 특정 정점의 가중치 감소 (Prim 핵심 연산)
- * @param h         힙 포인터
- * @param vertex    대상 정점
- * @param new_weight 새로운 (더 작은) 가중치
- * @return          성공 시 true, 정점이 힙에 없으면 false
- */
-bool heap_decrease_key(MinHeap *h, int vertex, int new_weight) {
-    int idx = h->pos[vertex];
-
-    // 정점이 힙에 없는 경우 (이미 추출됨)
-    if (idx >= h->size) {
-        return false;
-    }
-
-    h->data[idx].weight = new_weight;
-    heap_sift_up(h, idx);
-    return true;
-}
-
-/**
- * 힙이 비어있는지 확인
- * @param  h 힙 포인터
- * @return   비어있으면 true
- */
-bool heap_is_empty(const MinHeap *h) {
-    return h->size == 0;
-}
-
-/**
- * 정점이 힙에 있는지 확인
- * @param  h      힙 포인터
- * @param  vertex 확인할 정점
- * @return        힙에 있으면 true
- */
-bool heap_contains(const MinHeap *h, int vertex) {
-    int pos = h->pos[vertex];
-    return pos >= 0 && pos < h->size;
-}
-
 // ============================================================
 // 그래프 자료구조 (인접 리스트)
 // ============================================================
@@ -297,22 +116,28 @@ void prim_mst(const Graph *g, int start) {
         parent[i] = -1;  // -1은 루트 또는 미연결
     }
 
-    // 최소 힙 생성
-    MinHeap *h = heap_create(num_vertices);
+    // 색인 최소 힙 생성 (libds/ds_index_heap.h, dijkstra.c와 공유)
+    DsIndexHeap h;
+    if (!ds_index_heap_init(&h, (size_t)num_vertices)) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(visited);
+        free(parent);
+        return;
+    }
 
     // 시작 정점을 힙에 추가 (가중치 0)
-    heap_push(h, start, 0);
+    ds_index_heap_push(&h, start, 0);
     parent[start] = start;  // 자기 자신을 부모로 (루트 표시)
 
     int total_weight = 0;
     int edges_in_mst = 0;
 
-    printf("Prim MST 알고리즘\n");
-    printf("정점 수: %d, 시작 정점: %d\n\n", num_vertices, start);
+    DS_TRACE("Prim MST 알고리즘\n");
+    DS_TRACE("정점 수: %d, 시작 정점: %d\n\n", num_vertices, start);
 
-    while (!heap_is_empty(h) && edges_in_mst < num_vertices - 1) {
+    while (!ds_index_heap_is_empty(&h) && edges_in_mst < num_vertices - 1) {
         int u, weight;
-        heap_pop(h, &u, &weight);
+        ds_index_heap_pop(&h, &u, &weight);
 
         // 이미 방문한 정점이면 스킵
         if (visited[u]) {
@@ -322,8 +147,8 @@ void prim_mst(const Graph *g, int start) {
 
         // 루트가 아니면 간선 출력
         if (parent[u] != u) {
-            printf("  간선 선택: (%d, %d) 가중치: %d\n",
-                   parent[u], u, weight);
+            DS_TRACE("  간선 선택: (%d, %d) 가중치: %d\n",
+                     parent[u], u, weight);
             total_weight += weight;
             edges_in_mst++;
         }
@@ -334,17 +159,10 @@ void prim_mst(const Graph *g, int start) {
             int v = curr->to;
             int w = curr->weight;
 
-            // 방문하지 않은 인접 정점을 힙에 추가
-            if (!visited[v]) {
-                if (heap_contains(h, v)) {
-                    // 이미 힙에 있으면 더 작은 가중치로 갱신
-                    heap_decrease_key(h, v, w);
-                    parent[v] = u;
-                } else {
-                    // 힙에 없으면 새로 추가
-                    heap_push(h, v, w);
-                    parent[v] = u;
-                }
+            // 방문하지 않은 인접 정점: 힙에 없으면 추가, 있으면 더 가벼운 간선일 때만 갱신
+            // (무거운 간선으로 키를 덮어쓰면 힙 순서와 MST가 모두 깨짐)
+            if (!visited[v] && ds_index_heap_push_or_decrease(&h, v, w)) {
+                parent[v] = u;
             }
             curr = curr->next;
         }
@@ -357,7 +175,7 @@ void prim_mst(const Graph *g, int start) {
     // 메모리 정리
     free(visited);
     free(parent);
-    heap_destroy(h);
+    ds_index_heap_destroy(&h);
 }
 
 // ============================================================
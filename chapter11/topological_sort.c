@@ -12,6 +12,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "ds_trace.h"
+
 #define MAX_VERTICES 100
 
 // ============================================================
@@ -86,10 +88,12 @@ void topological_sort(Graph *g) {
     int result[MAX_VERTICES];
     int result_idx = 0;
 
-    printf("위상 정렬 시작\n");
-    printf("초기 진입 차수: ");
-    for(int i=0; i<g->num_vertices; i++) printf("[%d]:%d ", i, g->indegree[i]);
-    printf("\n\n");
+    if (DS_TRACE_ENABLED) {
+        printf("위상 정렬 시작\n");
+        printf("초기 진입 차수: ");
+        for(int i=0; i<g->num_vertices; i++) printf("[%d]:%d ", i, g->indegree[i]);
+        printf("\n\n");
+    }
 
     // 1. 진입 차수가 0인 모든 노드를 큐에 삽입
     for (int i = 0; i < g->num_vertices; i++) {
@@ -3,6 +3,8 @@
 #include <time.h>
 #include <stdbool.h>
 
+#include "ds_trace.h"
+
 #define MAX_SIZE 10
 
 // 랜덤 배열 생성
@@ -59,16 +61,18 @@ void bubble_sort(int arr[], size_t size) {
         pass_count++;
 
         // 과정 출력
-        if (swapped) {
-            printf("Pass %zu: %d이(가) 위치 %zu에 확정됨\n",
-                   pass_count, arr[size - 1 - i], size - 1 - i);
-        } else {
-            printf("Pass %zu: 교환 없음 → 이미 정렬됨 (조기 종료)\n", pass_count);
-        }
+        if (DS_TRACE_ENABLED) {
+            if (swapped) {
+                printf("Pass %zu: %d이(가) 위치 %zu에 확정됨\n",
+                       pass_count, arr[size - 1 - i], size - 1 - i);
+            } else {
+                printf("Pass %zu: 교환 없음 → 이미 정렬됨 (조기 종료)\n", pass_count);
+            }
 
-        printf("       ");
-        print_array_with_boundary(arr, size, size - 1 - i);
-        printf("\n");
+            printf("       ");
+            print_array_with_boundary(arr, size, size - 1 - i);
+            printf("\n");
+        }
 
         // Early termination: 교환이 없으면 이미 정렬된 것
         if (!swapped) {
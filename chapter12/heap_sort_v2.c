@@ -1,7 +1,16 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
+#include "ds_counters.h"
+#include "ds_sort.h"
+#include "ds_trace.h"
+
+#if !DS_COUNTERS_ENABLED
+#error "heap_sort_v2는 ds_counted(DS_COUNTERS_ENABLED=1)와 함께 빌드해야 합니다"
+#endif
+
 #define MAX_SIZE 10
 
 // 랜덤 배열 생성
@@ -70,11 +79,13 @@ void heap_sort(int arr[], size_t n) {
     // 최대 힙 생성
     build_max_heap(arr, n);
 
-    printf("=== 최대 힙 생성 ===\n");
-    print_array_simple(arr, n);
-    printf("\n\n");
+    if (DS_TRACE_ENABLED) {
+        printf("=== 최대 힙 생성 ===\n");
+        print_array_simple(arr, n);
+        printf("\n\n");
 
-    printf("=== 정렬 과정 ===\n");
+        printf("=== 정렬 과정 ===\n");
+    }
     // 원소를 하나씩 추출하며 정렬
     for (size_t i = n - 1; i > 0; i--) {
         // 루트(최댓값)와 마지막 원소 교환
@@ -82,18 +93,83 @@ void heap_sort(int arr[], size_t n) {
         arr[0] = arr[i];
         arr[i] = temp;
 
-        printf("%zu. [%d] 추출 → ", n - i, temp);
-        print_array_range(arr, 0, i - 1);
-        printf(" | ");
-        print_array_range(arr, i, n - 1);
-        printf("\n");
+        if (DS_TRACE_ENABLED) {
+            printf("%zu. [%d] 추출 → ", n - i, temp);
+            print_array_range(arr, 0, i - 1);
+            printf(" | ");
+            print_array_range(arr, i, n - 1);
+            printf("\n");
+        }
 
         // 줄어든 힙에 대해 heapify
         heapify(arr, i, 0);
     }
 }
 
-int main(void) {
+// ==================== 하향 이동 방식 비교 (heap_sort_v2 compare [n]) ====================
+// 비교 횟수는 libds 구현이 직접 센다 (ds_counted 링크, ds_counters.h)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int compare_heapify(size_t size) {
+    // 시간에는 비교 카운터 증가 비용이 함께 들어간다 (두 방식 모두 비교당 같은 비용)
+    static const struct {
+        const char *name;
+        void (*sort)(int arr[], size_t n);
+    } modes[] = {
+        {"하향식", ds_heap_sort_top_down},
+        {"상향식", ds_heap_sort},
+    };
+
+    int *original = malloc(size * sizeof(int));
+    int *arr = malloc(size * sizeof(int));
+    if (original == NULL || arr == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(original);
+        free(arr);
+        return 1;
+    }
+    srand(12345);   // 두 방식에 같은 입력
+    for (size_t i = 0; i < size; i++) {
+        original[i] = rand();
+    }
+
+    printf("=== 힙 정렬 하향 이동 방식 비교 (n = %zu, 무작위 입력) ===\n\n", size);
+    printf("방식          비교 횟수   원소당 비교     시간(ms)\n");   // 한글 2칸 폭 기준 정렬
+
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        memcpy(arr, original, size * sizeof(int));
+        ds_counters_reset();
+        double start = now_seconds();
+        modes[m].sort(arr, size);
+        double elapsed = now_seconds() - start;
+        unsigned long long comparisons = (unsigned long long)ds_counters.comparisons;
+
+        for (size_t i = 1; i < size; i++) {
+            if (arr[i - 1] > arr[i]) {
+                fprintf(stderr, "%s: 정렬 실패 (위치 %zu)\n", modes[m].name, i);
+                break;
+            }
+        }
+        printf("%-10s %16llu %12.2f %12.2f\n", modes[m].name, comparisons,
+               (double)comparisons / (double)size, elapsed * 1e3);
+    }
+
+    free(original);
+    free(arr);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "compare") == 0) {
+        size_t size = argc >= 3 ? (size_t)strtod(argv[2], NULL) : 10000000;
+        return compare_heapify(size);
+    }
+
     int arr[MAX_SIZE];
     const size_t size = MAX_SIZE;
 
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "ds_trace.h"
+
 #define MAX_SIZE 10
 
 // 랜덤 배열 생성
@@ -55,18 +57,20 @@ void insertion_sort(int arr[], size_t size) {
         arr[j] = key;
 
         // 과정 출력
-        if (j == i) {
-            // 이동 없이 제자리인 경우
-            printf("Pass %zu: %d은(는) 이미 올바른 위치\n", i, key);
-            printf("       ");
-            print_array_with_highlight(arr, size, i + 1, i);
-        } else {
-            // 삽입 발생
-            printf("Pass %zu: %d을(를) 인덱스 %zu에 삽입\n", i, key, j);
-            printf("       ");
-            print_array_with_highlight(arr, size, i + 1, j);
+        if (DS_TRACE_ENABLED) {
+            if (j == i) {
+                // 이동 없이 제자리인 경우
+                printf("Pass %zu: %d은(는) 이미 올바른 위치\n", i, key);
+                printf("       ");
+                print_array_with_highlight(arr, size, i + 1, i);
+            } else {
+                // 삽입 발생
+                printf("Pass %zu: %d을(를) 인덱스 %zu에 삽입\n", i, key, j);
+                printf("       ");
+                print_array_with_highlight(arr, size, i + 1, j);
+            }
+            printf("\n");
         }
-        printf("\n");
     }
 }
 
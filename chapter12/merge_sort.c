@@ -3,6 +3,8 @@
 #include <time.h>
 #include <string.h>
 
+#include "ds_trace.h"
+
 #define MAX_SIZE 8  // 병합 정렬은 재귀 깊이가 깊어서 크기를 줄임
 
 // 랜덤 배열 생성
@@ -57,11 +59,13 @@ static void merge(int arr[], size_t left, size_t mid, size_t right) {
     }
 
     // 병합 과정 출력
-    printf("  병합: ");
-    print_array_range(L, 0, n1 - 1);
-    printf(" + ");
-    print_array_range(R, 0, n2 - 1);
-    printf(" → ");
+    if (DS_TRACE_ENABLED) {
+        printf("  병합: ");
+        print_array_range(L, 0, n1 - 1);
+        printf(" + ");
+        print_array_range(R, 0, n2 - 1);
+        printf(" → ");
+    }
 
     // 두 배열을 병합
     size_t i = 0, j = 0, k = left;
@@ -88,8 +92,10 @@ static void merge(int arr[], size_t left, size_t mid, size_t right) {
         k++;
     }
 
-    print_array_range(arr, left, right);
-    printf("\n");
+    if (DS_TRACE_ENABLED) {
+        print_array_range(arr, left, right);
+        printf("\n");
+    }
 
     free(L);
     free(R);
@@ -99,22 +105,26 @@ static void merge(int arr[], size_t left, size_t mid, size_t right) {
 static void merge_sort_recursive(int arr[], size_t left, size_t right, int depth) {
     if (left >= right) {
         // 분할의 끝: 원소 1개
-        printf("%*s", depth * 2, "");
-        print_array_range(arr, left, right);
-        printf("\n");
+        if (DS_TRACE_ENABLED) {
+            printf("%*s", depth * 2, "");
+            print_array_range(arr, left, right);
+            printf("\n");
+        }
         return;
     }
 
     size_t mid = left + (right - left) / 2;
 
     // 분할 과정 출력
-    printf("%*s", depth * 2, "");
-    print_array_range(arr, left, right);
-    printf(" → 분할: ");
-    print_array_range(arr, left, mid);
-    printf(", ");
-    print_array_range(arr, mid + 1, right);
-    printf("\n");
+    if (DS_TRACE_ENABLED) {
+        printf("%*s", depth * 2, "");
+        print_array_range(arr, left, right);
+        printf(" → 분할: ");
+        print_array_range(arr, left, mid);
+        printf(", ");
+        print_array_range(arr, mid + 1, right);
+        printf("\n");
+    }
 
     // 왼쪽 정렬
     merge_sort_recursive(arr, left, mid, depth + 1);
@@ -128,9 +138,9 @@ static void merge_sort_recursive(int arr[], size_t left, size_t right, int depth
 
 // 병합 정렬 진입점
 void merge_sort(int arr[], size_t size) {
-    printf("=== 분할 과정 ===\n");
+    DS_TRACE("=== 분할 과정 ===\n");
     merge_sort_recursive(arr, 0, size - 1, 0);
-    printf("\n");
+    DS_TRACE("\n");
 }
 
 int main(void) {
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "ds_trace.h"
+
 #define MAX_SIZE 10
 
 // 랜덤 배열 생성
@@ -38,9 +40,11 @@ static size_t partition(int arr[], size_t low, size_t high) {
     int pivot = arr[high];  // 마지막 원소를 피벗으로 선택
     size_t i = low;         // 작은 값들의 마지막 위치
 
-    printf("  피벗=%d: ", pivot);
-    print_array_range(arr, low, high);
-    printf(" → ");
+    if (DS_TRACE_ENABLED) {
+        printf("  피벗=%d: ", pivot);
+        print_array_range(arr, low, high);
+        printf(" → ");
+    }
 
     for (size_t j = low; j < high; j++) {
         if (arr[j] <= pivot) {
@@ -59,18 +63,20 @@ static size_t partition(int arr[], size_t low, size_t high) {
 
     // 분할 결과 출력
     size_t pivot_pos = i;
-    if (pivot_pos > low) {
-        print_array_range(arr, low, pivot_pos - 1);
-    } else {
-        printf("[]");
-    }
-    printf(" [%d] ", arr[pivot_pos]);
-    if (pivot_pos < high) {
-        print_array_range(arr, pivot_pos + 1, high);
-    } else {
-        printf("[]");
+    if (DS_TRACE_ENABLED) {
+        if (pivot_pos > low) {
+            print_array_range(arr, low, pivot_pos - 1);
+        } else {
+            printf("[]");
+        }
+        printf(" [%d] ", arr[pivot_pos]);
+        if (pivot_pos < high) {
+            print_array_range(arr, pivot_pos + 1, high);
+        } else {
+            printf("[]");
+        }
+        printf("\n");
     }
-    printf("\n");
 
     return pivot_pos;
 }
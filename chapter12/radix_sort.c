@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "ds_trace.h"
+
 #define MAX_SIZE 10
 #define RADIX 10  // 10진수
 
@@ -69,9 +71,11 @@ static void counting_sort(int arr[], size_t n, int exp) {
     }
 
     // 현재 자릿수 정렬 결과 출력
-    printf("%d의 자리: ", exp);
-    print_array_simple(arr, n);
-    printf("\n");
+    if (DS_TRACE_ENABLED) {
+        printf("%d의 자리: ", exp);
+        print_array_simple(arr, n);
+        printf("\n");
+    }
 
     free(output);
     free(count);
@@ -82,7 +86,7 @@ void radix_sort(int arr[], size_t n) {
     // 최댓값 찾기
     int max = get_max(arr, n);
 
-    printf("최댓값: %d (", max);
+    DS_TRACE("최댓값: %d (", max);
 
     // 자릿수 계산
     int digits = 0;
@@ -91,9 +95,9 @@ void radix_sort(int arr[], size_t n) {
         temp /= 10;
         digits++;
     }
-    printf("%d자리)\n\n", digits);
+    DS_TRACE("%d자리)\n\n", digits);
 
-    printf("=== 자릿수별 정렬 ===\n");
+    DS_TRACE("=== 자릿수별 정렬 ===\n");
 
     // 각 자릿수에 대해 계수 정렬 수행
     // 1의 자리 → 10의 자리 → 100의 자리 → ...
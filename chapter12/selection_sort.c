@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "ds_trace.h"
+
 #define MAX_SIZE 10
 
 // 랜덤 배열 생성
@@ -57,17 +59,19 @@ void selection_sort(int arr[], size_t size) {
             arr[i] = arr[min_idx];
             arr[min_idx] = temp;
 
-            printf("Pass %zu: %d을(를) 인덱스 %zu로 이동\n",
-                   i + 1, arr[i], i);
+            DS_TRACE("Pass %zu: %d을(를) 인덱스 %zu로 이동\n",
+                     i + 1, arr[i], i);
         } else {
-            printf("Pass %zu: %d은(는) 이미 올바른 위치\n",
-                   i + 1, arr[i]);
+            DS_TRACE("Pass %zu: %d은(는) 이미 올바른 위치\n",
+                     i + 1, arr[i]);
         }
 
         // 현재 상태 출력 (정렬된 영역 표시)
-        printf("       ");
-        print_array(arr, size, i + 1, size);  // highlight 없음
-        printf("\n");
+        if (DS_TRACE_ENABLED) {
+            printf("       ");
+            print_array(arr, size, i + 1, size);  // highlight 없음
+            printf("\n");
+        }
     }
 }
 
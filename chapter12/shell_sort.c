@@ -1,7 +1,13 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
+#include "ds_trace.h"
+#include "ds_sort.h"
+
 #define MAX_SIZE 10
 
 // 랜덤 배열 생성
@@ -50,17 +56,120 @@ void shell_sort(int arr[], size_t size) {
         }
 
         // 과정 출력
-        printf("Gap = %zu: ", gap);
-        print_array_simple(arr, size);
+        if (DS_TRACE_ENABLED) {
+            printf("Gap = %zu: ", gap);
+            print_array_simple(arr, size);
+        }
 
         // gap 축소
         gap /= 3;
     }
 
-    printf("\n총 %zu단계 거침\n", step);
+    DS_TRACE("\n총 %zu단계 거침\n", step);
+}
+
+// ==================== 간격 수열 비교 (shell_sort compare [n]) ====================
+
+typedef struct {
+    unsigned long long comparisons;
+    unsigned long long moves;   // 원소 대입 횟수 (temp 저장/복원 포함)
+} ShellCounts;
+
+// 주어진 간격 목록으로 정렬하며 비교/이동 횟수를 센다
+static void shell_sort_counted(int arr[], size_t size, const size_t gaps[], size_t num_gaps,
+                               ShellCounts *counts) {
+    for (size_t k = 0; k < num_gaps; k++) {
+        size_t gap = gaps[k];
+        for (size_t i = gap; i < size; i++) {
+            int temp = arr[i];
+            size_t j = i;
+            counts->moves++;
+            while (j >= gap) {
+                counts->comparisons++;
+                if (arr[j - gap] <= temp) {
+                    break;
+                }
+                arr[j] = arr[j - gap];
+                counts->moves++;
+                j -= gap;
+            }
+            if (j != i) {
+                arr[j] = temp;
+                counts->moves++;
+            }
+        }
+    }
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
 }
 
-int main(void) {
+static int compare_gap_sequences(size_t size) {
+    static const struct {
+        DsShellGaps seq;
+        const char *name;
+    } sequences[] = {
+        {DS_SHELL_GAPS_KNUTH, "Knuth"},
+        {DS_SHELL_GAPS_CIURA, "Ciura"},
+        {DS_SHELL_GAPS_TOKUDA, "Tokuda"},
+        {DS_SHELL_GAPS_SEDGEWICK, "Sedgewick"},
+        {DS_SHELL_GAPS_PRATT, "Pratt"},
+    };
+
+    int *original = malloc(size * sizeof(int));
+    int *arr = malloc(size * sizeof(int));
+    if (original == NULL || arr == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(original);
+        free(arr);
+        return 1;
+    }
+    srand(12345);   // 모든 수열에 같은 입력
+    for (size_t i = 0; i < size; i++) {
+        original[i] = rand();
+    }
+
+    printf("=== 쉘 정렬 간격 수열 비교 (n = %zu, 무작위 입력) ===\n\n", size);
+    printf("수열       간격수        비교 횟수        이동 횟수     시간(ms)\n");   // 한글 2칸 폭 기준 정렬
+
+    for (size_t s = 0; s < sizeof(sequences) / sizeof(sequences[0]); s++) {
+        size_t num_gaps = ds_shell_gaps(sequences[s].seq, size, NULL, 0);
+        size_t *gaps = malloc((num_gaps + 1) * sizeof(size_t));
+        if (gaps == NULL) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            break;
+        }
+        ds_shell_gaps(sequences[s].seq, size, gaps, num_gaps);
+
+        ShellCounts counts = {0, 0};
+        memcpy(arr, original, size * sizeof(int));
+        shell_sort_counted(arr, size, gaps, num_gaps, &counts);
+
+        // 시간은 계수 없는 libds 구현으로 측정 (작은 간격 단계는 SIMD)
+        memcpy(arr, original, size * sizeof(int));
+        double start = now_seconds();
+        ds_shell_sort_gaps(arr, size, sequences[s].seq);
+        double elapsed = now_seconds() - start;
+
+        printf("%-10s %6zu %16llu %16llu %12.2f\n", sequences[s].name, num_gaps,
+               counts.comparisons, counts.moves, elapsed * 1e3);
+        free(gaps);
+    }
+
+    free(original);
+    free(arr);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "compare") == 0) {
+        size_t size = argc >= 3 ? (size_t)strtod(argv[2], NULL) : 1000000;
+        return compare_gap_sequences(size);
+    }
+
     int arr[MAX_SIZE];
     const size_t size = MAX_SIZE;
 
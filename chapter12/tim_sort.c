@@ -0,0 +1,155 @@
+/**
+ * Chapter 12: 팀 정렬 (TimSort) - 자연 런을 이용하는 적응형 병합 정렬
+ *
+ * merge_sort.c는 입력이 이미 정렬되어 있어도 똑같이 반씩 나누고 병합한다.
+ * 시계열 데이터처럼 대부분 시간 순서로 들어오고 일부만 늦게 도착하는 입력에는
+ * 이미 정렬된 구간(런)이 길게 있으므로, 런을 찾아 그대로 병합하면 훨씬 빠르다.
+ *
+ *   입력:  [1 2 3 4 5 | 9 8 7 | 6 10 11 12]
+ *           오름차순 런   내림차순 런(뒤집음)   오름차순 런
+ *   → 런 스택에 쌓으며 길이가 비슷한 런끼리 병합 (libds의 ds_timsort 사용)
+ *
+ * 사용법:
+ *   tim_sort         안정성 예제 + 입력 모양별 런 통계
+ *   tim_sort [n]     런 통계 표의 원소 수 (기본 1000000)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ds_sort.h"
+#include "ds_timsort.h"
+
+// 센서 측정값: 시각이 같으면 도착 순서(seq)가 유지되어야 한다
+typedef struct {
+    int timestamp;
+    int seq;
+} Reading;
+
+#define READING_LESS(a, b) ((a).timestamp < (b).timestamp)
+
+DS_DEFINE_TIM_SORT(reading, Reading, READING_LESS)
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// xorshift64* 난수 (시드 고정으로 재현 가능한 입력)
+static uint64_t rng_next(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+static void demo_stability(void) {
+    Reading readings[] = {
+        {10, 0}, {11, 1}, {13, 2}, {12, 3}, {11, 4}, {14, 5}, {13, 6}, {15, 7},
+    };
+    size_t n = sizeof(readings) / sizeof(readings[0]);
+
+    printf("=== 안정성: (시각, 도착 순서) ===\n");
+    printf("도착 순서: ");
+    for (size_t i = 0; i < n; i++) {
+        printf("(%d,%d) ", readings[i].timestamp, readings[i].seq);
+    }
+    reading_tim_sort(readings, n, NULL);
+    printf("\n시각 순서: ");
+    for (size_t i = 0; i < n; i++) {
+        printf("(%d,%d) ", readings[i].timestamp, readings[i].seq);
+    }
+    printf("\n같은 시각(11, 13)은 도착 순서가 그대로 유지된다.\n\n");
+}
+
+typedef enum { SHAPE_RANDOM, SHAPE_SORTED, SHAPE_REVERSED, SHAPE_LATE, SHAPE_BATCHES } Shape;
+
+static const char *const shape_names[] = {
+    "random", "sorted", "reversed", "late-1%", "batches-16",
+};
+
+static void fill(int arr[], size_t n, Shape shape, uint64_t *state) {
+    for (size_t i = 0; i < n; i++) {
+        switch (shape) {
+        case SHAPE_RANDOM:
+            arr[i] = (int)(rng_next(state) % 1000000000u);
+            break;
+        case SHAPE_REVERSED:
+            arr[i] = (int)(n - i);
+            break;
+        case SHAPE_BATCHES:
+            arr[i] = (int)(i % (n / 16 + 1) * 16 + i / (n / 16 + 1));   // 정렬된 묶음 16개
+            break;
+        default:
+            arr[i] = (int)i;
+            break;
+        }
+    }
+    if (shape == SHAPE_LATE) {
+        // 1%는 늦게 도착: 최대 1000칸 뒤로 밀린 자리에 들어감
+        for (size_t k = 0; k < n / 100; k++) {
+            size_t i = rng_next(state) % n;
+            size_t j = i + rng_next(state) % 1000;
+            if (j < n) {
+                int t = arr[i];
+                arr[i] = arr[j];
+                arr[j] = t;
+            }
+        }
+    }
+}
+
+static void print_run_statistics(size_t n) {
+    int *arr = malloc(n * sizeof(int));
+    int *copy = malloc(n * sizeof(int));
+    if (arr == NULL || copy == NULL) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(arr);
+        free(copy);
+        return;
+    }
+    printf("=== 입력 모양별 런 통계 (n = %zu, minrun은 n에 따라 32~64) ===\n", n);
+    printf("입력               런   역순런    최장런    병합   갤러핑  임시버퍼    팀(ms)  병합(ms)\n");   // 한글 2칸 폭 기준 정렬
+
+    uint64_t state = 88172645463325252ull;
+    for (Shape shape = SHAPE_RANDOM; shape <= SHAPE_BATCHES; shape++) {
+        fill(arr, n, shape, &state);
+        for (size_t i = 0; i < n; i++) {
+            copy[i] = arr[i];
+        }
+        DsTimSortStats stats;
+        double start = now_seconds();
+        ds_tim_sort(arr, n, &stats);
+        double tim_ms = (now_seconds() - start) * 1e3;
+        start = now_seconds();
+        ds_merge_sort(copy, n);
+        double merge_ms = (now_seconds() - start) * 1e3;
+
+        for (size_t i = 1; i < n; i++) {
+            if (arr[i - 1] > arr[i]) {
+                printf("정렬 실패: %s\n", shape_names[shape]);
+                break;
+            }
+        }
+        printf("%-12s %8zu %8zu %9zu %7zu %8zu %9zu %9.1f %9.1f\n", shape_names[shape],
+               stats.runs, stats.descending_runs, stats.longest_run, stats.merges,
+               stats.gallops, stats.temp_peak, tim_ms, merge_ms);
+    }
+    free(arr);
+    free(copy);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+    if (n < 16) {
+        n = 16;
+    }
+    demo_stability();
+    print_run_statistics(n);
+    return 0;
+}
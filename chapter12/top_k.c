@@ -0,0 +1,150 @@
+/**
+ * Chapter 12: 선택 (Selection) - k번째 원소, 부분 정렬, 상위 k개
+ *
+ * 상위 100개만 필요한데 1억 개를 전부 정렬하면 O(n log n)을 낭비한다.
+ * quick_sort.c의 분할을 한 번 하면 피벗의 최종 위치가 정해지므로,
+ * k가 들어 있는 쪽만 계속 나누면 평균 O(n)에 k번째 값을 찾는다 (quickselect).
+ *
+ *   [5 9 1 7 3 8 2]  k = 2 (0-based, 세 번째로 작은 값)
+ *   분할(피벗 5) → [3 2 1] 5 [8 9 7]   피벗 위치 3 > k → 왼쪽만 계속
+ *   분할(피벗 2) → [1] 2 [3]           피벗 위치 1 < k → 오른쪽만 계속 → 3
+ *
+ * libds 사용:
+ * - ds_nth_element : introselect (치우치면 median-of-medians 피벗) 최악 O(n)
+ * - ds_partial_sort: 가장 작은 k개만 정렬 O(n + k log k)
+ * - DsTopK         : heap.c의 힙을 크기 k로 유지, 스트림에서 가장 큰 k개 O(n log k)
+ *
+ * 사용법:
+ *   top_k            예제 + 상위 100개 시간 비교 (n = 10000000)
+ *   top_k [n] [k]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "ds_heap.h"
+#include "ds_sort.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// xorshift64* 난수 (시드 고정으로 재현 가능한 입력)
+static uint64_t rng_next(uint64_t *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+static void print_array(const char *label, const int arr[], size_t n) {
+    printf("%s", label);
+    for (size_t i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+static void demo(void) {
+    const int scores[] = {72, 95, 41, 88, 67, 99, 53, 80, 91, 60, 77, 85};
+    size_t n = sizeof(scores) / sizeof(scores[0]);
+    int arr[sizeof(scores) / sizeof(scores[0])];
+
+    printf("=== 선택 예제 (n = %zu) ===\n", n);
+    print_array("원본        : ", scores, n);
+
+    memcpy(arr, scores, sizeof(scores));
+    ds_nth_element(arr, n, n / 2);
+    printf("중앙값 (k = %zu): %d\n", n / 2, arr[n / 2]);
+    print_array("  분할 결과 : ", arr, n);
+
+    memcpy(arr, scores, sizeof(scores));
+    ds_partial_sort(arr, n, 3);
+    print_array("하위 3개    : ", arr, 3);
+
+    // 점수가 하나씩 들어오는 스트림에서 상위 3개 유지
+    DsTopK top;
+    if (!ds_topk_init(&top, 3)) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return;
+    }
+    printf("상위 3개 (스트림):\n");
+    for (size_t i = 0; i < n; i++) {
+        ds_topk_push(&top, scores[i]);
+        int threshold;
+        if (ds_topk_threshold(&top, &threshold)) {
+            printf("  %2d 입력 후 기준값 %d\n", scores[i], threshold);
+        }
+    }
+    int best[3];
+    size_t count = ds_topk_result(&top, best);
+    print_array("  결과      : ", best, count);
+    ds_topk_destroy(&top);
+    printf("\n");
+}
+
+static void compare_methods(size_t n, size_t k) {
+    int *src = malloc(n * sizeof(int));
+    int *arr = malloc(n * sizeof(int));
+    int *out = malloc(k * sizeof(int));
+    DsTopK top;
+    if (src == NULL || arr == NULL || out == NULL || !ds_topk_init(&top, k)) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        free(src);
+        free(arr);
+        free(out);
+        return;
+    }
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < n; i++) {
+        src[i] = (int)(rng_next(&state) % 1000000000u);
+    }
+
+    printf("=== 가장 큰 %zu개 구하기 (n = %zu) ===\n", k, n);
+    printf("  시간(ms)  k번째 큰 값  방법\n");   // 한글 2칸 폭 기준 정렬
+
+    memcpy(arr, src, n * sizeof(int));
+    double start = now_seconds();
+    ds_intro_sort(arr, n);
+    double ms = (now_seconds() - start) * 1e3;
+    printf("%10.1f %12d  %s\n", ms, arr[n - k], "전체 정렬 (ds_intro_sort)");
+
+    memcpy(arr, src, n * sizeof(int));
+    start = now_seconds();
+    ds_nth_element(arr, n, n - k);
+    ds_intro_sort(arr + n - k, k);
+    ms = (now_seconds() - start) * 1e3;
+    printf("%10.1f %12d  %s\n", ms, arr[n - k], "선택 + k개 정렬 (ds_nth_element)");
+
+    start = now_seconds();
+    ds_topk_push_many(&top, src, n);
+    size_t count = ds_topk_result(&top, out);
+    ms = (now_seconds() - start) * 1e3;
+    printf("%10.1f %12d  %s\n", ms, out[count - 1], "힙 스트림 (DsTopK)");
+
+    ds_topk_destroy(&top);
+    free(src);
+    free(arr);
+    free(out);
+}
+
+int main(int argc, char *argv[]) {
+    size_t n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    size_t k = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 100;
+    if (k == 0) {
+        k = 1;
+    }
+    if (n < k) {
+        n = k;
+    }
+    demo();
+    compare_methods(n, k);
+    return 0;
+}
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "ds_trace.h"
+
 #define ARRAY_SIZE 16
 
 // ============================================================
@@ -63,30 +65,38 @@ int binary_search(const int arr[], size_t size, int target) {
     size_t low = 0;
     size_t high = size - 1;
 
-    printf("\n  이진 탐색 시작: target = %d\n", target);
-    printf("  초기 배열: ");
-    print_array(arr, size);
-    printf("\n\n");
+    if (DS_TRACE_ENABLED) {
+        printf("\n  이진 탐색 시작: target = %d\n", target);
+        printf("  초기 배열: ");
+        print_array(arr, size);
+        printf("\n\n");
+    }
 
     while (low <= high) {
         // 오버플로우 방지: (low + high) / 2 대신 low + (high - low) / 2 사용
         size_t mid = low + (high - low) / 2;
 
         if (arr[mid] == target) {
-            print_search_state(arr, size, low, high, mid, target, "발견!");
+            if (DS_TRACE_ENABLED) {
+                print_search_state(arr, size, low, high, mid, target, "발견!");
+            }
             return (int)mid;
         }
 
         if (arr[mid] < target) {
-            print_search_state(arr, size, low, high, mid, target, "오른쪽 탐색");
+            if (DS_TRACE_ENABLED) {
+                print_search_state(arr, size, low, high, mid, target, "오른쪽 탐색");
+            }
             low = mid + 1;  // 오른쪽 절반 탐색
         } else {
-            print_search_state(arr, size, low, high, mid, target, "왼쪽 탐색");
+            if (DS_TRACE_ENABLED) {
+                print_search_state(arr, size, low, high, mid, target, "왼쪽 탐색");
+            }
             high = mid - 1;  // 왼쪽 절반 탐색
         }
     }
 
-    printf("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
+    DS_TRACE("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
     return -1;
 }
 
@@ -106,7 +116,7 @@ static int binary_search_recursive_impl(const int arr[], int target,
     size_t mid = low + (high - low) / 2;
 
     if (arr[mid] == target) {
-        if (verbose) {
+        if (DS_TRACE_ENABLED && verbose) {
             printf("     재귀: 범위 [%zu, %zu], mid=%zu, arr[mid]=%d == target → 발견!\n",
                    low, high, mid, arr[mid]);
         }
@@ -114,13 +124,13 @@ static int binary_search_recursive_impl(const int arr[], int target,
     }
 
     if (arr[mid] < target) {
-        if (verbose) {
+        if (DS_TRACE_ENABLED && verbose) {
             printf("     재귀: 범위 [%zu, %zu], mid=%zu, arr[mid]=%d < target → 오른쪽\n",
                    low, high, mid, arr[mid]);
         }
         return binary_search_recursive_impl(arr, target, mid + 1, high, verbose);
     } else {
-        if (verbose) {
+        if (DS_TRACE_ENABLED && verbose) {
             printf("     재귀: 범위 [%zu, %zu], mid=%zu, arr[mid]=%d > target → 왼쪽\n",
                    low, high, mid, arr[mid]);
         }
@@ -130,10 +140,10 @@ static int binary_search_recursive_impl(const int arr[], int target,
 
 // 재귀 버전 래퍼 함수
 int binary_search_recursive(const int arr[], size_t size, int target) {
-    printf("\n  재귀 버전 탐색 시작: target = %d\n", target);
+    DS_TRACE("\n  재귀 버전 탐색 시작: target = %d\n", target);
     int result = binary_search_recursive_impl(arr, target, 0, size - 1, true);
     if (result == -1) {
-        printf("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
+        DS_TRACE("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
     }
     return result;
 }
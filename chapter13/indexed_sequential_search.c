@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "ds_trace.h"
+
 #define DATA_SIZE 50      // 전체 데이터 크기
 #define INDEX_SIZE 5      // 색인 테이블 크기
 #define BLOCK_SIZE 10     // 각 블록(구간)의 크기 (= DATA_SIZE / INDEX_SIZE)
@@ -107,8 +109,8 @@ static void create_index_table(const int data[], size_t data_size,
 int indexed_sequential_search(const int data[], size_t data_size,
                                const IndexEntry index_table[], size_t index_size,
                                int target) {
-    printf("\n  탐색 시작: target = %d\n", target);
-    printf("  ──────────────────────────────────────\n");
+    DS_TRACE("\n  탐색 시작: target = %d\n", target);
+    DS_TRACE("  ──────────────────────────────────────\n");
 
     // --------------------------------------------------------
     // 1단계: 색인 테이블 탐색 (target이 속할 구간 찾기)
@@ -117,22 +119,22 @@ int indexed_sequential_search(const int data[], size_t data_size,
     size_t block_end = data_size - 1;
     size_t found_index = 0;
 
-    printf("\n  [1단계] 색인 테이블 탐색:\n");
+    DS_TRACE("\n  [1단계] 색인 테이블 탐색:\n");
     for (size_t i = 0; i < index_size; i++) {
-        printf("    index[%zu]: key=%d, start=%zu ", i, index_table[i].key, index_table[i].start);
+        DS_TRACE("    index[%zu]: key=%d, start=%zu ", i, index_table[i].key, index_table[i].start);
 
         if (target <= index_table[i].key) {
             // target이 이 구간에 있거나 이전 구간에 있음
             block_start = index_table[i].start;
             block_end = (i == index_size - 1) ? data_size - 1 : index_table[i].start + BLOCK_SIZE - 1;
             found_index = i;
-            printf("→ 선택! (target %d ≤ key %d)\n", target, index_table[i].key);
+            DS_TRACE("→ 선택! (target %d ≤ key %d)\n", target, index_table[i].key);
             break;
         } else {
-            printf("→ 통과 (target %d > key %d)\n", target, index_table[i].key);
+            DS_TRACE("→ 통과 (target %d > key %d)\n", target, index_table[i].key);
             if (i == index_size - 1) {
                 // 마지막 색인도 초과하면 못 찾음
-                printf("    → target이 모든 구간의 최댓값보다 큽니다.\n");
+                DS_TRACE("    → target이 모든 구간의 최댓값보다 큽니다.\n");
                 return -1;
             }
         }
@@ -141,26 +143,28 @@ int indexed_sequential_search(const int data[], size_t data_size,
     // --------------------------------------------------------
     // 2단계: 구간 내 순차 탐색
     // --------------------------------------------------------
-    printf("\n  [2단계] 구간 [%zu] 순차 탐색: 인덱스 %zu ~ %zu\n",
-           found_index, block_start, block_end);
+    DS_TRACE("\n  [2단계] 구간 [%zu] 순차 탐색: 인덱스 %zu ~ %zu\n",
+             found_index, block_start, block_end);
 
-    print_search_progress(data, data_size, BLOCK_SIZE,
-                         block_start, block_end, target, "  탐색 범위:");
+    if (DS_TRACE_ENABLED) {
+        print_search_progress(data, data_size, BLOCK_SIZE,
+                             block_start, block_end, target, "  탐색 범위:");
+    }
 
     for (size_t i = block_start; i <= block_end && i < data_size; i++) {
-        printf("    data[%zu] = %d ", i, data[i]);
+        DS_TRACE("    data[%zu] = %d ", i, data[i]);
 
         if (data[i] == target) {
-            printf("→ 발견! ✓\n");
+            DS_TRACE("→ 발견! ✓\n");
             return (int)i;
         } else if (data[i] > target) {
-            printf("→ 초과! 더 이상 찾을 필요 없음 (정렬됨)\n");
+            DS_TRACE("→ 초과! 더 이상 찾을 필요 없음 (정렬됨)\n");
             break;
         }
-        printf("→ 계속...\n");
+        DS_TRACE("→ 계속...\n");
     }
 
-    printf("    → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
+    DS_TRACE("    → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
     return -1;
 }
 
@@ -3,6 +3,8 @@
 #include <stdbool.h>
 #include <math.h>
 
+#include "ds_trace.h"
+
 #define ARRAY_SIZE 20
 
 // ============================================================
@@ -87,18 +89,20 @@ int interpolation_search(const int arr[], size_t size, int target) {
     size_t low = 0;
     size_t high = size - 1;
 
-    printf("\n  보간 탐색 시작: target = %d\n", target);
-    printf("  초기 배열: ");
-    print_array(arr, size);
-    printf("\n\n");
+    DS_TRACE("\n  보간 탐색 시작: target = %d\n", target);
+    DS_TRACE("  초기 배열: ");
+    if (DS_TRACE_ENABLED) {
+        print_array(arr, size);
+    }
+    DS_TRACE("\n\n");
 
     while (low <= high && target >= arr[low] && target <= arr[high]) {
         // low == high인 경우: 남은 요소 하나만 확인
         if (low == high) {
             if (arr[low] == target) {
-                printf("  ┌───────────────────────────────────────┐\n");
-                printf("  │ 남은 요소 하나 확인: arr[%zu] = %d │\n", low, arr[low]);
-                printf("  └───────────────────────────────────────┘\n");
+                DS_TRACE("  ┌───────────────────────────────────────┐\n");
+                DS_TRACE("  │ 남은 요소 하나 확인: arr[%zu] = %d │\n", low, arr[low]);
+                DS_TRACE("  └───────────────────────────────────────┘\n");
                 return (int)low;
             }
             return -1;
@@ -111,7 +115,7 @@ int interpolation_search(const int arr[], size_t size, int target) {
         // 분모가 0이 되는 것을 방지하기 위해 arr[high] != arr[low] 확인
         if (arr[high] == arr[low]) {
             // 모든 값이 같은 경우
-            printf("  → 모든 값이 %d로 동일합니다.\n", arr[low]);
+            DS_TRACE("  → 모든 값이 %d로 동일합니다.\n", arr[low]);
             return arr[low] == target ? (int)low : -1;
         }
 
@@ -119,18 +123,26 @@ int interpolation_search(const int arr[], size_t size, int target) {
         double ratio = (double)(target - arr[low]) / (arr[high] - arr[low]);
         size_t pos = low + (size_t)(ratio * (high - low));
 
-        print_interpolation_formula(arr, low, high, target, pos);
+        if (DS_TRACE_ENABLED) {
+            print_interpolation_formula(arr, low, high, target, pos);
+        }
 
         if (arr[pos] == target) {
-            print_search_state(arr, size, low, high, pos, target, "발견! ✓");
+            if (DS_TRACE_ENABLED) {
+                print_search_state(arr, size, low, high, pos, target, "발견! ✓");
+            }
             return (int)pos;
         }
 
         if (arr[pos] < target) {
-            print_search_state(arr, size, low, high, pos, target, "오른쪽 탐색");
+            if (DS_TRACE_ENABLED) {
+                print_search_state(arr, size, low, high, pos, target, "오른쪽 탐색");
+            }
             low = pos + 1;
         } else {
-            print_search_state(arr, size, low, high, pos, target, "왼쪽 탐색");
+            if (DS_TRACE_ENABLED) {
+                print_search_state(arr, size, low, high, pos, target, "왼쪽 탐색");
+            }
             if (pos == 0) {
                 // underflow 방지
                 return -1;
@@ -139,7 +151,7 @@ int interpolation_search(const int arr[], size_t size, int target) {
         }
     }
 
-    printf("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
+    DS_TRACE("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
     return -1;
 }
 
@@ -158,8 +170,8 @@ static int interpolation_search_recursive_impl(const int arr[], int target,
     if (low == high) {
         if (arr[low] == target) {
             if (verbose) {
-                printf("     재귀: low==high=%zu, arr[%zu]=%d == target → 발견!\n",
-                       low, low, arr[low]);
+                DS_TRACE("     재귀: low==high=%zu, arr[%zu]=%d == target → 발견!\n",
+                         low, low, arr[low]);
             }
             return (int)low;
         }
@@ -176,25 +188,25 @@ static int interpolation_search_recursive_impl(const int arr[], int target,
     size_t pos = low + (size_t)(ratio * (high - low));
 
     if (verbose) {
-        printf("     재귀: low=%zu, high=%zu, pos=%zu, arr[pos]=%d\n",
-               low, high, pos, arr[pos]);
+        DS_TRACE("     재귀: low=%zu, high=%zu, pos=%zu, arr[pos]=%d\n",
+                 low, high, pos, arr[pos]);
     }
 
     if (arr[pos] == target) {
         if (verbose) {
-            printf("          → arr[%zu]=%d == target → 발견!\n", pos, arr[pos]);
+            DS_TRACE("          → arr[%zu]=%d == target → 발견!\n", pos, arr[pos]);
         }
         return (int)pos;
     }
 
     if (arr[pos] < target) {
         if (verbose) {
-            printf("          → arr[%zu]=%d < target → 오른쪽\n", pos, arr[pos]);
+            DS_TRACE("          → arr[%zu]=%d < target → 오른쪽\n", pos, arr[pos]);
         }
         return interpolation_search_recursive_impl(arr, target, pos + 1, high, verbose);
     } else {
         if (verbose) {
-            printf("          → arr[%zu]=%d > target → 왼쪽\n", pos, arr[pos]);
+            DS_TRACE("          → arr[%zu]=%d > target → 왼쪽\n", pos, arr[pos]);
         }
         if (pos == 0) return -1;
         return interpolation_search_recursive_impl(arr, target, low, pos - 1, verbose);
@@ -203,10 +215,10 @@ static int interpolation_search_recursive_impl(const int arr[], int target,
 
 // 재귀 버전 래퍼 함수
 int interpolation_search_recursive(const int arr[], size_t size, int target) {
-    printf("\n  재귀 버전 탐색 시작: target = %d\n", target);
+    DS_TRACE("\n  재귀 버전 탐색 시작: target = %d\n", target);
     int result = interpolation_search_recursive_impl(arr, target, 0, size - 1, true);
     if (result == -1) {
-        printf("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
+        DS_TRACE("  → 탐색 실패: %d을(를) 찾을 수 없음\n", target);
     }
     return result;
 }
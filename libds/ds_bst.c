@@ -0,0 +1,175 @@
+/*
+ * ds_bst.c: 이진 탐색 트리 (반복문 구현)
+ */
+
+#include "ds_bst.h"
+
+#include <stdlib.h>
+
+void ds_bst_init(DsBST *tree) {
+    tree->root = NULL;
+    tree->count = 0;
+}
+
+// 오른쪽 회전으로 왼쪽 서브트리를 펼치며 해제 (추가 메모리 없음)
+void ds_bst_destroy(DsBST *tree) {
+    DsBSTNode *node = tree->root;
+    while (node != NULL) {
+        if (node->left != NULL) {
+            DsBSTNode *left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            DsBSTNode *right = node->right;
+            free(node);
+            node = right;
+        }
+    }
+    ds_bst_init(tree);
+}
+
+bool ds_bst_insert(DsBST *tree, int key) {
+    DsBSTNode **link = &tree->root;
+    while (*link != NULL) {
+        if (key < (*link)->key) {
+            link = &(*link)->left;
+        } else if (key > (*link)->key) {
+            link = &(*link)->right;
+        } else {
+            return false;   // 중복 키
+        }
+    }
+
+    DsBSTNode *node = malloc(sizeof(DsBSTNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->key = key;
+    node->left = NULL;
+    node->right = NULL;
+    *link = node;
+    tree->count++;
+    return true;
+}
+
+bool ds_bst_contains(const DsBST *tree, int key) {
+    const DsBSTNode *node = tree->root;
+    while (node != NULL && node->key != key) {
+        node = key < node->key ? node->left : node->right;
+    }
+    return node != NULL;
+}
+
+bool ds_bst_remove(DsBST *tree, int key) {
+    DsBSTNode **link = &tree->root;
+    while (*link != NULL && (*link)->key != key) {
+        link = key < (*link)->key ? &(*link)->left : &(*link)->right;
+    }
+    if (*link == NULL) {
+        return false;
+    }
+
+    DsBSTNode *node = *link;
+    if (node->left == NULL) {
+        *link = node->right;            // 리프 또는 오른쪽 자식 1개
+    } else if (node->right == NULL) {
+        *link = node->left;             // 왼쪽 자식 1개
+    } else {
+        // 자식 2개: 오른쪽 서브트리의 최솟값(후계자)을 떼어내 대체
+        DsBSTNode **succ_link = &node->right;
+        while ((*succ_link)->left != NULL) {
+            succ_link = &(*succ_link)->left;
+        }
+        DsBSTNode *succ = *succ_link;
+        *succ_link = succ->right;
+        succ->left = node->left;
+        succ->right = node->right;
+        *link = succ;
+    }
+
+    free(node);
+    tree->count--;
+    return true;
+}
+
+bool ds_bst_min(const DsBST *tree, int *key) {
+    const DsBSTNode *node = tree->root;
+    if (node == NULL) {
+        return false;
+    }
+    while (node->left != NULL) {
+        node = node->left;
+    }
+    *key = node->key;
+    return true;
+}
+
+bool ds_bst_max(const DsBST *tree, int *key) {
+    const DsBSTNode *node = tree->root;
+    if (node == NULL) {
+        return false;
+    }
+    while (node->right != NULL) {
+        node = node->right;
+    }
+    *key = node->key;
+    return true;
+}
+
+// 레벨 순회로 높이 계산 (큐는 count 크기 배열)
+size_t ds_bst_height(const DsBST *tree) {
+    if (tree->root == NULL) {
+        return 0;
+    }
+    const DsBSTNode **queue = malloc(tree->count * sizeof(DsBSTNode *));
+    if (queue == NULL) {
+        return 0;
+    }
+
+    size_t front = 0, rear = 0, height = 0;
+    queue[rear++] = tree->root;
+    while (front < rear) {
+        size_t level_end = rear;
+        height++;
+        while (front < level_end) {
+            const DsBSTNode *node = queue[front++];
+            if (node->left != NULL) {
+                queue[rear++] = node->left;
+            }
+            if (node->right != NULL) {
+                queue[rear++] = node->right;
+            }
+        }
+    }
+
+    free(queue);
+    return height;
+}
+
+// 모리스(Morris) 중위 순회: 스레드 링크를 임시로 만들어 스택 없이 순회
+size_t ds_bst_inorder(const DsBST *tree, int out[]) {
+    DsBSTNode *node = tree->root;
+    size_t count = 0;
+
+    while (node != NULL) {
+        if (node->left == NULL) {
+            out[count++] = node->key;
+            node = node->right;
+            continue;
+        }
+        DsBSTNode *pred = node->left;
+        while (pred->right != NULL && pred->right != node) {
+            pred = pred->right;
+        }
+        if (pred->right == NULL) {
+            pred->right = node;     // 스레드 생성
+            node = node->left;
+        } else {
+            pred->right = NULL;     // 스레드 복구
+            out[count++] = node->key;
+            node = node->right;
+        }
+    }
+    return count;
+}
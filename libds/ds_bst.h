@@ -0,0 +1,53 @@
+/**
+ * ds_bst.h: 이진 탐색 트리 (chapter08/binary_search_tree.c 기반)
+ *
+ * - 모든 연산을 반복문으로 구현 → 편향 트리에서도 재귀 스택 넘침 없음
+ * - 중복 키는 저장하지 않는다
+ * - 시간 복잡도: O(h) (평균 O(log n), 최악 O(n))
+ */
+
+#ifndef DS_BST_H
+#define DS_BST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct DsBSTNode {
+    int key;
+    struct DsBSTNode *left;
+    struct DsBSTNode *right;
+} DsBSTNode;
+
+typedef struct {
+    DsBSTNode *root;
+    size_t count;
+} DsBST;
+
+void ds_bst_init(DsBST *tree);
+void ds_bst_destroy(DsBST *tree);
+
+/**
+ * 키 삽입
+ * @return 새로 삽입되면 true, 이미 있거나 메모리 부족이면 false
+ */
+bool ds_bst_insert(DsBST *tree, int key);
+
+bool ds_bst_contains(const DsBST *tree, int key);
+
+/**
+ * 키 삭제 (자식 2개인 경우 후계자로 대체)
+ * @return 삭제되면 true, 키가 없으면 false
+ */
+bool ds_bst_remove(DsBST *tree, int key);
+
+bool ds_bst_min(const DsBST *tree, int *key);
+bool ds_bst_max(const DsBST *tree, int *key);
+size_t ds_bst_height(const DsBST *tree);
+
+/**
+ * 중위 순회 결과(오름차순)를 out에 기록한다 (out 크기 >= count)
+ * @return 기록한 개수
+ */
+size_t ds_bst_inorder(const DsBST *tree, int out[]);
+
+#endif // DS_BST_H
@@ -0,0 +1,132 @@
+/*
+ * ds_counters.c: 작업량 카운터 저장소와 perf_event_open 래퍼
+ */
+
+#define _DEFAULT_SOURCE   // syscall()
+
+#include "ds_counters.h"
+
+#include <errno.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+_Thread_local DsCounters ds_counters;
+
+void ds_counters_reset(void) {
+    memset(&ds_counters, 0, sizeof(ds_counters));
+}
+
+#ifdef __linux__
+
+// read() 형식: PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+typedef struct {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+} PerfReading;
+
+static int open_event(uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);   // 이 스레드, 모든 CPU
+}
+
+bool ds_perf_open(DsPerfCounters *perf) {
+    static const uint64_t configs[DS_PERF_NUM_EVENTS] = {
+        [DS_PERF_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+        [DS_PERF_LLC_MISSES] = PERF_COUNT_HW_CACHE_MISSES,   // 대부분의 CPU에서 LLC 미스
+        [DS_PERF_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES,
+    };
+    bool any = false;
+    int saved_errno = 0;
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        perf->fd[e] = open_event(configs[e]);
+        if (perf->fd[e] >= 0) {
+            any = true;
+        } else {
+            saved_errno = errno;
+        }
+    }
+    if (!any) {
+        errno = saved_errno;
+    }
+    return any;
+}
+
+void ds_perf_start(DsPerfCounters *perf) {
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        if (perf->fd[e] >= 0) {
+            ioctl(perf->fd[e], PERF_EVENT_IOC_RESET, 0);
+            ioctl(perf->fd[e], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void ds_perf_stop(DsPerfCounters *perf, DsPerfSample *sample) {
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        if (perf->fd[e] >= 0) {
+            ioctl(perf->fd[e], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        PerfReading r;
+        sample->value[e] = DS_PERF_UNAVAILABLE;
+        if (perf->fd[e] < 0 || read(perf->fd[e], &r, sizeof(r)) != (ssize_t)sizeof(r)
+            || r.time_running == 0) {
+            continue;
+        }
+        // 카운터 수가 PMU보다 많으면 시간을 나눠 측정되므로 전체 시간으로 환산
+        sample->value[e] = r.time_running < r.time_enabled
+            ? (uint64_t)((double)r.value * (double)r.time_enabled / (double)r.time_running)
+            : r.value;
+    }
+}
+
+void ds_perf_close(DsPerfCounters *perf) {
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        if (perf->fd[e] >= 0) {
+            close(perf->fd[e]);
+            perf->fd[e] = -1;
+        }
+    }
+}
+
+#else // !__linux__
+
+bool ds_perf_open(DsPerfCounters *perf) {
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        perf->fd[e] = -1;
+    }
+    errno = ENOSYS;
+    return false;
+}
+
+void ds_perf_start(DsPerfCounters *perf) {
+    (void)perf;
+}
+
+void ds_perf_stop(DsPerfCounters *perf, DsPerfSample *sample) {
+    (void)perf;
+    for (int e = 0; e < DS_PERF_NUM_EVENTS; e++) {
+        sample->value[e] = DS_PERF_UNAVAILABLE;
+    }
+}
+
+void ds_perf_close(DsPerfCounters *perf) {
+    (void)perf;
+}
+
+#endif // __linux__
@@ -0,0 +1,96 @@
+/**
+ * ds_counters.h: 정렬/탐색 작업량 계측 (비교, 교환, 이동 횟수 + 하드웨어 성능 카운터)
+ *
+ * chapter12의 trace는 단계를 보여 줄 뿐 작업량을 세지 않는다. 알고리즘을 입력 분포별로
+ * 근거를 갖고 고를 수 있도록 libds의 정렬/탐색이 한 일을 센다.
+ *
+ *   DS_COUNTERS_ENABLED = 0 (기본): 계측 코드가 상수 조건으로 제거됨 (비용 0, ds 라이브러리)
+ *   DS_COUNTERS_ENABLED = 1       : 호출 스레드의 ds_counters에 누적 (ds_counted 라이브러리)
+ *
+ * CMake: 같은 소스를 DS_COUNTERS_ENABLED=1로 한 번 더 빌드한 ds_counted 타깃을 링크한다.
+ *
+ * 세는 기준 (원소 하나 단위):
+ * - comparisons: 원소끼리 또는 원소와 키의 비교 (벡터 비교는 비교한 레인 수만큼)
+ * - swaps      : 두 원소의 자리 교환
+ * - moves      : 교환 이외의 원소 쓰기 (삽입 정렬의 밀기, 병합 출력, 임시 버퍼 복사 등)
+ *
+ * 카운터는 스레드별이므로 병렬 정렬은 호출 스레드가 처리한 몫만 집계된다.
+ *
+ * 하드웨어 카운터(ds_perf_*)는 Linux perf_event_open으로 사이클, LLC 미스, 분기 예측 실패를
+ * 읽는다. 커널 설정(perf_event_paranoid)이나 가상 머신에 따라 일부 또는 전부 열리지 않을 수
+ * 있으며, 열리지 않은 항목은 DS_PERF_UNAVAILABLE로 보고된다.
+ */
+
+#ifndef DS_COUNTERS_H
+#define DS_COUNTERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef DS_COUNTERS_ENABLED
+#define DS_COUNTERS_ENABLED 0
+#endif
+
+typedef struct {
+    uint64_t comparisons;
+    uint64_t swaps;
+    uint64_t moves;
+} DsCounters;
+
+extern _Thread_local DsCounters ds_counters;
+
+void ds_counters_reset(void);
+
+#define DS_COUNT_CMP(k)                                \
+    do {                                               \
+        if (DS_COUNTERS_ENABLED) {                     \
+            ds_counters.comparisons += (uint64_t)(k);  \
+        }                                              \
+    } while (0)
+
+#define DS_COUNT_SWAP(k)                               \
+    do {                                               \
+        if (DS_COUNTERS_ENABLED) {                     \
+            ds_counters.swaps += (uint64_t)(k);        \
+        }                                              \
+    } while (0)
+
+#define DS_COUNT_MOVE(k)                               \
+    do {                                               \
+        if (DS_COUNTERS_ENABLED) {                     \
+            ds_counters.moves += (uint64_t)(k);        \
+        }                                              \
+    } while (0)
+
+// 조건식 안에서 쓰는 형태: 비교 한 번을 세고 결과를 그대로 돌려준다
+#define DS_CMP(expr) (DS_COUNTERS_ENABLED ? (ds_counters.comparisons++, (expr)) : (expr))
+
+// ==================== 하드웨어 성능 카운터 ====================
+
+#define DS_PERF_UNAVAILABLE UINT64_MAX
+
+typedef enum {
+    DS_PERF_CYCLES,
+    DS_PERF_LLC_MISSES,
+    DS_PERF_BRANCH_MISSES,
+    DS_PERF_NUM_EVENTS
+} DsPerfEvent;
+
+typedef struct {
+    int fd[DS_PERF_NUM_EVENTS];   // -1: 열리지 않음
+} DsPerfCounters;
+
+typedef struct {
+    uint64_t value[DS_PERF_NUM_EVENTS];   // 다중화(multiplexing) 시 실행 시간 비율로 보정
+} DsPerfSample;
+
+/**
+ * 현재 스레드(사용자 공간만)를 측정하는 카운터를 연다
+ * @return 하나라도 열렸으면 true, 모두 실패하면 false (errno: 마지막 실패 원인)
+ */
+bool ds_perf_open(DsPerfCounters *perf);
+void ds_perf_start(DsPerfCounters *perf);               // 0으로 초기화 후 측정 시작
+void ds_perf_stop(DsPerfCounters *perf, DsPerfSample *sample);
+void ds_perf_close(DsPerfCounters *perf);
+
+#endif // DS_COUNTERS_H
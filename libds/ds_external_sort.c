@@ -0,0 +1,316 @@
+/*
+ * ds_external_sort.c: 외부 병합 정렬
+ *
+ * 메모리 배치 (예산 하나를 단계마다 다르게 나눠 쓴다):
+ *   런 생성: [           정렬 버퍼 (예산 전체)            ]
+ *   병합    : [입력 블록 0][입력 블록 1]...[입력 블록 k-1][출력 블록]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ds_external_sort.h"
+#include "ds_sort.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define MIN_BLOCK_INTS 1024   // 블록이 이보다 작으면 탐색(seek) 비용이 지배적
+
+// ==================== 임시 런 파일 ====================
+
+typedef struct {
+    FILE **files;
+    size_t count;
+    size_t capacity;
+} RunList;
+
+static bool run_list_push(RunList *runs, FILE *file) {
+    if (runs->count == runs->capacity) {
+        size_t capacity = runs->capacity ? runs->capacity * 2 : 16;
+        FILE **grown = realloc(runs->files, capacity * sizeof(FILE *));
+        if (grown == NULL) {
+            return false;
+        }
+        runs->files = grown;
+        runs->capacity = capacity;
+    }
+    runs->files[runs->count++] = file;
+    return true;
+}
+
+static void run_list_close(RunList *runs) {
+    for (size_t i = 0; i < runs->count; i++) {
+        fclose(runs->files[i]);
+    }
+    free(runs->files);
+    runs->files = NULL;
+    runs->count = runs->capacity = 0;
+}
+
+// 임시 디렉터리에 런 파일 생성 후 즉시 unlink (닫으면 자동 삭제)
+static FILE *create_temp_run(const char *dir) {
+    char path[4096];
+    if (snprintf(path, sizeof(path), "%s/ds_run_XXXXXX", dir) >= (int)sizeof(path)) {
+        errno = ENAMETOOLONG;
+        return NULL;
+    }
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return NULL;
+    }
+    unlink(path);
+    FILE *file = fdopen(fd, "w+b");
+    if (file == NULL) {
+        close(fd);
+    }
+    return file;
+}
+
+static bool write_ints(FILE *file, const int *data, size_t n) {
+    return fwrite(data, sizeof(int), n, file) == n;
+}
+
+// ==================== k-way 병합 ====================
+
+typedef struct {
+    FILE *file;
+    int *buffer;
+    size_t size;   // 버퍼에 읽어 둔 원소 수
+    size_t pos;    // 다음에 꺼낼 위치
+} RunReader;
+
+// 다음 블록을 읽는다 (남은 데이터가 없으면 false)
+static bool reader_fill(RunReader *reader, size_t block_ints) {
+    reader->size = fread(reader->buffer, sizeof(int), block_ints, reader->file);
+    reader->pos = 0;
+    return reader->size > 0;
+}
+
+// 최소 힙 원소: 런의 현재 값
+typedef struct {
+    int key;
+    unsigned run;
+} MergeEntry;
+
+// 구멍(hole) 방식 하향 이동 (chapter09/heap.c의 delete_heap과 같은 흐름, 최소 힙)
+static void merge_sift_down(MergeEntry heap[], size_t size, size_t i) {
+    MergeEntry item = heap[i];
+    size_t child;
+    while ((child = 2 * i + 1) < size) {
+        if (child + 1 < size && heap[child + 1].key < heap[child].key) {
+            child++;
+        }
+        if (item.key <= heap[child].key) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = item;
+}
+
+/**
+ * 정렬된 런 k개를 out으로 병합
+ * memory: (k + 1) × block_ints 개의 int (입력 블록 k개 + 출력 블록)
+ */
+static bool merge_runs(FILE *const inputs[], size_t k, FILE *out,
+                       int *memory, size_t block_ints) {
+    RunReader *readers = malloc(k * sizeof(RunReader));
+    MergeEntry *heap = malloc(k * sizeof(MergeEntry));
+    if (readers == NULL || heap == NULL) {
+        free(readers);
+        free(heap);
+        return false;
+    }
+
+    size_t heap_size = 0;
+    for (size_t i = 0; i < k; i++) {
+        readers[i] = (RunReader){inputs[i], memory + i * block_ints, 0, 0};
+        rewind(inputs[i]);
+        if (reader_fill(&readers[i], block_ints)) {
+            heap[heap_size++] = (MergeEntry){readers[i].buffer[readers[i].pos++], (unsigned)i};
+        }
+    }
+    for (size_t i = heap_size / 2; i-- > 0;) {
+        merge_sift_down(heap, heap_size, i);
+    }
+
+    int *out_buffer = memory + k * block_ints;
+    size_t out_size = 0;
+    bool ok = true;
+    while (heap_size > 0 && ok) {
+        out_buffer[out_size++] = heap[0].key;
+        if (out_size == block_ints) {
+            ok = write_ints(out, out_buffer, out_size);
+            out_size = 0;
+        }
+        // 꺼낸 런의 다음 값으로 루트를 교체 (pop + push 대신 한 번의 하향 이동)
+        RunReader *reader = &readers[heap[0].run];
+        if (reader->pos < reader->size || reader_fill(reader, block_ints)) {
+            heap[0].key = reader->buffer[reader->pos++];
+        } else {
+            heap[0] = heap[--heap_size];   // 런 소진
+        }
+        merge_sift_down(heap, heap_size, 0);
+    }
+    if (ok) {
+        ok = write_ints(out, out_buffer, out_size);
+    }
+    for (size_t i = 0; i < k; i++) {
+        ok = ok && !ferror(inputs[i]);
+    }
+
+    free(readers);
+    free(heap);
+    return ok;
+}
+
+// ==================== 외부 정렬 ====================
+
+// 다음 읽기가 파일 끝인지 한 바이트 미리 보기 (입력이 정확히 청크 크기일 때 임시 런을 피함)
+static bool at_eof(FILE *in) {
+    int c = getc(in);
+    if (c == EOF) {
+        return true;
+    }
+    ungetc(c, in);
+    return false;
+}
+
+/**
+ * 1단계: 메모리 예산 크기씩 읽어 정렬한 런을 만든다
+ * 입력 전체가 한 번에 들어가면 output에 바로 기록하고 runs는 비워 둔다.
+ */
+static bool create_runs(FILE *in, FILE *out, int *memory, size_t chunk_ints,
+                        const char *temp_dir, RunList *runs, size_t *total) {
+    for (;;) {
+        size_t bytes = fread(memory, 1, chunk_ints * sizeof(int), in);
+        if (bytes % sizeof(int) != 0) {
+            errno = EINVAL;   // 파일 크기가 int 크기의 배수가 아님
+            return false;
+        }
+        size_t n = bytes / sizeof(int);
+        if (n == 0) {
+            return !ferror(in);
+        }
+        *total += n;
+        ds_pdq_sort(memory, n);
+
+        if (runs->count == 0 && (n < chunk_ints || at_eof(in))) {
+            return !ferror(in) && write_ints(out, memory, n);   // 런 하나로 끝
+        }
+        FILE *run = create_temp_run(temp_dir);
+        if (run == NULL) {
+            return false;
+        }
+        if (!run_list_push(runs, run)) {
+            fclose(run);
+            return false;
+        }
+        if (!write_ints(run, memory, n)) {
+            return false;
+        }
+    }
+}
+
+/**
+ * 2단계: 런이 fan_in개 이하가 될 때까지 묶음별로 병합해 새 런을 만든다
+ */
+static bool reduce_runs(RunList *runs, size_t fan_in, int *memory, size_t block_ints,
+                        const char *temp_dir, unsigned *passes) {
+    while (runs->count > fan_in) {
+        RunList next = {0};
+        bool ok = true;
+        for (size_t start = 0; start < runs->count && ok; start += fan_in) {
+            size_t k = runs->count - start < fan_in ? runs->count - start : fan_in;
+            FILE *merged = create_temp_run(temp_dir);
+            ok = merged != NULL;
+            if (ok && !run_list_push(&next, merged)) {
+                fclose(merged);
+                ok = false;
+            }
+            ok = ok && merge_runs(runs->files + start, k, merged, memory, block_ints);
+        }
+        run_list_close(runs);
+        *runs = next;
+        if (!ok) {
+            return false;
+        }
+        (*passes)++;
+    }
+    return true;
+}
+
+bool ds_external_sort_file(const char *input_path, const char *output_path,
+                           const DsExternalSortOptions *options, DsExternalSortStats *stats) {
+    size_t budget = DS_EXTERNAL_DEFAULT_MEMORY;
+    size_t io_block = DS_EXTERNAL_DEFAULT_IO_BLOCK;
+    const char *temp_dir = NULL;
+    if (options != NULL) {
+        budget = options->memory_budget ? options->memory_budget : budget;
+        io_block = options->io_block ? options->io_block : io_block;
+        temp_dir = options->temp_dir;
+    }
+    if (temp_dir == NULL) {
+        temp_dir = getenv("TMPDIR");
+    }
+    if (temp_dir == NULL || temp_dir[0] == '\0') {
+        temp_dir = "/tmp";
+    }
+
+    // 병합에는 최소 입력 2블록 + 출력 1블록이 필요
+    size_t budget_ints = budget / sizeof(int);
+    size_t block_ints = io_block / sizeof(int);
+    if (block_ints > budget_ints / 3) {
+        block_ints = budget_ints / 3;
+    }
+    if (block_ints < MIN_BLOCK_INTS) {
+        errno = EINVAL;
+        return false;
+    }
+    size_t fan_in = budget_ints / block_ints - 1;
+
+    int *memory = malloc(budget_ints * sizeof(int));
+    if (memory == NULL) {
+        return false;
+    }
+    FILE *in = fopen(input_path, "rb");
+    FILE *out = fopen(output_path, "wb");
+    RunList runs = {0};
+    size_t total = 0;
+    unsigned passes = 0;
+
+    bool ok = in != NULL && out != NULL
+              && create_runs(in, out, memory, budget_ints, temp_dir, &runs, &total);
+    size_t initial_runs = runs.count > 0 ? runs.count : (total > 0);
+    if (ok && runs.count > 0) {
+        ok = reduce_runs(&runs, fan_in, memory, block_ints, temp_dir, &passes)
+             && merge_runs(runs.files, runs.count, out, memory, block_ints);
+        if (ok) {
+            passes++;
+        }
+    }
+
+    if (stats != NULL) {
+        stats->num_elements = total;
+        stats->initial_runs = initial_runs;
+        stats->merge_passes = passes;
+        stats->fan_in = (unsigned)fan_in;
+    }
+
+    int saved_errno = errno;   // 정리 중 호출로 원인이 덮이지 않도록
+    run_list_close(&runs);
+    if (in != NULL) {
+        fclose(in);
+    }
+    if (out != NULL && fclose(out) != 0 && ok) {
+        ok = false;
+        saved_errno = errno;
+    }
+    free(memory);
+    errno = saved_errno;
+    return ok;
+}
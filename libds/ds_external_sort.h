@@ -0,0 +1,45 @@
+/**
+ * ds_external_sort.h: 외부 병합 정렬 (메모리보다 큰 파일)
+ *
+ * 입력/출력 형식: 부호 있는 32비트 정수(int, 시스템 바이트 순서)의 연속 바이너리 파일
+ *
+ * 1) 런 생성: 메모리 예산만큼 순차로 읽어 ds_pdq_sort로 정렬한 뒤 임시 런 파일에 기록
+ * 2) k-way 병합: 런마다 입력 블록 하나씩 두고 최소 힙(런의 현재 값)으로 병합
+ *    런 수가 한 번에 병합할 수 있는 수(메모리 예산 / 블록 크기)보다 많으면 여러 단계로 병합
+ *
+ * 모든 입출력은 io_block 크기의 큰 순차 읽기/쓰기이다.
+ * 임시 파일은 만든 즉시 unlink하므로 비정상 종료 시에도 남지 않는다.
+ */
+
+#ifndef DS_EXTERNAL_SORT_H
+#define DS_EXTERNAL_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define DS_EXTERNAL_DEFAULT_MEMORY   ((size_t)256 << 20)   // 256 MiB
+#define DS_EXTERNAL_DEFAULT_IO_BLOCK ((size_t)4 << 20)     // 4 MiB
+
+typedef struct {
+    size_t memory_budget;   // 정렬/병합 버퍼 전체 상한 (바이트, 0: 기본값)
+    size_t io_block;        // 런 하나당 읽기/쓰기 블록 크기 (바이트, 0: 기본값)
+    const char *temp_dir;   // 임시 런 파일 위치 (NULL: $TMPDIR 또는 /tmp)
+} DsExternalSortOptions;
+
+typedef struct {
+    size_t num_elements;    // 정렬한 원소 수
+    size_t initial_runs;    // 1단계에서 만든 런 수
+    unsigned merge_passes;  // 병합 단계 수 (런이 하나면 0)
+    unsigned fan_in;        // 한 번에 병합한 최대 런 수
+} DsExternalSortStats;
+
+/**
+ * input_path를 정렬해 output_path에 기록 (두 경로가 같으면 안 됨)
+ * @param options NULL이면 기본값
+ * @param stats   NULL 허용
+ * @return 성공 시 true, 입출력 오류/메모리 부족/잘못된 파일 크기 시 false (errno 유지)
+ */
+bool ds_external_sort_file(const char *input_path, const char *output_path,
+                           const DsExternalSortOptions *options, DsExternalSortStats *stats);
+
+#endif // DS_EXTERNAL_SORT_H
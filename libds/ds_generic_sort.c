@@ -0,0 +1,275 @@
+/*
+ * ds_generic_sort.c: 타입 소거 정렬 (void * + 원소 크기 + 비교 함수)
+ *
+ * 원소는 바이트 덩어리로만 다룬다. 임시 원소 공간이 필요 없도록 삽입/쉘/힙 정렬은
+ * 대입 대신 교환으로 원소를 옮기고, 퀵 정렬은 피벗을 base[0]에 둔 채 포인터로 비교한다.
+ */
+
+#include "ds_generic_sort.h"
+#include "ds_counters.h"
+#include "ds_radix.h"
+
+#define ELEM(base, i, size) ((char *)(base) + (i) * (size))
+
+// 크기를 모르는 두 원소 교환 (8바이트 단위 + 나머지 바이트)
+static inline void swap_bytes(void *a, void *b, size_t size) {
+    DS_COUNT_SWAP(1);
+    char *p = a, *q = b;
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t)) {
+        uint64_t x, y;
+        memcpy(&x, p, sizeof(x));
+        memcpy(&y, q, sizeof(y));
+        memcpy(p, &y, sizeof(y));
+        memcpy(q, &x, sizeof(x));
+        p += sizeof(uint64_t);
+        q += sizeof(uint64_t);
+    }
+    for (; size > 0; size--) {
+        char c = *p;
+        *p++ = *q;
+        *q++ = c;
+    }
+}
+
+// ==================== O(n²) 정렬 ====================
+
+void ds_generic_selection_sort(void *base, size_t n, size_t size, DsCompareFn cmp) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        char *least = ELEM(base, i, size);
+        for (size_t j = i + 1; j < n; j++) {
+            if (DS_CMP(cmp(ELEM(base, j, size), least)) < 0) {
+                least = ELEM(base, j, size);
+            }
+        }
+        if (least != ELEM(base, i, size)) {
+            swap_bytes(ELEM(base, i, size), least, size);
+        }
+    }
+}
+
+// 간격 gap의 삽입 정렬 (gap = 1이면 일반 삽입 정렬)
+static void gapped_insertion_sort(char *base, size_t n, size_t size, size_t gap,
+                                  DsCompareFn cmp) {
+    size_t stride = gap * size;
+    for (size_t i = gap; i < n; i++) {
+        char *cur = ELEM(base, i, size);
+        for (size_t j = i; j >= gap && DS_CMP(cmp(cur - stride, cur)) > 0; j -= gap) {
+            swap_bytes(cur - stride, cur, size);
+            cur -= stride;
+        }
+    }
+}
+
+void ds_generic_insertion_sort(void *base, size_t n, size_t size, DsCompareFn cmp) {
+    gapped_insertion_sort(base, n, size, 1, cmp);
+}
+
+// ==================== 쉘 정렬 ====================
+
+void ds_generic_shell_sort(void *base, size_t n, size_t size, DsCompareFn cmp) {
+    size_t gap = 1;
+    while (gap < n / 3) {
+        gap = 3 * gap + 1;
+    }
+    for (; gap > 0; gap /= 3) {
+        gapped_insertion_sort(base, n, size, gap, cmp);
+    }
+}
+
+// ==================== 병합 정렬 ====================
+
+// base[0..mid)와 base[mid..n)을 병합 (왼쪽 절반만 temp로 복사, 안정)
+static void merge(char *base, char *temp, size_t mid, size_t n, size_t size,
+                  DsCompareFn cmp) {
+    memcpy(temp, base, mid * size);
+    char *left = temp, *left_end = temp + mid * size;
+    char *right = ELEM(base, mid, size), *right_end = ELEM(base, n, size);
+    char *out = base;
+    while (left < left_end && right < right_end) {
+        if (DS_CMP(cmp(right, left)) < 0) {
+            memcpy(out, right, size);
+            right += size;
+        } else {
+            memcpy(out, left, size);
+            left += size;
+        }
+        out += size;
+    }
+    memcpy(out, left, (size_t)(left_end - left));   // 오른쪽 나머지는 이미 제자리
+    DS_COUNT_MOVE(mid + (size_t)(out - base) / size + (size_t)(left_end - left) / size);
+}
+
+static void merge_sort_recursive(char *base, char *temp, size_t n, size_t size,
+                                 DsCompareFn cmp) {
+    if (n <= DS_SORT_INSERTION_CUTOFF) {
+        gapped_insertion_sort(base, n, size, 1, cmp);
+        return;
+    }
+    size_t mid = n / 2;
+    merge_sort_recursive(base, temp, mid, size, cmp);
+    merge_sort_recursive(ELEM(base, mid, size), temp, n - mid, size, cmp);
+    if (DS_CMP(cmp(ELEM(base, mid - 1, size), ELEM(base, mid, size))) <= 0) {
+        return;   // 이미 순서대로면 병합 생략
+    }
+    merge(base, temp, mid, n, size, cmp);
+}
+
+bool ds_generic_merge_sort(void *base, size_t n, size_t size, DsCompareFn cmp) {
+    if (n < 2) {
+        return true;
+    }
+    if (n / 2 + 1 > SIZE_MAX / size) {
+        return false;
+    }
+    char *temp = malloc((n / 2 + 1) * size);
+    if (temp == NULL) {
+        return false;
+    }
+    merge_sort_recursive(base, temp, n, size, cmp);
+    free(temp);
+    return true;
+}
+
+// ==================== 힙 정렬 ====================
+
+static void sift_down(char *base, size_t n, size_t i, size_t size, DsCompareFn cmp) {
+    size_t child;
+    while ((child = 2 * i + 1) < n) {
+        if (child + 1 < n
+            && DS_CMP(cmp(ELEM(base, child, size), ELEM(base, child + 1, size))) < 0) {
+            child++;
+        }
+        if (DS_CMP(cmp(ELEM(base, i, size), ELEM(base, child, size))) >= 0) {
+            break;
+        }
+        swap_bytes(ELEM(base, i, size), ELEM(base, child, size), size);
+        i = child;
+    }
+}
+
+void ds_generic_heap_sort(void *base, size_t n, size_t size, DsCompareFn cmp) {
+    for (size_t i = n / 2; i-- > 0;) {
+        sift_down(base, n, i, size, cmp);
+    }
+    for (size_t i = n; i-- > 1;) {
+        swap_bytes(base, ELEM(base, i, size), size);
+        sift_down(base, i, 0, size, cmp);
+    }
+}
+
+// ==================== 퀵 정렬 (인트로 정렬) ====================
+
+// 세 원소를 *a <= *b <= *c 순서로 정렬
+static void sort3(char *a, char *b, char *c, size_t size, DsCompareFn cmp) {
+    if (DS_CMP(cmp(b, a)) < 0) {
+        swap_bytes(a, b, size);
+    }
+    if (DS_CMP(cmp(c, b)) < 0) {
+        swap_bytes(b, c, size);
+    }
+    if (DS_CMP(cmp(b, a)) < 0) {
+        swap_bytes(a, b, size);
+    }
+}
+
+/**
+ * 피벗(median-of-three 또는 ninther)을 base[0]으로 옮긴 뒤 Hoare 분할
+ * 피벗은 분할이 끝날 때까지 base[0]에 머물므로 복사 없이 포인터로 비교한다.
+ */
+static size_t partition(char *base, size_t n, size_t size, DsCompareFn cmp) {
+    size_t mid = n / 2;
+    if (n > DS_SORT_NINTHER_THRESHOLD) {
+        size_t s = n / 8;
+        sort3(base, ELEM(base, s, size), ELEM(base, 2 * s, size), size, cmp);
+        sort3(ELEM(base, mid - s, size), ELEM(base, mid, size), ELEM(base, mid + s, size),
+              size, cmp);
+        sort3(ELEM(base, n - 1 - 2 * s, size), ELEM(base, n - 1 - s, size),
+              ELEM(base, n - 1, size), size, cmp);
+        sort3(ELEM(base, s, size), ELEM(base, mid, size), ELEM(base, n - 1 - s, size),
+              size, cmp);
+    } else {
+        sort3(base, ELEM(base, mid, size), ELEM(base, n - 1, size), size, cmp);
+    }
+    swap_bytes(base, ELEM(base, mid, size), size);
+
+    const char *pivot = base;
+    size_t i = 0, j = n;
+    for (;;) {
+        do {
+            i++;
+        } while (i < n && DS_CMP(cmp(ELEM(base, i, size), pivot)) < 0);
+        do {
+            j--;
+        } while (DS_CMP(cmp(pivot, ELEM(base, j, size))) < 0);
+        if (i >= j) {
+            break;
+        }
+        swap_bytes(ELEM(base, i, size), ELEM(base, j, size), size);
+    }
+    swap_bytes(base, ELEM(base, j, size), size);
+    return j;
+}
+
+static void intro_sort_loop(char *base, size_t n, size_t size, DsCompareFn cmp,
+                            unsigned depth_limit) {
+    while (n > DS_SORT_INSERTION_CUTOFF) {
+        if (depth_limit == 0) {
+            ds_generic_heap_sort(base, n, size, cmp);
+            return;
+        }
+        depth_limit--;
+
+        size_t p = partition(base, n, size, cmp);
+        // 작은 쪽 재귀, 큰 쪽은 반복
+        if (p < n - p - 1) {
+            intro_sort_loop(base, p, size, cmp, depth_limit);
+            base = ELEM(base, p + 1, size);
+            n -= p + 1;
+        } else {
+            intro_sort_loop(ELEM(base, p + 1, size), n - p - 1, size, cmp, depth_limit);
+            n = p;
+        }
+    }
+    gapped_insertion_sort(base, n, size, 1, cmp);
+}
+
+void ds_generic_quick_sort(void *base, size_t n, size_t size, DsCompareFn cmp) {
+    unsigned depth_limit = 0;
+    for (size_t m = n; m > 1; m >>= 1) {
+        depth_limit += 2;   // 2·⌊log2 n⌋
+    }
+    intro_sort_loop(base, n, size, cmp, depth_limit);
+}
+
+// ==================== 기수 정렬 ====================
+
+bool ds_generic_radix_sort(void *base, size_t n, size_t size, DsRadixKeyFn key) {
+    if (n < 2) {
+        return true;
+    }
+    if (n > UINT32_MAX || n > SIZE_MAX / size) {
+        return false;
+    }
+    uint64_t *keys = malloc(n * sizeof(uint64_t));
+    uint32_t *order = malloc(n * sizeof(uint32_t));
+    char *sorted = malloc(n * size);
+    bool ok = keys != NULL && order != NULL && sorted != NULL;
+    if (ok) {
+        for (size_t i = 0; i < n; i++) {
+            keys[i] = key(ELEM(base, i, size));
+            order[i] = (uint32_t)i;
+        }
+        ok = ds_radix_sort_u64_pairs(keys, order, n);   // 안정: 같은 키는 원래 순서 유지
+    }
+    if (ok) {
+        for (size_t i = 0; i < n; i++) {
+            memcpy(ELEM(sorted, i, size), ELEM(base, order[i], size), size);
+        }
+        memcpy(base, sorted, n * size);
+        DS_COUNT_MOVE(2 * n);   // 키 정렬 이동은 ds_radix가 센다
+    }
+    free(keys);
+    free(order);
+    free(sorted);
+    return ok;
+}
@@ -0,0 +1,355 @@
+/**
+ * ds_generic_sort.h: 임의 원소 타입 정렬 (chapter12 알고리즘의 일반화)
+ *
+ * ds_sort.h의 정렬은 모두 int 배열 전용이다. 이 모듈은 같은 알고리즘을 두 방식으로 제공한다.
+ *
+ * 1) 타입 소거 (qsort 방식): void * + 원소 크기 + 비교 함수 포인터
+ *    - 라이브러리에 한 번만 컴파일되어 어떤 타입에도 쓸 수 있다
+ *    - 비교마다 간접 호출, 원소 이동은 크기를 모르는 바이트 복사 → int 정렬보다 2~3배 느림
+ *
+ * 2) 매크로 특수화: DS_DEFINE_SORT(prefix, TYPE, LESS)가 TYPE 전용 함수를 생성
+ *    - LESS가 호출 지점에 인라인되고 원소 이동은 구조체 대입
+ *    - 16바이트 레코드(8바이트 키)도 int 정렬과 비슷한 속도
+ *
+ *    typedef struct { uint64_t key; uint64_t value; } Record;
+ *    #define RECORD_LESS(a, b) ((a).key < (b).key)
+ *    #define RECORD_KEY(a)     ((a).key)
+ *
+ *    DS_DEFINE_SORT(record, Record, RECORD_LESS)          // record_quick_sort 등
+ *    DS_DEFINE_RADIX_SORT(record, Record, RECORD_KEY)     // record_radix_sort
+ *
+ * | 알고리즘 | 타입 소거                    | 매크로 특수화           | 안정 | 추가 메모리 |
+ * |----------|------------------------------|-------------------------|------|-------------|
+ * | 선택     | ds_generic_selection_sort    | <prefix>_selection_sort | X    | O(1)        |
+ * | 삽입     | ds_generic_insertion_sort    | <prefix>_insertion_sort | O    | O(1)        |
+ * | 쉘       | ds_generic_shell_sort        | <prefix>_shell_sort     | X    | O(1)        |
+ * | 병합     | ds_generic_merge_sort        | <prefix>_merge_sort     | O    | O(n)        |
+ * | 퀵       | ds_generic_quick_sort        | <prefix>_quick_sort     | X    | O(log n)    |
+ * | 힙       | ds_generic_heap_sort         | <prefix>_heap_sort      | X    | O(1)        |
+ * | 기수     | ds_generic_radix_sort        | <prefix>_radix_sort     | O    | O(n)        |
+ *
+ * 퀵 정렬은 ds_intro_sort와 같은 인트로 정렬이다 (ninther 피벗, 힙 정렬 전환, 삽입 정렬 마무리).
+ * 기수 정렬은 비교 대신 원소마다 부호 없는 64비트 키를 받는다 (ds_radix_key_* 변환 참고).
+ * bool을 반환하는 함수는 메모리 부족 시 false를 반환하고 배열을 변경하지 않는다.
+ */
+
+#ifndef DS_GENERIC_SORT_H
+#define DS_GENERIC_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds_counters.h"
+
+// ==================== 타입 소거 인터페이스 ====================
+
+// qsort와 같은 규약: a < b이면 음수, 같으면 0, a > b이면 양수
+typedef int (*DsCompareFn)(const void *a, const void *b);
+
+// 원소의 정렬 키 (부호 없는 64비트 정수 순서가 원소 순서와 같아야 함)
+typedef uint64_t (*DsRadixKeyFn)(const void *elem);
+
+void ds_generic_selection_sort(void *base, size_t n, size_t size, DsCompareFn cmp);
+void ds_generic_insertion_sort(void *base, size_t n, size_t size, DsCompareFn cmp);
+void ds_generic_shell_sort(void *base, size_t n, size_t size, DsCompareFn cmp);
+bool ds_generic_merge_sort(void *base, size_t n, size_t size, DsCompareFn cmp);
+void ds_generic_quick_sort(void *base, size_t n, size_t size, DsCompareFn cmp);
+void ds_generic_heap_sort(void *base, size_t n, size_t size, DsCompareFn cmp);
+
+/**
+ * 키 함수 기반 LSD 기수 정렬 (ds_radix_sort_u64_pairs로 키 + 원소 번호를 정렬 후 재배치)
+ * 키 함수는 원소마다 한 번만 호출된다.
+ * @return 성공 시 true, 메모리 부족 또는 n > UINT32_MAX 시 false (배열 변경 없음)
+ */
+bool ds_generic_radix_sort(void *base, size_t n, size_t size, DsRadixKeyFn key);
+
+// ==================== 기수 정렬 키 변환 ====================
+// 부호 있는 정수/부동소수점을 부호 없는 정수 순서로 바꾼다 (ds_radix.c와 같은 변환)
+
+static inline uint64_t ds_radix_key_i32(int32_t value) {
+    return (uint64_t)((uint32_t)value ^ 0x80000000u);
+}
+
+static inline uint64_t ds_radix_key_i64(int64_t value) {
+    return (uint64_t)value ^ 0x8000000000000000ull;
+}
+
+static inline uint64_t ds_radix_key_f64(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits ^ ((0 - (bits >> 63)) | 0x8000000000000000ull);
+}
+
+// ==================== 매크로 특수화 ====================
+
+#define DS_SORT_INSERTION_CUTOFF 16    // 퀵 정렬: 이 크기 이하 구간은 삽입 정렬
+#define DS_SORT_NINTHER_THRESHOLD 128  // 퀵 정렬: 이 크기 초과 구간은 ninther 피벗
+
+/**
+ * DS_DEFINE_SORT(prefix, TYPE, LESS): TYPE 배열 정렬 함수 6종을 static inline으로 생성
+ * LESS(a, b)는 TYPE 값 두 개를 받아 a가 b보다 앞이면 참인 식 (엄격한 약순서)
+ * 생성: prefix_selection_sort, _insertion_sort, _shell_sort, _merge_sort (bool),
+ *       _quick_sort, _heap_sort
+ */
+#define DS_DEFINE_SORT(prefix, TYPE, LESS)                                        \
+    static inline void prefix##_swap_(TYPE *a, TYPE *b) {                         \
+        DS_COUNT_SWAP(1);                                                         \
+        TYPE temp = *a;                                                           \
+        *a = *b;                                                                  \
+        *b = temp;                                                                \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_selection_sort(TYPE arr[], size_t n) {            \
+        for (size_t i = 0; i + 1 < n; i++) {                                      \
+            size_t least = i;                                                     \
+            for (size_t j = i + 1; j < n; j++) {                                  \
+                if (DS_CMP(LESS(arr[j], arr[least]))) {                           \
+                    least = j;                                                    \
+                }                                                                 \
+            }                                                                     \
+            prefix##_swap_(&arr[i], &arr[least]);                                 \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_insertion_sort(TYPE arr[], size_t n) {            \
+        for (size_t i = 1; i < n; i++) {                                          \
+            TYPE key = arr[i];                                                    \
+            size_t j = i;                                                         \
+            while (j > 0 && DS_CMP(LESS(key, arr[j - 1]))) {                      \
+                arr[j] = arr[j - 1];                                              \
+                j--;                                                              \
+            }                                                                     \
+            arr[j] = key;                                                         \
+            DS_COUNT_MOVE(i - j + 1);                                             \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_shell_sort(TYPE arr[], size_t n) {                \
+        size_t gap = 1;                                                           \
+        while (gap < n / 3) {                                                     \
+            gap = 3 * gap + 1;                                                    \
+        }                                                                         \
+        for (; gap > 0; gap /= 3) {                                               \
+            for (size_t i = gap; i < n; i++) {                                    \
+                TYPE temp = arr[i];                                               \
+                size_t j = i;                                                     \
+                while (j >= gap && DS_CMP(LESS(temp, arr[j - gap]))) {            \
+                    arr[j] = arr[j - gap];                                        \
+                    j -= gap;                                                     \
+                }                                                                 \
+                arr[j] = temp;                                                    \
+                DS_COUNT_MOVE((i - j) / gap + 1);                                 \
+            }                                                                     \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    /* arr[0..mid)와 arr[mid..n)을 병합 (왼쪽 절반만 temp로 복사, 안정) */        \
+    static inline void prefix##_merge_(TYPE arr[], TYPE temp[], size_t mid,       \
+                                       size_t n) {                                \
+        memcpy(temp, arr, mid * sizeof(TYPE));                                    \
+        size_t i = 0, j = mid, k = 0;                                             \
+        while (i < mid && j < n) {                                                \
+            arr[k++] = DS_CMP(LESS(arr[j], temp[i])) ? arr[j++] : temp[i++];      \
+        }                                                                         \
+        while (i < mid) {                                                         \
+            arr[k++] = temp[i++];                                                 \
+        }                                                                         \
+        DS_COUNT_MOVE(mid + k);                                                   \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_merge_sort_rec_(TYPE arr[], TYPE temp[],          \
+                                                size_t n) {                       \
+        if (n <= DS_SORT_INSERTION_CUTOFF) {                                      \
+            prefix##_insertion_sort(arr, n);                                      \
+            return;                                                               \
+        }                                                                         \
+        size_t mid = n / 2;                                                       \
+        prefix##_merge_sort_rec_(arr, temp, mid);                                 \
+        prefix##_merge_sort_rec_(arr + mid, temp, n - mid);                       \
+        if (!DS_CMP(LESS(arr[mid], arr[mid - 1]))) {                              \
+            return;   /* 이미 순서대로면 병합 생략 */                             \
+        }                                                                         \
+        prefix##_merge_(arr, temp, mid, n);                                       \
+    }                                                                             \
+                                                                                  \
+    static inline bool prefix##_merge_sort(TYPE arr[], size_t n) {                \
+        if (n < 2) {                                                              \
+            return true;                                                          \
+        }                                                                         \
+        TYPE *temp = malloc((n / 2 + 1) * sizeof(TYPE));                          \
+        if (temp == NULL) {                                                       \
+            return false;                                                         \
+        }                                                                         \
+        prefix##_merge_sort_rec_(arr, temp, n);                                   \
+        free(temp);                                                               \
+        return true;                                                              \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_sift_down_(TYPE arr[], size_t n, size_t i) {      \
+        TYPE item = arr[i];                                                       \
+        size_t child;                                                             \
+        while ((child = 2 * i + 1) < n) {                                         \
+            if (child + 1 < n && DS_CMP(LESS(arr[child], arr[child + 1]))) {      \
+                child++;                                                          \
+            }                                                                     \
+            if (!DS_CMP(LESS(item, arr[child]))) {                                \
+                break;                                                            \
+            }                                                                     \
+            arr[i] = arr[child];                                                  \
+            DS_COUNT_MOVE(1);                                                     \
+            i = child;                                                            \
+        }                                                                         \
+        arr[i] = item;                                                            \
+        DS_COUNT_MOVE(1);                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_heap_sort(TYPE arr[], size_t n) {                 \
+        for (size_t i = n / 2; i-- > 0;) {                                        \
+            prefix##_sift_down_(arr, n, i);                                       \
+        }                                                                         \
+        for (size_t i = n; i-- > 1;) {                                            \
+            prefix##_swap_(&arr[0], &arr[i]);                                     \
+            prefix##_sift_down_(arr, i, 0);                                       \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_sort3_(TYPE *a, TYPE *b, TYPE *c) {               \
+        if (DS_CMP(LESS(*b, *a))) {                                               \
+            prefix##_swap_(a, b);                                                 \
+        }                                                                         \
+        if (DS_CMP(LESS(*c, *b))) {                                               \
+            prefix##_swap_(b, c);                                                 \
+        }                                                                         \
+        if (DS_CMP(LESS(*b, *a))) {                                               \
+            prefix##_swap_(a, b);                                                 \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    /* 피벗을 arr[0]으로 옮긴 뒤 Hoare 분할, 피벗의 최종 위치를 반환 */           \
+    static inline size_t prefix##_partition_(TYPE arr[], size_t n) {              \
+        size_t mid = n / 2;                                                       \
+        if (n > DS_SORT_NINTHER_THRESHOLD) {                                      \
+            size_t s = n / 8;                                                     \
+            prefix##_sort3_(&arr[0], &arr[s], &arr[2 * s]);                       \
+            prefix##_sort3_(&arr[mid - s], &arr[mid], &arr[mid + s]);             \
+            prefix##_sort3_(&arr[n - 1 - 2 * s], &arr[n - 1 - s], &arr[n - 1]);   \
+            prefix##_sort3_(&arr[s], &arr[mid], &arr[n - 1 - s]);                 \
+        } else {                                                                  \
+            prefix##_sort3_(&arr[0], &arr[mid], &arr[n - 1]);                     \
+        }                                                                         \
+        prefix##_swap_(&arr[0], &arr[mid]);                                       \
+                                                                                  \
+        TYPE pivot = arr[0];                                                      \
+        size_t i = 0, j = n;                                                      \
+        for (;;) {                                                                \
+            do {                                                                  \
+                i++;                                                              \
+            } while (i < n && DS_CMP(LESS(arr[i], pivot)));                       \
+            do {                                                                  \
+                j--;                                                              \
+            } while (DS_CMP(LESS(pivot, arr[j])));                                \
+            if (i >= j) {                                                         \
+                break;                                                            \
+            }                                                                     \
+            prefix##_swap_(&arr[i], &arr[j]);                                     \
+        }                                                                         \
+        prefix##_swap_(&arr[0], &arr[j]);                                         \
+        return j;                                                                 \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_intro_loop_(TYPE arr[], size_t n,                 \
+                                            unsigned depth_limit) {               \
+        while (n > DS_SORT_INSERTION_CUTOFF) {                                    \
+            if (depth_limit == 0) {                                               \
+                prefix##_heap_sort(arr, n);                                       \
+                return;                                                           \
+            }                                                                     \
+            depth_limit--;                                                        \
+            size_t p = prefix##_partition_(arr, n);                               \
+            if (p < n - p - 1) {                                                  \
+                prefix##_intro_loop_(arr, p, depth_limit);                        \
+                arr += p + 1;                                                     \
+                n -= p + 1;                                                       \
+            } else {                                                              \
+                prefix##_intro_loop_(arr + p + 1, n - p - 1, depth_limit);        \
+                n = p;                                                            \
+            }                                                                     \
+        }                                                                         \
+        prefix##_insertion_sort(arr, n);                                          \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_quick_sort(TYPE arr[], size_t n) {                \
+        unsigned depth_limit = 0;                                                 \
+        for (size_t m = n; m > 1; m >>= 1) {                                      \
+            depth_limit += 2;                                                     \
+        }                                                                         \
+        prefix##_intro_loop_(arr, n, depth_limit);                                \
+    }
+
+#define DS_RADIX_DIGIT_BITS 11
+#define DS_RADIX_DIGIT_BUCKETS (1u << DS_RADIX_DIGIT_BITS)
+#define DS_RADIX_DIGIT_PASSES 6   // 11 × 5 + 9비트 = 64비트
+
+/**
+ * DS_DEFINE_RADIX_SORT(prefix, TYPE, KEY): bool prefix_radix_sort(TYPE arr[], size_t n) 생성
+ * KEY(a)는 TYPE 값의 uint64_t 정렬 키 (필드 접근처럼 싼 식이어야 함: 패스마다 다시 계산)
+ * 원소 전체를 자릿수 순서로 이동하는 안정 LSD 정렬, 모든 키가 한 버킷인 자릿수는 생략
+ */
+#define DS_DEFINE_RADIX_SORT(prefix, TYPE, KEY)                                   \
+    static inline bool prefix##_radix_sort(TYPE arr[], size_t n) {                \
+        if (n < 2) {                                                              \
+            return true;                                                          \
+        }                                                                         \
+        if (n > SIZE_MAX / sizeof(TYPE)) {                                        \
+            return false;                                                         \
+        }                                                                         \
+        size_t (*count)[DS_RADIX_DIGIT_BUCKETS] =                                 \
+            calloc(DS_RADIX_DIGIT_PASSES, sizeof(*count));                        \
+        TYPE *buffer = malloc(n * sizeof(TYPE));                                  \
+        if (count == NULL || buffer == NULL) {                                    \
+            free(count);                                                          \
+            free(buffer);                                                         \
+            return false;                                                         \
+        }                                                                         \
+        const uint64_t mask = DS_RADIX_DIGIT_BUCKETS - 1;                         \
+        for (size_t i = 0; i < n; i++) {                                          \
+            uint64_t k = (uint64_t)(KEY(arr[i]));                                 \
+            for (int p = 0; p < DS_RADIX_DIGIT_PASSES; p++) {                     \
+                count[p][(k >> (p * DS_RADIX_DIGIT_BITS)) & mask]++;              \
+            }                                                                     \
+        }                                                                         \
+                                                                                  \
+        TYPE *src = arr, *dst = buffer;                                           \
+        for (int p = 0; p < DS_RADIX_DIGIT_PASSES; p++) {                         \
+            unsigned shift = (unsigned)(p * DS_RADIX_DIGIT_BITS);                 \
+            size_t *c = count[p];                                                 \
+            if (c[((uint64_t)(KEY(src[0])) >> shift) & mask] == n) {              \
+                continue;                                                         \
+            }                                                                     \
+            size_t offset = 0;                                                    \
+            for (size_t d = 0; d < DS_RADIX_DIGIT_BUCKETS; d++) {                 \
+                size_t bucket = c[d];                                             \
+                c[d] = offset;                                                    \
+                offset += bucket;                                                 \
+            }                                                                     \
+            for (size_t i = 0; i < n; i++) {                                      \
+                dst[c[((uint64_t)(KEY(src[i])) >> shift) & mask]++] = src[i];     \
+            }                                                                     \
+            DS_COUNT_MOVE(n);                                                     \
+            TYPE *swap = src;                                                     \
+            src = dst;                                                            \
+            dst = swap;                                                           \
+        }                                                                         \
+        if (src != arr) {                                                         \
+            memcpy(arr, src, n * sizeof(TYPE));                                   \
+            DS_COUNT_MOVE(n);                                                     \
+        }                                                                         \
+        free(count);                                                              \
+        free(buffer);                                                             \
+        return true;                                                              \
+    }
+
+#endif // DS_GENERIC_SORT_H
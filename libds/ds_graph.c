@@ -0,0 +1,194 @@
+/*
+ * ds_graph.c: 인접 리스트 그래프와 탐색/최단 경로
+ */
+
+#include "ds_graph.h"
+#include "ds_dary_heap.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DS_GRAPH_INIT_EDGES 16
+
+// 다익스트라 힙의 자식 수 (-DDS_DIJKSTRA_HEAP_ARITY=2로 이진 힙)
+#ifndef DS_DIJKSTRA_HEAP_ARITY
+#define DS_DIJKSTRA_HEAP_ARITY 4
+#endif
+
+bool ds_graph_init(DsGraph *g, int num_vertices) {
+    g->num_vertices = num_vertices;
+    g->head = malloc((size_t)num_vertices * sizeof(int));
+    g->edges = NULL;
+    g->num_edges = 0;
+    g->edge_capacity = 0;
+    if (g->head == NULL && num_vertices > 0) {
+        return false;
+    }
+    for (int v = 0; v < num_vertices; v++) {
+        g->head[v] = -1;
+    }
+    return true;
+}
+
+void ds_graph_destroy(DsGraph *g) {
+    free(g->head);
+    free(g->edges);
+    g->head = NULL;
+    g->edges = NULL;
+    g->num_vertices = 0;
+    g->num_edges = 0;
+    g->edge_capacity = 0;
+}
+
+bool ds_graph_add_edge(DsGraph *g, int from, int to, int weight) {
+    if (g->num_edges == g->edge_capacity) {
+        size_t new_capacity = g->edge_capacity ? g->edge_capacity * 2 : DS_GRAPH_INIT_EDGES;
+        if (new_capacity > (size_t)INT_MAX) {
+            return false;   // next 필드(int)로 표현 가능한 범위
+        }
+        DsEdge *new_edges = realloc(g->edges, new_capacity * sizeof(DsEdge));
+        if (new_edges == NULL) {
+            return false;
+        }
+        g->edges = new_edges;
+        g->edge_capacity = new_capacity;
+    }
+
+    DsEdge *e = &g->edges[g->num_edges];
+    e->to = to;
+    e->weight = weight;
+    e->next = g->head[from];
+    g->head[from] = (int)g->num_edges;
+    g->num_edges++;
+    return true;
+}
+
+bool ds_graph_add_undirected_edge(DsGraph *g, int v1, int v2, int weight) {
+    return ds_graph_add_edge(g, v1, v2, weight) && ds_graph_add_edge(g, v2, v1, weight);
+}
+
+size_t ds_graph_bfs(const DsGraph *g, int start, int order[]) {
+    unsigned char *visited = calloc((size_t)g->num_vertices, 1);
+    size_t front = 0, rear = 0;
+
+    if (visited == NULL) {
+        return 0;
+    }
+
+    // order 배열 자체를 큐로 사용 (방문 순서 = 큐 삽입 순서)
+    visited[start] = 1;
+    order[rear++] = start;
+    while (front < rear) {
+        int v = order[front++];
+        for (int e = g->head[v]; e != -1; e = g->edges[e].next) {
+            int w = g->edges[e].to;
+            if (!visited[w]) {
+                visited[w] = 1;
+                order[rear++] = w;
+            }
+        }
+    }
+
+    free(visited);
+    return rear;
+}
+
+size_t ds_graph_dfs(const DsGraph *g, int start, int order[]) {
+    size_t n = (size_t)g->num_vertices;
+    unsigned char *visited = calloc(n, 1);
+    int *vertex_stack = malloc(n * sizeof(int));
+    int *edge_stack = malloc(n * sizeof(int));   // 정점별 다음에 볼 간선
+    size_t top = 0, count = 0;
+
+    if (visited == NULL || vertex_stack == NULL || edge_stack == NULL) {
+        free(visited);
+        free(vertex_stack);
+        free(edge_stack);
+        return 0;
+    }
+
+    visited[start] = 1;
+    order[count++] = start;
+    vertex_stack[top] = start;
+    edge_stack[top] = g->head[start];
+    top++;
+
+    while (top > 0) {
+        int e = edge_stack[top - 1];
+        if (e == -1) {
+            top--;                              // 백트래킹
+            continue;
+        }
+        edge_stack[top - 1] = g->edges[e].next;
+        int w = g->edges[e].to;
+        if (!visited[w]) {
+            visited[w] = 1;
+            order[count++] = w;
+            vertex_stack[top] = w;
+            edge_stack[top] = g->head[w];
+            top++;
+        }
+    }
+
+    free(visited);
+    free(vertex_stack);
+    free(edge_stack);
+    return count;
+}
+
+// 힙 항목: 상위 32비트 거리, 하위 32비트 정점 → 정수 비교 한 번으로 정렬
+#define U64_BEFORE(a, b) ((a) < (b))
+
+DS_DEFINE_DARY_HEAP(dijkstra, uint64_t, DS_DIJKSTRA_HEAP_ARITY, U64_BEFORE)
+
+bool ds_graph_dijkstra(const DsGraph *g, int start, int distance[], int parent[]) {
+    size_t n = (size_t)g->num_vertices;
+    // 지연 삭제: 거리 갱신마다 1개씩 삽입 → 최대 E + 1개
+    dijkstra_DaryHeap heap;
+    unsigned char *done = calloc(n, 1);
+
+    dijkstra_dary_heap_init(&heap);
+    if (!dijkstra_dary_heap_reserve(&heap, (size_t)g->num_edges + 1) || done == NULL) {
+        dijkstra_dary_heap_destroy(&heap);
+        free(done);
+        return false;
+    }
+
+    for (size_t v = 0; v < n; v++) {
+        distance[v] = DS_GRAPH_INF;
+        if (parent != NULL) {
+            parent[v] = -1;
+        }
+    }
+    distance[start] = 0;
+    if (parent != NULL) {
+        parent[start] = start;
+    }
+    dijkstra_dary_heap_push(&heap, (uint64_t)(uint32_t)start);
+
+    uint64_t item;
+    while (dijkstra_dary_heap_pop(&heap, &item)) {
+        int u = (int)(item & 0xffffffffu);
+        if (done[u]) {
+            continue;   // 이미 확정된 정점의 낡은 항목
+        }
+        done[u] = 1;
+
+        for (int e = g->head[u]; e != -1; e = g->edges[e].next) {
+            int w = g->edges[e].to;
+            long long new_distance = (long long)distance[u] + g->edges[e].weight;
+            if (!done[w] && new_distance < distance[w]) {
+                distance[w] = (int)new_distance;
+                if (parent != NULL) {
+                    parent[w] = u;
+                }
+                dijkstra_dary_heap_push(&heap, ((uint64_t)new_distance << 32) | (uint32_t)w);
+            }
+        }
+    }
+
+    dijkstra_dary_heap_destroy(&heap);
+    free(done);
+    return true;
+}
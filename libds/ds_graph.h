@@ -0,0 +1,68 @@
+/**
+ * ds_graph.h: 인접 리스트 그래프 (chapter10, chapter11 기반)
+ *
+ * - 교재의 AdjNode 연결 리스트를 인덱스 기반 배열로 저장
+ *   (간선 노드를 개별 malloc하지 않음 → 할당 비용/메모리 단편화 감소)
+ * - 방향 그래프, 정점 0 ~ n-1, 가중치는 음이 아닌 int
+ * - 탐색 결과는 호출자가 제공한 배열에 기록 (출력 없음)
+ */
+
+#ifndef DS_GRAPH_H
+#define DS_GRAPH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <limits.h>
+
+#define DS_GRAPH_INF INT_MAX   // 도달 불가 거리
+
+typedef struct {
+    int to;        // 인접 정점
+    int weight;    // 간선 가중치
+    int next;      // 같은 정점의 다음 간선 인덱스 (-1: 끝)
+} DsEdge;
+
+typedef struct {
+    int num_vertices;
+    int *head;            // 정점별 첫 간선 인덱스 (-1: 없음)
+    DsEdge *edges;
+    size_t num_edges;
+    size_t edge_capacity;
+} DsGraph;
+
+/**
+ * 정점 n개짜리 빈 그래프를 만든다
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_graph_init(DsGraph *g, int num_vertices);
+void ds_graph_destroy(DsGraph *g);
+
+/**
+ * 방향 간선 추가 (교재와 같이 리스트 앞에 삽입)
+ */
+bool ds_graph_add_edge(DsGraph *g, int from, int to, int weight);
+bool ds_graph_add_undirected_edge(DsGraph *g, int v1, int v2, int weight);
+
+/**
+ * 너비 우선 탐색
+ * @param order 방문 순서를 기록할 배열 (크기 >= 정점 수)
+ * @return 방문한 정점 수 (메모리 부족 시 0)
+ */
+size_t ds_graph_bfs(const DsGraph *g, int start, int order[]);
+
+/**
+ * 깊이 우선 탐색 (명시적 스택, 재귀 버전과 같은 방문 순서)
+ * @return 방문한 정점 수 (메모리 부족 시 0)
+ */
+size_t ds_graph_dfs(const DsGraph *g, int start, int order[]);
+
+/**
+ * 다익스트라 최단 경로 (4진 힙, 지연 삭제) O(E log E)
+ * 힙이 간선 수만큼 커지므로, 정점당 항목 1개로 유지하려면 ds_index_heap.h로 직접 구현
+ * @param distance 정점별 최단 거리 (도달 불가: DS_GRAPH_INF)
+ * @param parent   최단 경로 트리의 부모 (시작 정점은 자기 자신, 도달 불가: -1, NULL 허용)
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_graph_dijkstra(const DsGraph *g, int start, int distance[], int parent[]);
+
+#endif // DS_GRAPH_H
@@ -0,0 +1,179 @@
+/*
+ * ds_heap.c: 이진 힙 (Min/Max)
+ *
+ * 비교 방향은 모드별로 따로 생성한 함수에서 상수로 고정하여
+ * 루프 안에서 모드를 다시 검사하지 않는다.
+ */
+
+#include "ds_heap.h"
+#include "ds_sort.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define DS_HEAP_INIT_CAPACITY 16
+
+// BEFORE(a, b): a가 b보다 루트 쪽에 있어야 하면 참
+#define DEFINE_HEAP_SIFT(suffix, BEFORE)                                  \
+    static void sift_up_##suffix(int *data, size_t i, int item) {         \
+        while (i > 0 && BEFORE(item, data[(i - 1) / 2])) {                \
+            data[i] = data[(i - 1) / 2];                                  \
+            i = (i - 1) / 2;                                              \
+        }                                                                 \
+        data[i] = item;                                                   \
+    }                                                                     \
+                                                                          \
+    static void sift_down_##suffix(int *data, size_t size, size_t i,      \
+                                   int item) {                            \
+        size_t child;                                                     \
+        while ((child = 2 * i + 1) < size) {                              \
+            if (child + 1 < size && BEFORE(data[child + 1], data[child])) { \
+                child++;                                                  \
+            }                                                             \
+            if (!BEFORE(data[child], item)) {                             \
+                break;                                                    \
+            }                                                             \
+            data[i] = data[child];                                        \
+            i = child;                                                    \
+        }                                                                 \
+        data[i] = item;                                                   \
+    }
+
+#define MAX_BEFORE(a, b) ((a) > (b))
+#define MIN_BEFORE(a, b) ((a) < (b))
+
+DEFINE_HEAP_SIFT(max, MAX_BEFORE)
+DEFINE_HEAP_SIFT(min, MIN_BEFORE)
+
+void ds_heap_init(DsHeap *h, DsHeapOrder order) {
+    h->data = NULL;
+    h->size = 0;
+    h->capacity = 0;
+    h->order = order;
+}
+
+void ds_heap_destroy(DsHeap *h) {
+    free(h->data);
+    ds_heap_init(h, h->order);
+}
+
+bool ds_heap_reserve(DsHeap *h, size_t capacity) {
+    if (capacity < DS_HEAP_INIT_CAPACITY) {
+        capacity = DS_HEAP_INIT_CAPACITY;
+    }
+    if (capacity <= h->capacity) {
+        return true;
+    }
+    if (capacity > SIZE_MAX / sizeof(int)) {
+        return false;
+    }
+
+    int *new_data = realloc(h->data, capacity * sizeof(int));
+    if (new_data == NULL) {
+        return false;
+    }
+    h->data = new_data;
+    h->capacity = capacity;
+    return true;
+}
+
+bool ds_heap_push(DsHeap *h, int item) {
+    if (h->size == h->capacity && !ds_heap_reserve(h, h->capacity * 2)) {
+        return false;
+    }
+    size_t i = h->size++;
+    if (h->order == DS_HEAP_MAX) {
+        sift_up_max(h->data, i, item);
+    } else {
+        sift_up_min(h->data, i, item);
+    }
+    return true;
+}
+
+bool ds_heap_pop(DsHeap *h, int *item) {
+    if (h->size == 0) {
+        return false;
+    }
+    *item = h->data[0];
+    int last = h->data[--h->size];
+    if (h->size > 0) {
+        if (h->order == DS_HEAP_MAX) {
+            sift_down_max(h->data, h->size, 0, last);
+        } else {
+            sift_down_min(h->data, h->size, 0, last);
+        }
+    }
+    return true;
+}
+
+bool ds_heap_build(DsHeap *h, const int items[], size_t n) {
+    if (!ds_heap_reserve(h, n)) {
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        h->data[i] = items[i];
+    }
+    h->size = n;
+
+    // 마지막 비리프 노드부터 하향 이동
+    for (size_t i = n / 2; i-- > 0;) {
+        if (h->order == DS_HEAP_MAX) {
+            sift_down_max(h->data, n, i, h->data[i]);
+        } else {
+            sift_down_min(h->data, n, i, h->data[i]);
+        }
+    }
+    return true;
+}
+
+bool ds_heap_replace_top(DsHeap *h, int item, int *old) {
+    if (h->size == 0) {
+        return false;
+    }
+    *old = h->data[0];
+    if (h->order == DS_HEAP_MAX) {
+        sift_down_max(h->data, h->size, 0, item);
+    } else {
+        sift_down_min(h->data, h->size, 0, item);
+    }
+    return true;
+}
+
+// ==================== 상위 k개 ====================
+
+bool ds_topk_init(DsTopK *t, size_t k) {
+    ds_heap_init(&t->heap, DS_HEAP_MIN);
+    t->k = k;
+    return k == 0 || ds_heap_reserve(&t->heap, k);
+}
+
+void ds_topk_destroy(DsTopK *t) {
+    ds_heap_destroy(&t->heap);
+}
+
+void ds_topk_push_many(DsTopK *t, const int items[], size_t n) {
+    size_t i = 0;
+    // 처음 k개는 모아서 O(k)로 힙 구성
+    if (t->heap.size == 0 && t->k > 0) {
+        size_t fill = n < t->k ? n : t->k;
+        ds_heap_build(&t->heap, items, fill);
+        i = fill;
+    }
+    for (; i < n; i++) {
+        ds_topk_push(t, items[i]);
+    }
+}
+
+size_t ds_topk_result(const DsTopK *t, int out[]) {
+    size_t count = t->heap.size;
+    for (size_t i = 0; i < count; i++) {
+        out[i] = t->heap.data[i];
+    }
+    ds_intro_sort(out, count);
+    for (size_t i = 0, j = count; i + 1 < j; i++, j--) {   // 오름차순 → 내림차순
+        int temp = out[i];
+        out[i] = out[j - 1];
+        out[j - 1] = temp;
+    }
+    return count;
+}
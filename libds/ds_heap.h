@@ -0,0 +1,121 @@
+/**
+ * ds_heap.h: 이진 힙 우선순위 큐 (chapter09/heap.c 기반)
+ *
+ * - 교재의 고정 크기 Max-Heap을 동적 배열로 확장, Min/Max 모드 선택
+ * - 0-based 인덱스: 부모 (i-1)/2, 자식 2i+1, 2i+2
+ * - ds_heap_build: 배열로부터 O(n) 상향식 구성
+ * - DsTopK: 크기 k Min-Heap으로 스트림의 가장 큰 k개 유지 (ds_sort.h의 ds_nth_element와 짝)
+ */
+
+#ifndef DS_HEAP_H
+#define DS_HEAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum {
+    DS_HEAP_MAX,   // 루트가 최댓값
+    DS_HEAP_MIN    // 루트가 최솟값
+} DsHeapOrder;
+
+typedef struct {
+    int *data;
+    size_t size;
+    size_t capacity;
+    DsHeapOrder order;
+} DsHeap;
+
+void ds_heap_init(DsHeap *h, DsHeapOrder order);
+void ds_heap_destroy(DsHeap *h);
+bool ds_heap_reserve(DsHeap *h, size_t capacity);
+
+/**
+ * 요소 삽입 (상향 이동) O(log n)
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_heap_push(DsHeap *h, int item);
+
+/**
+ * 루트 삭제 (하향 이동) O(log n)
+ * @return 성공 시 true, 공백이면 false
+ */
+bool ds_heap_pop(DsHeap *h, int *item);
+
+/**
+ * 배열 전체를 힙에 담고 O(n)으로 힙 성질을 만든다 (기존 내용은 버림)
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_heap_build(DsHeap *h, const int items[], size_t n);
+
+/**
+ * 루트를 꺼내고 item을 넣는 것을 하향 이동 한 번으로 처리 O(log n)
+ * (pop 후 push보다 비교가 절반, 크기는 그대로)
+ * @return 성공 시 true, 공백이면 false
+ */
+bool ds_heap_replace_top(DsHeap *h, int item, int *old);
+
+static inline bool ds_heap_is_empty(const DsHeap *h) {
+    return h->size == 0;
+}
+
+static inline size_t ds_heap_size(const DsHeap *h) {
+    return h->size;
+}
+
+static inline bool ds_heap_peek(const DsHeap *h, int *item) {
+    if (h->size == 0) {
+        return false;
+    }
+    *item = h->data[0];
+    return true;
+}
+
+// ==================== 상위 k개 (스트림) ====================
+
+/**
+ * 지금까지 본 값 중 가장 큰 k개 (chapter09 힙 응용)
+ * 루트가 k번째로 큰 값인 Min-Heap: 루트 이하인 값은 비교 한 번으로 버리고,
+ * 더 큰 값만 루트와 교체한다. 원소당 최악 O(log k), 메모리 O(k)
+ * 전체가 배열에 있으면 ds_nth_element(arr, n, n - k)가 O(n)으로 더 빠르다.
+ */
+typedef struct {
+    DsHeap heap;   // 크기 <= k, DS_HEAP_MIN
+    size_t k;
+} DsTopK;
+
+/**
+ * @return 성공 시 true, 메모리 부족 시 false (k개 공간을 미리 확보)
+ */
+bool ds_topk_init(DsTopK *t, size_t k);
+void ds_topk_destroy(DsTopK *t);
+
+static inline void ds_topk_push(DsTopK *t, int item) {
+    if (t->heap.size < t->k) {
+        ds_heap_push(&t->heap, item);   // init에서 k개를 확보했으므로 실패하지 않음
+    } else if (t->k > 0 && item > t->heap.data[0]) {
+        int dropped;
+        ds_heap_replace_top(&t->heap, item, &dropped);
+    }
+}
+
+void ds_topk_push_many(DsTopK *t, const int items[], size_t n);
+
+/**
+ * 현재 k번째로 큰 값 (이보다 작거나 같은 값은 결과에 들어가지 않음)
+ * @return 아직 k개가 모이지 않았으면 false
+ */
+static inline bool ds_topk_threshold(const DsTopK *t, int *item) {
+    if (t->k == 0 || t->heap.size < t->k) {
+        return false;
+    }
+    *item = t->heap.data[0];
+    return true;
+}
+
+/**
+ * 결과를 내림차순으로 out에 복사 (상태는 그대로, 계속 push 가능) O(k log k)
+ * @return 복사한 개수 (min(k, 지금까지 push한 개수))
+ */
+size_t ds_topk_result(const DsTopK *t, int out[]);
+
+#endif // DS_HEAP_H
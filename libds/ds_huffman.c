@@ -0,0 +1,875 @@
+/*
+ * ds_huffman.c: 블록 단위 정규 허프만 압축/복원
+ *
+ * 블록 하나의 처리 순서
+ *   압축: 빈도(히스토그램 4개) → 코드 길이(두 큐 병합 + 길이 제한) → 정규 코드
+ *         → 페이로드 비트 수를 미리 계산해 원본 저장이 나은지 판단 → 비트 버퍼로 출력
+ *   복원: 코드 길이 → 복호 표 (다음 11비트로 한 번 조회, 짧은 코드는 기호 최대 3개)
+ *         → 표 조회 루프, 블록 끝 몇 기호만 정규 코드를 한 비트씩 복호
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ds_huffman.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STREAM_MAGIC       "DSHF"
+#define STREAM_VERSION     1
+#define STREAM_HEADER_SIZE 5                          // 매직 4 + 버전 1
+#define BLOCK_HEADER_SIZE  5                          // 원본 크기 4 + 방식 1
+#define LENGTHS_SIZE       (DS_HUFFMAN_SYMBOLS / 2)   // 코드 길이 4비트씩
+#define HUFFMAN_HEADER_SIZE (LENGTHS_SIZE + 4)        // 코드 길이 + 페이로드 크기
+#define END_MARKER_SIZE    4
+#define BIT_SLACK          8   // 비트 버퍼가 8바이트씩 쓰므로 페이로드 뒤에 필요한 여유
+
+enum {
+    MODE_HUFFMAN = 0,
+    MODE_RAW = 1,
+};
+
+
+// ==================== 리틀 엔디언 입출력 ====================
+
+static inline void store_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline uint32_t load_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline void store_le32(uint8_t *p, uint32_t v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(p, &v, sizeof(v));
+#else
+    store_u32(p, v);
+#endif
+}
+
+static inline void store_le64(uint8_t *p, uint64_t v) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(p, &v, sizeof(v));   // 정렬되지 않은 8바이트 쓰기 한 번
+#else
+    for (int i = 0; i < 8; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+#endif
+}
+
+static inline uint64_t load_le64(const uint8_t *p) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+#else
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) {
+        v |= (uint64_t)p[i] << (8 * i);
+    }
+    return v;
+#endif
+}
+
+
+// ==================== 코드 길이 / 정규 코드 ====================
+
+void ds_huffman_build_lengths(const uint32_t freq[DS_HUFFMAN_SYMBOLS], unsigned max_len,
+                              uint8_t lengths[DS_HUFFMAN_SYMBOLS]) {
+    uint16_t symbols[DS_HUFFMAN_SYMBOLS];
+    uint64_t weight[2 * DS_HUFFMAN_SYMBOLS];
+    uint16_t parent[2 * DS_HUFFMAN_SYMBOLS];
+    uint16_t depth[2 * DS_HUFFMAN_SYMBOLS];
+    size_t k = 0;
+
+    memset(lengths, 0, DS_HUFFMAN_SYMBOLS);
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        if (freq[s] > 0) {
+            symbols[k++] = (uint16_t)s;
+        }
+    }
+    if (k <= 1) {
+        if (k == 1) {
+            lengths[symbols[0]] = 1;   // 기호 하나도 1비트 코드 (복호기가 길이 0을 받지 않도록)
+        }
+        return;
+    }
+
+    // 빈도 오름차순 (같으면 기호 순) - k ≤ 256이므로 삽입 정렬
+    for (size_t i = 1; i < k; i++) {
+        uint16_t s = symbols[i];
+        size_t j = i;
+        while (j > 0 && freq[symbols[j - 1]] > freq[s]) {
+            symbols[j] = symbols[j - 1];
+            j--;
+        }
+        symbols[j] = s;
+    }
+
+    // 두 큐 병합: 리프(정렬됨)와 내부 노드(만든 순서 = 무게 오름차순) 앞에서 가장 작은 둘을 합침
+    // 노드 0 ~ k-1: 리프, k ~ 2k-2: 내부 노드 (부모 번호는 항상 자식보다 큼)
+    for (size_t i = 0; i < k; i++) {
+        weight[i] = freq[symbols[i]];
+    }
+    size_t leaf = 0, inner = k;
+    for (size_t next = k; next < 2 * k - 1; next++) {
+        size_t pick[2];
+        for (int j = 0; j < 2; j++) {
+            if (leaf < k && (inner >= next || weight[leaf] <= weight[inner])) {
+                pick[j] = leaf++;
+            } else {
+                pick[j] = inner++;
+            }
+        }
+        weight[next] = weight[pick[0]] + weight[pick[1]];
+        parent[pick[0]] = parent[pick[1]] = (uint16_t)next;
+    }
+    depth[2 * k - 2] = 0;
+    for (size_t i = 2 * k - 2; i-- > 0;) {
+        depth[i] = (uint16_t)(depth[parent[i]] + 1);
+    }
+
+    // 길이 제한: max_len보다 긴 코드를 max_len으로 자른 뒤 Kraft 합이 1이 될 때까지
+    // max_len 코드 하나를 없애고 더 짧은 코드 하나를 한 단계 길게 나눈다 (코드 수 유지)
+    unsigned count[DS_HUFFMAN_MAX_CODE_LEN + 1] = {0};
+    for (size_t i = 0; i < k; i++) {
+        count[depth[i] < max_len ? depth[i] : max_len]++;
+    }
+    uint32_t total = 0;
+    for (unsigned len = 1; len <= max_len; len++) {
+        total += (uint32_t)count[len] << (max_len - len);
+    }
+    while (total > (1u << max_len)) {
+        count[max_len]--;
+        for (unsigned len = max_len - 1; len > 0; len--) {
+            if (count[len] > 0) {
+                count[len]--;
+                count[len + 1] += 2;
+                break;
+            }
+        }
+        total--;
+    }
+
+    // 빈도가 작은 기호부터 긴 코드
+    size_t i = 0;
+    for (unsigned len = max_len; len > 0; len--) {
+        for (unsigned c = 0; c < count[len]; c++) {
+            lengths[symbols[i++]] = (uint8_t)len;
+        }
+    }
+}
+
+bool ds_huffman_canonical_codes(const uint8_t lengths[DS_HUFFMAN_SYMBOLS],
+                                uint16_t codes[DS_HUFFMAN_SYMBOLS]) {
+    unsigned count[DS_HUFFMAN_MAX_CODE_LEN + 1] = {0};
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        if (lengths[s] > DS_HUFFMAN_MAX_CODE_LEN) {
+            return false;
+        }
+        count[lengths[s]]++;
+    }
+    count[0] = 0;
+
+    // 길이 len의 첫 코드 = (길이 len-1의 첫 코드 + 그 개수) << 1
+    uint32_t next[DS_HUFFMAN_MAX_CODE_LEN + 1];
+    uint32_t code = 0;
+    int32_t left = 1;   // 아직 쓰지 않은 코드 공간 (길이 len 단위)
+    for (unsigned len = 1; len <= DS_HUFFMAN_MAX_CODE_LEN; len++) {
+        code = (code + count[len - 1]) << 1;
+        next[len] = code;
+        left = left * 2 - (int32_t)count[len];
+        if (left < 0) {
+            return false;   // 초과 할당 (접두사 코드가 될 수 없음)
+        }
+    }
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        codes[s] = lengths[s] ? (uint16_t)next[lengths[s]]++ : 0;
+    }
+    return true;
+}
+
+// 하위 len비트를 뒤집는다 (정규 코드는 상위 비트부터, 비트 버퍼는 하위 비트부터 쌓음)
+static inline uint32_t reverse_bits(uint32_t code, unsigned len) {
+    uint32_t reversed = 0;
+    for (unsigned i = 0; i < len; i++) {
+        reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    return reversed;
+}
+
+static void pack_lengths(const uint8_t lengths[DS_HUFFMAN_SYMBOLS], uint8_t *out) {
+    for (size_t i = 0; i < LENGTHS_SIZE; i++) {
+        out[i] = (uint8_t)(lengths[2 * i] | lengths[2 * i + 1] << 4);
+    }
+}
+
+static void unpack_lengths(const uint8_t *in, uint8_t lengths[DS_HUFFMAN_SYMBOLS]) {
+    for (size_t i = 0; i < LENGTHS_SIZE; i++) {
+        lengths[2 * i] = in[i] & 15;
+        lengths[2 * i + 1] = in[i] >> 4;
+    }
+}
+
+
+// ==================== 블록 압축 ====================
+
+// 히스토그램 4개에 번갈아 세어 같은 칸을 연속으로 증가시키는 저장-적재 의존을 줄인다
+static void count_bytes(const uint8_t *src, size_t n, uint32_t freq[DS_HUFFMAN_SYMBOLS]) {
+    uint32_t partial[4][DS_HUFFMAN_SYMBOLS] = {{0}};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        partial[0][src[i]]++;
+        partial[1][src[i + 1]]++;
+        partial[2][src[i + 2]]++;
+        partial[3][src[i + 3]]++;
+    }
+    for (; i < n; i++) {
+        partial[0][src[i]]++;
+    }
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        freq[s] = partial[0][s] + partial[1][s] + partial[2][s] + partial[3][s];
+    }
+}
+
+/**
+ * 블록 하나(n ≤ DS_HUFFMAN_BLOCK_SIZE)를 dst에 기록
+ * @return 기록한 바이트 수, 공간 부족이면 0
+ *         허프만 방식이면 기록한 끝 뒤로 BIT_SLACK바이트까지 덮어쓸 수 있다
+ */
+static size_t encode_block(const uint8_t *src, size_t n, uint8_t *dst, size_t capacity) {
+    uint32_t freq[DS_HUFFMAN_SYMBOLS];
+    uint8_t lengths[DS_HUFFMAN_SYMBOLS];
+    uint16_t codes[DS_HUFFMAN_SYMBOLS];
+
+    count_bytes(src, n, freq);
+    ds_huffman_build_lengths(freq, DS_HUFFMAN_MAX_CODE_LEN, lengths);
+    ds_huffman_canonical_codes(lengths, codes);
+
+    uint64_t payload_bits = 0;
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        payload_bits += (uint64_t)freq[s] * lengths[s];
+    }
+    size_t payload_bytes = (size_t)((payload_bits + 7) / 8);
+    size_t huffman_size = BLOCK_HEADER_SIZE + HUFFMAN_HEADER_SIZE + payload_bytes;
+
+    store_u32(dst, (uint32_t)n);   // capacity ≥ BLOCK_HEADER_SIZE는 호출 측이 보장
+    if (huffman_size >= BLOCK_HEADER_SIZE + n) {
+        if (capacity < BLOCK_HEADER_SIZE + n) {
+            return 0;
+        }
+        dst[4] = MODE_RAW;
+        memcpy(dst + BLOCK_HEADER_SIZE, src, n);
+        return BLOCK_HEADER_SIZE + n;
+    }
+    if (capacity < huffman_size + BIT_SLACK) {
+        return 0;
+    }
+    dst[4] = MODE_HUFFMAN;
+    pack_lengths(lengths, dst + BLOCK_HEADER_SIZE);
+    store_u32(dst + BLOCK_HEADER_SIZE + LENGTHS_SIZE, (uint32_t)payload_bytes);
+
+    // 표 한 칸 = (길이 << 16) | 뒤집은 코드
+    uint32_t table[DS_HUFFMAN_SYMBOLS];
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        table[s] = (uint32_t)lengths[s] << 16 | reverse_bits(codes[s], lengths[s]);
+    }
+
+    // 64비트 버퍼: 기호 3개(최대 45비트)를 쌓고 남은 비트(최대 7) + 45 ≤ 64일 때 8바이트 출력,
+    // 완성된 바이트만큼 포인터를 전진 (분기 없음)
+    uint8_t *out = dst + BLOCK_HEADER_SIZE + HUFFMAN_HEADER_SIZE;
+    uint64_t bits = 0;
+    unsigned count = 0;
+    size_t i = 0;
+    for (; i + 3 <= n; i += 3) {
+        uint32_t a = table[src[i]];
+        uint32_t b = table[src[i + 1]];
+        uint32_t c = table[src[i + 2]];
+        bits |= (uint64_t)(a & 0xFFFF) << count;
+        count += a >> 16;
+        bits |= (uint64_t)(b & 0xFFFF) << count;
+        count += b >> 16;
+        bits |= (uint64_t)(c & 0xFFFF) << count;
+        count += c >> 16;
+        store_le64(out, bits);
+        out += count >> 3;
+        bits >>= count & ~7u;
+        count &= 7;
+    }
+    for (; i < n; i++) {
+        uint32_t a = table[src[i]];
+        bits |= (uint64_t)(a & 0xFFFF) << count;
+        count += a >> 16;
+        store_le64(out, bits);
+        out += count >> 3;
+        bits >>= count & ~7u;
+        count &= 7;
+    }
+    if (count > 0) {
+        store_le64(out, bits);   // 마지막 불완전 바이트 (나머지 비트는 0)
+        out++;
+    }
+    return huffman_size;
+}
+
+
+// ==================== 블록 복원 ====================
+
+// 정규 코드 복호 정보: 길이별 코드 수와 (길이, 기호) 순으로 늘어놓은 기호
+// (표 복호가 끝낸 뒤 블록 끝의 몇 기호만 이 방식으로 푼다)
+typedef struct {
+    uint16_t count[DS_HUFFMAN_MAX_CODE_LEN + 1];
+    uint8_t symbols[DS_HUFFMAN_SYMBOLS];
+} CanonicalDecoder;
+
+static bool decoder_init(CanonicalDecoder *d, const uint8_t lengths[DS_HUFFMAN_SYMBOLS]) {
+    uint16_t codes[DS_HUFFMAN_SYMBOLS];
+    if (!ds_huffman_canonical_codes(lengths, codes)) {
+        return false;
+    }
+    uint16_t offset[DS_HUFFMAN_MAX_CODE_LEN + 2];
+    memset(d->count, 0, sizeof(d->count));
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        d->count[lengths[s]]++;
+    }
+    d->count[0] = 0;
+    offset[1] = 0;
+    for (unsigned len = 1; len <= DS_HUFFMAN_MAX_CODE_LEN; len++) {
+        offset[len + 1] = (uint16_t)(offset[len] + d->count[len]);
+    }
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        if (lengths[s] > 0) {
+            d->symbols[offset[lengths[s]]++] = (uint8_t)s;
+        }
+    }
+    return true;
+}
+
+/*
+ * 표 복호: 비트 버퍼의 하위 DECODE_TABLE_BITS비트로 1차 표를 한 번 조회한다.
+ *
+ *   항목 (32비트) = 기호0 | 기호1 << 8 | 기호2 << 16 | 소비 비트 수 << 24 | 기호 수 << 29
+ *
+ * - 11비트 안에 코드가 여러 개 들어가면 (짧은 코드) 기호를 최대 3개까지 한 항목에 담는다.
+ *   복호기는 항목의 하위 4바이트를 그대로 출력에 쓰고 기호 수만큼만 전진한다.
+ * - 11비트보다 긴 코드: 1차 항목은 기호 수 0, 하위 16비트 = 2차 표 시작 위치,
+ *   소비 비트 수 자리 = 2차 표 색인 비트 수. 2차 항목은 기호 하나와 코드 전체 길이.
+ * - 항목 0: 없는 코드 (불완전 코드 공간, 손상된 입력)
+ */
+#define DECODE_TABLE_BITS  11
+#define DECODE_MAX_SYMBOLS 3
+#define DECODE_SECONDARY_SIZE \
+    (DS_HUFFMAN_SYMBOLS << (DS_HUFFMAN_MAX_CODE_LEN - DECODE_TABLE_BITS))
+
+#define ENTRY(symbols, length, count) \
+    ((uint32_t)(symbols) | (uint32_t)(length) << 24 | (uint32_t)(count) << 29)
+#define ENTRY_LENGTH(e) ((e) >> 24 & 31)
+#define ENTRY_COUNT(e)  ((e) >> 29)
+
+typedef struct {
+    uint32_t primary[1u << DECODE_TABLE_BITS];
+    uint32_t secondary[DECODE_SECONDARY_SIZE];   // 긴 코드는 최대 256개 → 접두사도 최대 256개
+} DecodeTable;
+
+typedef struct {
+    uint32_t code;     // 뒤집은 코드 (비트 버퍼에서 읽히는 순서)
+    uint8_t length;
+    uint8_t symbol;
+} ShortCode;
+
+// code로 시작하는 모든 색인(하위 len비트 = code)에 entry를 기록
+static void table_fill(uint32_t table[], unsigned table_bits, uint32_t code, unsigned len,
+                       uint32_t entry) {
+    for (uint32_t i = code; i < (1u << table_bits); i += 1u << len) {
+        table[i] = entry;
+    }
+}
+
+/**
+ * 앞에 기호 count개(used비트, 뒤집은 코드 prefix)가 온 색인 영역에 다음 기호를 붙인 항목을 기록
+ * 얕은 항목을 먼저 쓰고 더 긴 조합으로 덮어쓴다. 한 단계에서 쓰는 색인은 서로 겹치지 않으므로
+ * (Kraft 부등식) 단계마다 최대 2^DECODE_TABLE_BITS번 기록한다.
+ */
+static void fill_short_codes(uint32_t primary[], const ShortCode list[], size_t k,
+                             uint32_t prefix, unsigned used, uint32_t symbols, unsigned count) {
+    for (size_t j = 0; j < k && used + list[j].length <= DECODE_TABLE_BITS; j++) {
+        uint32_t code = prefix | list[j].code << used;
+        unsigned total = used + list[j].length;
+        uint32_t extended = symbols | (uint32_t)list[j].symbol << (8 * count);
+        table_fill(primary, DECODE_TABLE_BITS, code, total, ENTRY(extended, total, count + 1));
+        if (count + 1 < DECODE_MAX_SYMBOLS) {
+            fill_short_codes(primary, list, k, code, total, extended, count + 1);
+        }
+    }
+}
+
+static bool decode_table_init(DecodeTable *t, const uint8_t lengths[DS_HUFFMAN_SYMBOLS]) {
+    uint16_t codes[DS_HUFFMAN_SYMBOLS];
+    if (!ds_huffman_canonical_codes(lengths, codes)) {
+        return false;
+    }
+    memset(t->primary, 0, sizeof(t->primary));
+
+    // 짧은 코드를 길이 오름차순으로 (조합을 만들 때 길이 초과에서 바로 멈추도록)
+    ShortCode list[DS_HUFFMAN_SYMBOLS];
+    size_t k = 0;
+    unsigned max_len = 0;
+    for (unsigned len = 1; len <= DECODE_TABLE_BITS; len++) {
+        for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+            if (lengths[s] == len) {
+                list[k++] = (ShortCode){reverse_bits(codes[s], len), (uint8_t)len, (uint8_t)s};
+            }
+        }
+    }
+    for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+        max_len = lengths[s] > max_len ? lengths[s] : max_len;
+    }
+
+    // 긴 코드: 앞 11비트(접두사)가 같은 코드끼리 2차 표 하나 (색인 = 다음 max_len - 11비트)
+    if (max_len > DECODE_TABLE_BITS) {
+        unsigned sub_bits = max_len - DECODE_TABLE_BITS;
+        uint32_t next_table = 0;
+        for (size_t s = 0; s < DS_HUFFMAN_SYMBOLS; s++) {
+            if (lengths[s] <= DECODE_TABLE_BITS) {
+                continue;
+            }
+            uint32_t code = reverse_bits(codes[s], lengths[s]);
+            uint32_t prefix = code & ((1u << DECODE_TABLE_BITS) - 1);
+            if (t->primary[prefix] == 0) {
+                t->primary[prefix] = ENTRY(next_table, sub_bits, 0);
+                memset(&t->secondary[next_table], 0, sizeof(uint32_t) << sub_bits);
+                next_table += 1u << sub_bits;
+            }
+            uint32_t base = t->primary[prefix] & 0xFFFF;
+            table_fill(&t->secondary[base], sub_bits, code >> DECODE_TABLE_BITS,
+                       lengths[s] - DECODE_TABLE_BITS, ENTRY(s, lengths[s], 1));
+        }
+    }
+
+    // 짧은 코드는 긴 코드의 접두사가 될 수 없으므로 2차 표 연결 칸과 겹치지 않는다
+    fill_short_codes(t->primary, list, k, 0, 0, 0, 0);
+    return true;
+}
+
+// 비트 읽기 (하위 비트부터): 버퍼에 항상 DS_HUFFMAN_MAX_CODE_LEN비트 이상 채워 둔다
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint64_t bits;
+    unsigned count;
+    size_t padding;   // 입력 끝을 지나 0으로 채운 바이트 수
+} BitReader;
+
+static inline void reader_refill(BitReader *r) {
+    if (r->end - r->p >= 8) {
+        // 8바이트를 한 번에 읽고 빈자리만큼만 전진 (count는 56 ~ 63이 됨)
+        r->bits |= load_le64(r->p) << r->count;
+        r->p += (63 - r->count) >> 3;
+        r->count |= 56;
+        return;
+    }
+    while (r->count <= 56) {
+        if (r->p < r->end) {
+            r->bits |= (uint64_t)*r->p++ << r->count;
+        } else {
+            r->padding++;
+        }
+        r->count += 8;
+    }
+}
+
+/**
+ * 코드 한 개 복호 (한 비트씩 길이를 늘리며 "길이 len 코드의 범위 안인가" 확인)
+ * @return 기호, 없는 코드면 -1
+ */
+static inline int decode_symbol(const CanonicalDecoder *d, BitReader *r) {
+    uint64_t bits = r->bits;
+    int code = 0, first = 0, index = 0;
+    for (unsigned len = 1; len <= DS_HUFFMAN_MAX_CODE_LEN; len++) {
+        code |= (int)(bits & 1);
+        bits >>= 1;
+        int count = d->count[len];
+        if (code - first < count) {
+            r->bits = bits;
+            r->count -= len;
+            return d->symbols[index + code - first];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+/**
+ * 표 조회 한 번: 기호 1 ~ 3개를 dst + *i에 쓰고 (4바이트 쓰기) 비트를 소비한다.
+ * 비트 버퍼에 DS_HUFFMAN_MAX_CODE_LEN비트 이상 있어야 한다.
+ * @return 없는 코드면 false
+ */
+static inline bool decode_entry(const DecodeTable *t, BitReader *r, uint8_t *dst, size_t *i) {
+    uint32_t entry = t->primary[r->bits & ((1u << DECODE_TABLE_BITS) - 1)];
+    if (ENTRY_COUNT(entry) == 0) {
+        unsigned sub_bits = ENTRY_LENGTH(entry);
+        if (sub_bits == 0) {
+            return false;
+        }
+        entry = t->secondary[(entry & 0xFFFF)
+                             + ((r->bits >> DECODE_TABLE_BITS) & ((1u << sub_bits) - 1))];
+        if (entry == 0) {
+            return false;
+        }
+    }
+    store_le32(dst + *i, entry);   // 넷째 바이트는 다음 조회나 끝 처리가 덮어씀
+    *i += ENTRY_COUNT(entry);
+    r->bits >>= ENTRY_LENGTH(entry);
+    r->count -= ENTRY_LENGTH(entry);
+    return true;
+}
+
+static bool decode_huffman_block(const uint8_t *header, const uint8_t *payload,
+                                 size_t payload_bytes, uint8_t *dst, size_t n) {
+    uint8_t lengths[DS_HUFFMAN_SYMBOLS];
+    DecodeTable table;
+    CanonicalDecoder tail;
+    unpack_lengths(header, lengths);
+    if (!decode_table_init(&table, lengths) || !decoder_init(&tail, lengths)) {
+        return false;
+    }
+
+    BitReader r = {payload, payload + payload_bytes, 0, 0, 0};
+    size_t i = 0;
+    // 채우기 한 번(56비트 이상)으로 조회 3번 (코드 ≤ 15비트): 채울지 묻는 분기를 없앤다.
+    // 조회 한 번에 기호 최대 3개 + 4바이트 쓰기이므로 3번이면 출력이 10바이트 이상 남아야 함
+    while (n - i >= 3 * DECODE_MAX_SYMBOLS + 1 && r.end - r.p >= 8) {
+        reader_refill(&r);
+        if (!decode_entry(&table, &r, dst, &i) || !decode_entry(&table, &r, dst, &i)
+            || !decode_entry(&table, &r, dst, &i)) {
+            return false;
+        }
+    }
+    while (n - i >= DECODE_MAX_SYMBOLS + 1) {
+        if (r.count < DS_HUFFMAN_MAX_CODE_LEN) {
+            reader_refill(&r);
+        }
+        if (!decode_entry(&table, &r, dst, &i)) {
+            return false;
+        }
+    }
+    for (; i < n; i++) {
+        if (r.count < DS_HUFFMAN_MAX_CODE_LEN) {
+            reader_refill(&r);
+        }
+        int symbol = decode_symbol(&tail, &r);
+        if (symbol < 0) {
+            return false;
+        }
+        dst[i] = (uint8_t)symbol;
+    }
+    // 읽은 비트가 페이로드 안이어야 한다 (0으로 채운 부분까지 썼으면 잘린 입력)
+    uint64_t consumed = ((uint64_t)(r.p - payload) + r.padding) * 8 - r.count;
+    return consumed <= (uint64_t)payload_bytes * 8;
+}
+
+
+// ==================== 메모리 ↔ 메모리 ====================
+
+size_t ds_huffman_compress_bound(size_t n) {
+    size_t blocks = n / DS_HUFFMAN_BLOCK_SIZE + 1;
+    return STREAM_HEADER_SIZE + blocks * BLOCK_HEADER_SIZE + n + END_MARKER_SIZE + BIT_SLACK;
+}
+
+bool ds_huffman_compress(const uint8_t *src, size_t n, uint8_t *dst, size_t capacity,
+                         size_t *out_size) {
+    if (capacity < STREAM_HEADER_SIZE + END_MARKER_SIZE) {
+        return false;
+    }
+    memcpy(dst, STREAM_MAGIC, 4);
+    dst[4] = STREAM_VERSION;
+    size_t used = STREAM_HEADER_SIZE;
+    for (size_t offset = 0; offset < n; offset += DS_HUFFMAN_BLOCK_SIZE) {
+        size_t len = n - offset < DS_HUFFMAN_BLOCK_SIZE ? n - offset : DS_HUFFMAN_BLOCK_SIZE;
+        if (capacity - used < BLOCK_HEADER_SIZE + END_MARKER_SIZE) {
+            return false;
+        }
+        // 끝 표시 자리는 남겨 둔다 (비트 버퍼 여유는 그 자리와 겹쳐도 됨)
+        size_t written = encode_block(src + offset, len, dst + used, capacity - used);
+        if (written == 0 || capacity - used - written < END_MARKER_SIZE) {
+            return false;
+        }
+        used += written;
+    }
+    store_u32(dst + used, 0);
+    *out_size = used + END_MARKER_SIZE;
+    return true;
+}
+
+/**
+ * 블록 헤더 하나를 해석한다
+ * @param header_size 원본 크기/방식/코드 길이/페이로드 크기까지의 바이트 수
+ * @param body_size   그 뒤 페이로드(또는 원본) 바이트 수
+ * @return 형식 오류면 false (raw_size = 0이면 끝 표시, 나머지 출력은 무의미)
+ */
+static bool parse_block(const uint8_t *p, size_t available, uint32_t *raw_size, int *mode,
+                        size_t *header_size, size_t *body_size) {
+    if (available < END_MARKER_SIZE) {
+        return false;
+    }
+    *raw_size = load_u32(p);
+    if (*raw_size == 0) {
+        *header_size = END_MARKER_SIZE;
+        *body_size = 0;
+        return true;
+    }
+    if (*raw_size > DS_HUFFMAN_BLOCK_SIZE || available < BLOCK_HEADER_SIZE) {
+        return false;
+    }
+    *mode = p[4];
+    if (*mode == MODE_RAW) {
+        *header_size = BLOCK_HEADER_SIZE;
+        *body_size = *raw_size;
+    } else if (*mode == MODE_HUFFMAN) {
+        if (available < BLOCK_HEADER_SIZE + HUFFMAN_HEADER_SIZE) {
+            return false;
+        }
+        *header_size = BLOCK_HEADER_SIZE + HUFFMAN_HEADER_SIZE;
+        *body_size = load_u32(p + BLOCK_HEADER_SIZE + LENGTHS_SIZE);
+        if (*body_size > *raw_size) {
+            return false;   // 압축기는 작아질 때만 허프만 방식을 쓴다
+        }
+    } else {
+        return false;
+    }
+    return available - *header_size >= *body_size;
+}
+
+static bool check_stream_header(const uint8_t *p, size_t n) {
+    return n >= STREAM_HEADER_SIZE && memcmp(p, STREAM_MAGIC, 4) == 0 && p[4] == STREAM_VERSION;
+}
+
+bool ds_huffman_decompressed_size(const uint8_t *src, size_t n, size_t *size) {
+    if (!check_stream_header(src, n)) {
+        return false;
+    }
+    size_t pos = STREAM_HEADER_SIZE;
+    size_t total = 0;
+    for (;;) {
+        uint32_t raw_size;
+        int mode;
+        size_t header_size, body_size;
+        if (!parse_block(src + pos, n - pos, &raw_size, &mode, &header_size, &body_size)) {
+            return false;
+        }
+        if (raw_size == 0) {
+            *size = total;
+            return true;
+        }
+        total += raw_size;
+        pos += header_size + body_size;
+    }
+}
+
+bool ds_huffman_decompress(const uint8_t *src, size_t n, uint8_t *dst, size_t capacity,
+                           size_t *out_size) {
+    if (!check_stream_header(src, n)) {
+        return false;
+    }
+    size_t pos = STREAM_HEADER_SIZE;
+    size_t total = 0;
+    for (;;) {
+        uint32_t raw_size;
+        int mode;
+        size_t header_size, body_size;
+        if (!parse_block(src + pos, n - pos, &raw_size, &mode, &header_size, &body_size)) {
+            return false;
+        }
+        if (raw_size == 0) {
+            *out_size = total;
+            return true;
+        }
+        if (capacity - total < raw_size) {
+            return false;
+        }
+        const uint8_t *body = src + pos + header_size;
+        if (mode == MODE_RAW) {
+            memcpy(dst + total, body, raw_size);
+        } else if (!decode_huffman_block(src + pos + BLOCK_HEADER_SIZE, body, body_size,
+                                         dst + total, raw_size)) {
+            return false;
+        }
+        total += raw_size;
+        pos += header_size + body_size;
+    }
+}
+
+
+// ==================== 파일 ====================
+
+static bool read_exact(FILE *in, uint8_t *buffer, size_t n) {
+    if (fread(buffer, 1, n, in) == n) {
+        return true;
+    }
+    if (!ferror(in)) {
+        errno = EINVAL;   // 블록 중간에서 파일이 끝남
+    }
+    return false;
+}
+
+static bool compress_stream(FILE *in, FILE *out, uint8_t *block, uint8_t *packed,
+                            size_t packed_capacity, DsHuffmanStats *stats) {
+    uint8_t header[STREAM_HEADER_SIZE];
+    memcpy(header, STREAM_MAGIC, 4);
+    header[4] = STREAM_VERSION;
+    if (fwrite(header, 1, STREAM_HEADER_SIZE, out) != STREAM_HEADER_SIZE) {
+        return false;
+    }
+    stats->output_bytes += STREAM_HEADER_SIZE;
+
+    size_t n;
+    while ((n = fread(block, 1, DS_HUFFMAN_BLOCK_SIZE, in)) > 0) {
+        size_t written = encode_block(block, n, packed, packed_capacity);
+        if (fwrite(packed, 1, written, out) != written) {
+            return false;
+        }
+        stats->input_bytes += n;
+        stats->output_bytes += written;
+        stats->blocks++;
+        stats->raw_blocks += packed[4] == MODE_RAW;
+    }
+    if (ferror(in)) {
+        return false;
+    }
+    uint8_t end[END_MARKER_SIZE];
+    store_u32(end, 0);
+    if (fwrite(end, 1, END_MARKER_SIZE, out) != END_MARKER_SIZE) {
+        return false;
+    }
+    stats->output_bytes += END_MARKER_SIZE;
+    return true;
+}
+
+static bool decompress_stream(FILE *in, FILE *out, uint8_t *block, uint8_t *packed,
+                              DsHuffmanStats *stats) {
+    uint8_t header[BLOCK_HEADER_SIZE + HUFFMAN_HEADER_SIZE];
+    if (!read_exact(in, header, STREAM_HEADER_SIZE)) {
+        return false;
+    }
+    if (!check_stream_header(header, STREAM_HEADER_SIZE)) {
+        errno = EINVAL;
+        return false;
+    }
+    stats->input_bytes += STREAM_HEADER_SIZE;
+
+    for (;;) {
+        uint32_t raw_size;
+        int mode;
+        size_t header_size, body_size;
+        // 끝 표시(4바이트)인지 먼저 보고, 아니면 나머지 헤더를 읽어 parse_block으로 검사
+        if (!read_exact(in, header, END_MARKER_SIZE)) {
+            return false;
+        }
+        size_t have = END_MARKER_SIZE;
+        if (load_u32(header) != 0) {
+            if (!read_exact(in, header + have, 1)) {
+                return false;
+            }
+            have++;
+            if (header[4] == MODE_HUFFMAN) {
+                if (!read_exact(in, header + have, HUFFMAN_HEADER_SIZE)) {
+                    return false;
+                }
+                have += HUFFMAN_HEADER_SIZE;
+            }
+        }
+        // 본문은 아직 읽지 않았으므로 가용 크기를 "헤더 + 최대 본문"으로 두고 형식만 검사
+        if (!parse_block(header, have + DS_HUFFMAN_BLOCK_SIZE, &raw_size, &mode, &header_size,
+                         &body_size)
+            || header_size != have) {
+            errno = EINVAL;
+            return false;
+        }
+        stats->input_bytes += have;
+        if (raw_size == 0) {
+            return true;
+        }
+
+        if (!read_exact(in, packed, body_size)) {
+            return false;
+        }
+        stats->input_bytes += body_size;
+        const uint8_t *data = packed;
+        if (mode == MODE_HUFFMAN) {
+            if (!decode_huffman_block(header + BLOCK_HEADER_SIZE, packed, body_size, block,
+                                      raw_size)) {
+                errno = EINVAL;
+                return false;
+            }
+            data = block;
+        } else {
+            stats->raw_blocks++;
+        }
+        if (fwrite(data, 1, raw_size, out) != raw_size) {
+            return false;
+        }
+        stats->output_bytes += raw_size;
+        stats->blocks++;
+    }
+}
+
+typedef enum {
+    COMPRESS,
+    DECOMPRESS,
+} Direction;
+
+static bool process_file(const char *input_path, const char *output_path, Direction direction,
+                         DsHuffmanStats *stats) {
+    DsHuffmanStats local_stats;
+    if (stats == NULL) {
+        stats = &local_stats;
+    }
+    memset(stats, 0, sizeof(*stats));
+
+    size_t packed_capacity = BLOCK_HEADER_SIZE + DS_HUFFMAN_BLOCK_SIZE + BIT_SLACK;
+    uint8_t *block = malloc(DS_HUFFMAN_BLOCK_SIZE);
+    uint8_t *packed = malloc(packed_capacity);
+    if (block == NULL || packed == NULL) {
+        free(block);
+        free(packed);
+        return false;
+    }
+    FILE *in = fopen(input_path, "rb");
+    FILE *out = in != NULL ? fopen(output_path, "wb") : NULL;
+
+    bool ok = in != NULL && out != NULL
+              && (direction == COMPRESS
+                      ? compress_stream(in, out, block, packed, packed_capacity, stats)
+                      : decompress_stream(in, out, block, packed, stats));
+
+    int saved_errno = errno;   // 정리 중 호출로 원인이 덮이지 않도록
+    if (in != NULL) {
+        fclose(in);
+    }
+    if (out != NULL && fclose(out) != 0 && ok) {
+        ok = false;
+        saved_errno = errno;
+    }
+    free(block);
+    free(packed);
+    errno = saved_errno;
+    return ok;
+}
+
+bool ds_huffman_compress_file(const char *input_path, const char *output_path,
+                              DsHuffmanStats *stats) {
+    return process_file(input_path, output_path, COMPRESS, stats);
+}
+
+bool ds_huffman_decompress_file(const char *input_path, const char *output_path,
+                                DsHuffmanStats *stats) {
+    return process_file(input_path, output_path, DECOMPRESS, stats);
+}
@@ -0,0 +1,98 @@
+/**
+ * ds_huffman.h: 허프만 파일 압축기 (정규 허프만 코드 + 64비트 비트 버퍼)
+ *
+ * chapter09/huffman.c는 코드를 '0'/'1' 문자열로 출력하고 이론 압축률만 계산한다.
+ * 이 모듈은 실제로 바이트 스트림을 압축/복원한다.
+ *
+ * 1) 입력을 DS_HUFFMAN_BLOCK_SIZE 블록으로 나눠 블록마다 바이트 빈도를 센다
+ *    (스트림을 한 번만 읽고, 데이터 성격이 바뀌면 블록마다 코드가 따라감)
+ * 2) 빈도로 코드 길이를 구하고 DS_HUFFMAN_MAX_CODE_LEN 이하로 제한한다
+ * 3) 코드 자체 대신 "기호별 코드 길이"만 헤더에 기록한다 (정규 코드: 길이만으로 코드가 정해짐)
+ * 4) 코드를 64비트 비트 버퍼에 쌓아 8바이트씩 한 번에 출력한다 (LSB 우선)
+ * 5) 복원은 블록마다 코드 길이로 복호 표를 만들어 다음 11비트로 한 번 조회한다.
+ *    11비트 안에 코드가 여러 개 들어가면 기호를 최대 3개까지 한 번에 내고,
+ *    12 ~ 15비트 코드는 앞 11비트가 같은 코드끼리 묶은 2차 표로 한 번 더 조회한다.
+ * 압축해도 작아지지 않는 블록(이미 압축된 데이터 등)은 원본 그대로 저장한다.
+ *
+ * 스트림 형식 (정수는 리틀 엔디언):
+ *   "DSHF" 버전(1바이트)
+ *   블록 × k : 원본 크기(u32, 0이면 끝) 방식(u8)
+ *              방식 0 (허프만): 코드 길이 256개 (4비트씩, 128바이트) 페이로드 크기(u32) 페이로드
+ *              방식 1 (원본)  : 원본 바이트
+ *   끝 표시   : 원본 크기 0 (u32)
+ *
+ *   size_t capacity = ds_huffman_compress_bound(n);
+ *   ds_huffman_compress(src, n, dst, capacity, &packed);
+ *   ds_huffman_decompressed_size(dst, packed, &n);
+ *   ds_huffman_decompress(dst, packed, out, n, &n);
+ */
+
+#ifndef DS_HUFFMAN_H
+#define DS_HUFFMAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS_HUFFMAN_SYMBOLS     256
+#define DS_HUFFMAN_MAX_CODE_LEN 15           // 헤더에 4비트로 기록
+#define DS_HUFFMAN_BLOCK_SIZE  ((size_t)1 << 18)   // 256 KiB (빈도/코드 단위)
+
+typedef struct {
+    uint64_t input_bytes;    // 읽은 바이트
+    uint64_t output_bytes;   // 쓴 바이트
+    uint64_t blocks;         // 블록 수
+    uint64_t raw_blocks;     // 원본 그대로 저장한 블록 수
+} DsHuffmanStats;
+
+/**
+ * 빈도로 허프만 코드 길이를 구한다 (최대 max_len, 빈도 0인 기호는 길이 0)
+ * 기호가 하나뿐이면 그 기호의 길이는 1이다.
+ * @param max_len 1 ~ DS_HUFFMAN_MAX_CODE_LEN (쓰이는 기호 수 ≤ 2^max_len이어야 함)
+ */
+void ds_huffman_build_lengths(const uint32_t freq[DS_HUFFMAN_SYMBOLS], unsigned max_len,
+                              uint8_t lengths[DS_HUFFMAN_SYMBOLS]);
+
+/**
+ * 코드 길이로 정규(canonical) 코드를 만든다: 짧은 코드부터, 길이가 같으면 기호 순으로
+ * 연속된 값을 준다. codes[s]는 상위 비트부터 읽는 값이다 (길이 0인 기호는 0).
+ * @return 길이가 Kraft 부등식을 넘으면(접두사 코드가 아님) false
+ */
+bool ds_huffman_canonical_codes(const uint8_t lengths[DS_HUFFMAN_SYMBOLS],
+                                uint16_t codes[DS_HUFFMAN_SYMBOLS]);
+
+/**
+ * n바이트를 압축했을 때의 최대 크기 (모든 블록을 원본으로 저장 + 헤더 + 여유)
+ */
+size_t ds_huffman_compress_bound(size_t n);
+
+/**
+ * @param capacity dst 크기 (ds_huffman_compress_bound(n) 이상이면 항상 성공)
+ * @return 공간 부족이면 false
+ */
+bool ds_huffman_compress(const uint8_t *src, size_t n, uint8_t *dst, size_t capacity,
+                         size_t *out_size);
+
+/**
+ * 압축 스트림의 원본 크기 (블록 헤더만 훑음)
+ * @return 형식이 잘못되었으면 false
+ */
+bool ds_huffman_decompressed_size(const uint8_t *src, size_t n, size_t *size);
+
+/**
+ * @return 형식 오류, 손상된 페이로드, capacity 부족이면 false
+ */
+bool ds_huffman_decompress(const uint8_t *src, size_t n, uint8_t *dst, size_t capacity,
+                           size_t *out_size);
+
+/**
+ * 파일 단위 압축/복원 (블록 단위로 읽고 쓰므로 메모리는 블록 몇 개 분량)
+ * @param stats NULL 허용
+ * @return 성공 시 true, 입출력 오류/메모리 부족/형식 오류 시 false (errno 유지, 형식 오류는 EINVAL)
+ */
+bool ds_huffman_compress_file(const char *input_path, const char *output_path,
+                              DsHuffmanStats *stats);
+bool ds_huffman_decompress_file(const char *input_path, const char *output_path,
+                                DsHuffmanStats *stats);
+
+#endif // DS_HUFFMAN_H
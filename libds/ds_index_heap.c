@@ -0,0 +1,130 @@
+/*
+ * ds_index_heap.c: 색인 최소 힙 (위치 표로 O(log n) decrease-key)
+ */
+
+#include "ds_index_heap.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// i번 구멍에 node를 상향 이동으로 배치 (옮긴 원소마다 pos 갱신)
+static void sift_up(DsIndexHeap *h, size_t i, DsIndexHeapNode node) {
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (h->nodes[parent].key <= node.key) {
+            break;
+        }
+        h->nodes[i] = h->nodes[parent];
+        h->pos[h->nodes[i].id] = i;
+        i = parent;
+    }
+    h->nodes[i] = node;
+    h->pos[node.id] = i;
+}
+
+// i번 구멍에 node를 하향 이동으로 배치
+static void sift_down(DsIndexHeap *h, size_t i, DsIndexHeapNode node) {
+    size_t child;
+    while ((child = 2 * i + 1) < h->size) {
+        if (child + 1 < h->size && h->nodes[child + 1].key < h->nodes[child].key) {
+            child++;
+        }
+        if (node.key <= h->nodes[child].key) {
+            break;
+        }
+        h->nodes[i] = h->nodes[child];
+        h->pos[h->nodes[i].id] = i;
+        i = child;
+    }
+    h->nodes[i] = node;
+    h->pos[node.id] = i;
+}
+
+bool ds_index_heap_init(DsIndexHeap *h, size_t num_ids) {
+    h->nodes = NULL;
+    h->pos = NULL;
+    h->size = 0;
+    h->num_ids = 0;
+    if (num_ids > (size_t)INT_MAX + 1 || num_ids > SIZE_MAX / sizeof(DsIndexHeapNode)) {
+        return false;
+    }
+    size_t count = num_ids > 0 ? num_ids : 1;
+    h->nodes = malloc(count * sizeof(DsIndexHeapNode));
+    h->pos = malloc(count * sizeof(size_t));
+    if (h->nodes == NULL || h->pos == NULL) {
+        ds_index_heap_destroy(h);
+        return false;
+    }
+    for (size_t i = 0; i < num_ids; i++) {
+        h->pos[i] = DS_INDEX_HEAP_ABSENT;
+    }
+    h->num_ids = num_ids;
+    return true;
+}
+
+void ds_index_heap_destroy(DsIndexHeap *h) {
+    free(h->nodes);
+    free(h->pos);
+    h->nodes = NULL;
+    h->pos = NULL;
+    h->size = 0;
+    h->num_ids = 0;
+}
+
+void ds_index_heap_clear(DsIndexHeap *h) {
+    for (size_t i = 0; i < h->size; i++) {
+        h->pos[h->nodes[i].id] = DS_INDEX_HEAP_ABSENT;
+    }
+    h->size = 0;
+}
+
+bool ds_index_heap_push(DsIndexHeap *h, int id, int key) {
+    if (id < 0 || (size_t)id >= h->num_ids || h->pos[id] != DS_INDEX_HEAP_ABSENT) {
+        return false;
+    }
+    sift_up(h, h->size++, (DsIndexHeapNode){key, id});
+    return true;
+}
+
+bool ds_index_heap_pop(DsIndexHeap *h, int *id, int *key) {
+    if (h->size == 0) {
+        return false;
+    }
+    DsIndexHeapNode top = h->nodes[0];
+    if (id != NULL) {
+        *id = top.id;
+    }
+    if (key != NULL) {
+        *key = top.key;
+    }
+    h->pos[top.id] = DS_INDEX_HEAP_ABSENT;
+    h->size--;
+    if (h->size > 0) {
+        sift_down(h, 0, h->nodes[h->size]);
+    }
+    return true;
+}
+
+bool ds_index_heap_decrease_key(DsIndexHeap *h, int id, int key) {
+    if (!ds_index_heap_contains(h, id)) {
+        return false;
+    }
+    size_t i = h->pos[id];
+    if (key >= h->nodes[i].key) {
+        return false;
+    }
+    sift_up(h, i, (DsIndexHeapNode){key, id});
+    return true;
+}
+
+bool ds_index_heap_push_or_decrease(DsIndexHeap *h, int id, int key) {
+    if (id < 0 || (size_t)id >= h->num_ids) {
+        return false;
+    }
+    if (h->pos[id] == DS_INDEX_HEAP_ABSENT) {
+        sift_up(h, h->size++, (DsIndexHeapNode){key, id});
+        return true;
+    }
+    return ds_index_heap_decrease_key(h, id, key);
+}
@@ -0,0 +1,109 @@
+/**
+ * ds_index_heap.h: 색인 최소 힙 (indexed min-heap) - decrease-key 지원 우선순위 큐
+ *
+ * chapter11/dijkstra.c와 prim.c는 "정점 → 힙 위치" 표(pos)를 가진 같은 MinHeap을
+ * 각자 복사해 쓰고 있었다. 이 모듈은 그 구조를 한 곳에 모은 것이다.
+ *
+ *   nodes[i] = {key, id}  : 힙 배열 (비교할 키가 id와 같은 칸에 있어 하향 이동이 연속 접근)
+ *   pos[id]  = i          : id가 힙의 몇 번째 칸인지 (없으면 DS_INDEX_HEAP_ABSENT)
+ *
+ * - contains / key_of: pos 조회 한 번 O(1)
+ * - decrease_key: 위치를 찾지 않고 바로 상향 이동 O(log n)
+ * - 힙 크기는 id 개수 n 이하로 고정 (지연 삭제 힙은 간선 수 E까지 커짐)
+ * - 교재 버전과 달리 pop한 id의 pos를 지우므로, 꺼낸 정점을 다시 넣을 수 있다
+ *
+ *   DsIndexHeap h;
+ *   ds_index_heap_init(&h, num_vertices);
+ *   ds_index_heap_push_or_decrease(&h, v, new_distance);   // 없으면 삽입, 있으면 감소
+ *   ds_index_heap_pop(&h, &v, &d);
+ *   ds_index_heap_destroy(&h);
+ */
+
+#ifndef DS_INDEX_HEAP_H
+#define DS_INDEX_HEAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define DS_INDEX_HEAP_ABSENT ((size_t)-1)   // pos[id]: 힙에 없음
+
+typedef struct {
+    int key;   // 우선순위 (작을수록 루트 쪽)
+    int id;    // 0 ~ n-1
+} DsIndexHeapNode;
+
+typedef struct {
+    DsIndexHeapNode *nodes;
+    size_t *pos;
+    size_t size;
+    size_t num_ids;
+} DsIndexHeap;
+
+/**
+ * id 0 ~ num_ids-1을 담을 수 있는 빈 힙 (할당은 여기서 한 번만)
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_index_heap_init(DsIndexHeap *h, size_t num_ids);
+void ds_index_heap_destroy(DsIndexHeap *h);
+
+/**
+ * 모든 원소 제거 O(size) (pos 전체를 지우지 않으므로 반복 사용에 유리)
+ */
+void ds_index_heap_clear(DsIndexHeap *h);
+
+/**
+ * id를 key로 삽입 (상향 이동) O(log n)
+ * @return id가 범위 밖이거나 이미 힙에 있으면 false
+ */
+bool ds_index_heap_push(DsIndexHeap *h, int id, int key);
+
+/**
+ * 최소 키 원소를 꺼낸다 (하향 이동) O(log n)
+ * @param id, key NULL이면 버림
+ * @return 공백이면 false
+ */
+bool ds_index_heap_pop(DsIndexHeap *h, int *id, int *key);
+
+/**
+ * 힙에 있는 id의 키를 더 작은 값으로 바꾼다 (상향 이동) O(log n)
+ * @return id가 힙에 없거나 key가 현재 키보다 작지 않으면 false (힙은 그대로)
+ */
+bool ds_index_heap_decrease_key(DsIndexHeap *h, int id, int key);
+
+/**
+ * 다익스트라/프림의 완화 단계: id가 없으면 삽입, 있으면 더 작을 때만 감소
+ * @return 힙이 바뀌었으면 true (범위 밖 id, 감소가 아닌 경우 false)
+ */
+bool ds_index_heap_push_or_decrease(DsIndexHeap *h, int id, int key);
+
+static inline bool ds_index_heap_contains(const DsIndexHeap *h, int id) {
+    return id >= 0 && (size_t)id < h->num_ids && h->pos[id] != DS_INDEX_HEAP_ABSENT;
+}
+
+// 힙에 있는 id의 현재 키 (없으면 false)
+static inline bool ds_index_heap_key_of(const DsIndexHeap *h, int id, int *key) {
+    if (!ds_index_heap_contains(h, id)) {
+        return false;
+    }
+    *key = h->nodes[h->pos[id]].key;
+    return true;
+}
+
+static inline bool ds_index_heap_peek(const DsIndexHeap *h, int *id, int *key) {
+    if (h->size == 0) {
+        return false;
+    }
+    *id = h->nodes[0].id;
+    *key = h->nodes[0].key;
+    return true;
+}
+
+static inline size_t ds_index_heap_size(const DsIndexHeap *h) {
+    return h->size;
+}
+
+static inline bool ds_index_heap_is_empty(const DsIndexHeap *h) {
+    return h->size == 0;
+}
+
+#endif // DS_INDEX_HEAP_H
@@ -0,0 +1,202 @@
+/*
+ * ds_list.c: 단일/이중 연결 리스트
+ */
+
+#include "ds_list.h"
+
+#include <stdlib.h>
+
+// ==================== 단일 연결 리스트 ====================
+
+void ds_list_init(DsList *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+void ds_list_clear(DsList *list) {
+    DsListNode *p = list->head;
+    while (p != NULL) {
+        DsListNode *removed = p;
+        p = p->link;
+        free(removed);
+    }
+    ds_list_init(list);
+}
+
+bool ds_list_insert_first(DsList *list, int data) {
+    DsListNode *node = malloc(sizeof(DsListNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    node->link = list->head;
+    list->head = node;
+    if (list->tail == NULL) {
+        list->tail = node;
+    }
+    list->length++;
+    return true;
+}
+
+bool ds_list_insert_last(DsList *list, int data) {
+    DsListNode *node = malloc(sizeof(DsListNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    node->link = NULL;
+    if (list->tail != NULL) {
+        list->tail->link = node;
+    } else {
+        list->head = node;
+    }
+    list->tail = node;
+    list->length++;
+    return true;
+}
+
+bool ds_list_delete_first(DsList *list, int *data) {
+    DsListNode *removed = list->head;
+    if (removed == NULL) {
+        return false;
+    }
+    *data = removed->data;
+    list->head = removed->link;
+    if (list->head == NULL) {
+        list->tail = NULL;
+    }
+    list->length--;
+    free(removed);
+    return true;
+}
+
+DsListNode *ds_list_search(const DsList *list, int data) {
+    DsListNode *p = list->head;
+    while (p != NULL && p->data != data) {
+        p = p->link;
+    }
+    return p;
+}
+
+void ds_list_reverse(DsList *list) {
+    DsListNode *prev = NULL;
+    DsListNode *current = list->head;
+
+    list->tail = current;
+    while (current != NULL) {
+        DsListNode *next = current->link;
+        current->link = prev;
+        prev = current;
+        current = next;
+    }
+    list->head = prev;
+}
+
+// ==================== 이중 연결 리스트 ====================
+
+void ds_dlist_init(DsDList *list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+void ds_dlist_clear(DsDList *list) {
+    DsDListNode *p = list->head;
+    while (p != NULL) {
+        DsDListNode *removed = p;
+        p = p->next;
+        free(removed);
+    }
+    ds_dlist_init(list);
+}
+
+bool ds_dlist_insert_first(DsDList *list, int data) {
+    DsDListNode *node = malloc(sizeof(DsDListNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    node->prev = NULL;
+    node->next = list->head;
+    if (list->head != NULL) {
+        list->head->prev = node;
+    } else {
+        list->tail = node;
+    }
+    list->head = node;
+    list->length++;
+    return true;
+}
+
+bool ds_dlist_insert_last(DsDList *list, int data) {
+    DsDListNode *node = malloc(sizeof(DsDListNode));
+    if (node == NULL) {
+        return false;
+    }
+    node->data = data;
+    node->prev = list->tail;
+    node->next = NULL;
+    if (list->tail != NULL) {
+        list->tail->next = node;
+    } else {
+        list->head = node;
+    }
+    list->tail = node;
+    list->length++;
+    return true;
+}
+
+void ds_dlist_remove(DsDList *list, DsDListNode *node) {
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+    list->length--;
+    free(node);
+}
+
+bool ds_dlist_delete_first(DsDList *list, int *data) {
+    if (list->head == NULL) {
+        return false;
+    }
+    *data = list->head->data;
+    ds_dlist_remove(list, list->head);
+    return true;
+}
+
+bool ds_dlist_delete_last(DsDList *list, int *data) {
+    if (list->tail == NULL) {
+        return false;
+    }
+    *data = list->tail->data;
+    ds_dlist_remove(list, list->tail);
+    return true;
+}
+
+DsDListNode *ds_dlist_search(const DsDList *list, int data) {
+    DsDListNode *p = list->head;
+    while (p != NULL && p->data != data) {
+        p = p->next;
+    }
+    return p;
+}
+
+void ds_dlist_reverse(DsDList *list) {
+    DsDListNode *p = list->head;
+    while (p != NULL) {
+        DsDListNode *next = p->next;
+        p->next = p->prev;
+        p->prev = next;
+        p = next;
+    }
+    DsDListNode *temp = list->head;
+    list->head = list->tail;
+    list->tail = temp;
+}
@@ -0,0 +1,79 @@
+/**
+ * ds_list.h: 연결 리스트 (chapter06/singly_linked_list.c, chapter07/doubly_linked_list.c 기반)
+ *
+ * - DsList: 단일 연결 리스트 (tail 포인터 유지 → insert_last O(1))
+ * - DsDList: 이중 연결 리스트 (양쪽 끝 삽입/삭제 O(1))
+ * - 위치 인덱스 연산(get_entry 등)은 O(n)이므로 라이브러리에서 제외
+ */
+
+#ifndef DS_LIST_H
+#define DS_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// ==================== 단일 연결 리스트 ====================
+
+typedef struct DsListNode {
+    int data;
+    struct DsListNode *link;
+} DsListNode;
+
+typedef struct {
+    DsListNode *head;
+    DsListNode *tail;
+    size_t length;
+} DsList;
+
+void ds_list_init(DsList *list);
+void ds_list_clear(DsList *list);
+bool ds_list_insert_first(DsList *list, int data);
+bool ds_list_insert_last(DsList *list, int data);
+
+/**
+ * 첫 노드를 삭제하고 값을 반환한다
+ * @return 성공 시 true, 공백이면 false
+ */
+bool ds_list_delete_first(DsList *list, int *data);
+
+/**
+ * 값이 data인 첫 노드를 찾는다 (선형 탐색 O(n))
+ * @return 찾은 노드, 없으면 NULL
+ */
+DsListNode *ds_list_search(const DsList *list, int data);
+
+/**
+ * 리스트를 제자리에서 역순으로 만든다 O(n)
+ */
+void ds_list_reverse(DsList *list);
+
+// ==================== 이중 연결 리스트 ====================
+
+typedef struct DsDListNode {
+    int data;
+    struct DsDListNode *prev;
+    struct DsDListNode *next;
+} DsDListNode;
+
+typedef struct {
+    DsDListNode *head;
+    DsDListNode *tail;
+    size_t length;
+} DsDList;
+
+void ds_dlist_init(DsDList *list);
+void ds_dlist_clear(DsDList *list);
+bool ds_dlist_insert_first(DsDList *list, int data);
+bool ds_dlist_insert_last(DsDList *list, int data);
+bool ds_dlist_delete_first(DsDList *list, int *data);
+bool ds_dlist_delete_last(DsDList *list, int *data);
+
+/**
+ * 주어진 노드를 리스트에서 제거하고 해제한다 O(1)
+ */
+void ds_dlist_remove(DsDList *list, DsDListNode *node);
+
+DsDListNode *ds_dlist_search(const DsDList *list, int data);
+void ds_dlist_reverse(DsDList *list);
+
+#endif // DS_LIST_H
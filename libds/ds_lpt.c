@@ -0,0 +1,759 @@
+/*
+ * ds_lpt.c: 대규모 LPT 스케줄링 (기수 정렬 + 머신 힙 루트 교체 + 로컬 서치/MULTIFIT)
+ */
+
+#include "ds_lpt.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds_radix.h"
+#include "ds_thread_pool.h"
+
+#define LOCAL_SEARCH_MOVES_PER_MACHINE 16
+
+// 정렬 키 order[k]에서 작업 번호/처리 시간 꺼내기
+#define ORDER_JOB(key)  ((uint32_t)(key))
+#define ORDER_TIME(key) (UINT32_MAX - (uint32_t)((key) >> 32))
+
+
+// ==================== 1~2단계: LPT ====================
+
+typedef struct {
+    uint64_t load;
+    uint32_t id;
+} MachineSlot;
+
+// 부하가 같으면 번호가 작은 머신 우선 (결과를 결정적으로)
+static inline bool slot_before(MachineSlot a, MachineSlot b) {
+    return a.load < b.load || (a.load == b.load && a.id < b.id);
+}
+
+// 루트의 부하가 늘어난 뒤 하향 이동 (상향식: 작은 자식 쪽으로 리프까지 내린 뒤 거슬러 올라감)
+// 방금 작업을 받은 머신은 대개 가장 바쁜 축이 되어 리프 근처까지 내려가므로 비교가 절반
+// heap[m]은 보초 (부하 최대): 오른쪽 자식 범위 검사 없이 분기 없는 자식 선택
+static void sift_down_root(MachineSlot heap[], size_t m) {
+    MachineSlot item = heap[0];
+    size_t hole = 0;
+    size_t child;
+    while ((child = 2 * hole + 1) < m) {
+        child += slot_before(heap[child + 1], heap[child]);
+        heap[hole] = heap[child];
+        hole = child;
+    }
+    while (hole > 0 && slot_before(item, heap[(hole - 1) / 2])) {
+        heap[hole] = heap[(hole - 1) / 2];
+        hole = (hole - 1) / 2;
+    }
+    heap[hole] = item;
+}
+
+static void assign_lpt(const uint32_t times[], const uint64_t order[], size_t n, uint32_t m,
+                       MachineSlot heap[], uint32_t assignment[], uint64_t loads[]) {
+    for (uint32_t i = 0; i < m; i++) {
+        heap[i] = (MachineSlot){0, i};   // 부하 0, 번호 오름차순 → 이미 힙
+    }
+    heap[m] = (MachineSlot){UINT64_MAX, UINT32_MAX};
+    for (size_t k = 0; k < n; k++) {
+        uint32_t job = ORDER_JOB(order[k]);
+        assignment[job] = heap[0].id;
+        heap[0].load += times[job];
+        sift_down_root(heap, m);
+    }
+    for (uint32_t i = 0; i < m; i++) {
+        loads[heap[i].id] = heap[i].load;
+    }
+}
+
+static uint64_t max_load(const uint64_t loads[], uint32_t m) {
+    uint64_t result = 0;
+    for (uint32_t i = 0; i < m; i++) {
+        if (loads[i] > result) {
+            result = loads[i];
+        }
+    }
+    return result;
+}
+
+
+// ==================== MULTIFIT: FFD + 세그먼트 트리 ====================
+
+/**
+ * 용량 capacity인 상자 m개에 작업을 큰 것부터 "들어가는 첫 상자"에 넣는다 (FFD)
+ * tree: 크기 2·leaves, 노드 = 서브트리 상자들의 최대 남은 용량 → 첫 상자를 O(log m)에 찾음
+ * @param assignment NULL이면 가능 여부만 판정
+ * @return 모든 작업이 들어가면 true
+ */
+static bool ffd_fits(const uint64_t order[], size_t n, uint32_t m, uint64_t capacity,
+                     uint64_t tree[], size_t leaves, uint32_t assignment[]) {
+    for (size_t i = 0; i < leaves; i++) {
+        tree[leaves + i] = i < m ? capacity : 0;
+    }
+    for (size_t i = leaves; i-- > 1;) {
+        tree[i] = tree[2 * i] > tree[2 * i + 1] ? tree[2 * i] : tree[2 * i + 1];
+    }
+
+    for (size_t k = 0; k < n; k++) {
+        uint64_t t = ORDER_TIME(order[k]);
+        if (tree[1] < t) {
+            return false;   // 어느 상자에도 안 들어감 (작업이 내림차순이라 바로 판정)
+        }
+        size_t i = 1;
+        while (i < leaves) {
+            i = tree[2 * i] >= t ? 2 * i : 2 * i + 1;
+        }
+        if (assignment != NULL) {
+            assignment[ORDER_JOB(order[k])] = (uint32_t)(i - leaves);
+        }
+        tree[i] -= t;
+        for (i /= 2; i >= 1; i /= 2) {
+            tree[i] = tree[2 * i] > tree[2 * i + 1] ? tree[2 * i] : tree[2 * i + 1];
+        }
+    }
+    return true;
+}
+
+typedef struct {
+    const uint64_t *order;
+    size_t n;
+    uint32_t m;
+    size_t leaves;
+    uint64_t capacity;
+    uint64_t *tree;   // 작업마다 자기 트리
+    bool fits;
+} FfdProbe;
+
+static void ffd_probe_task(void *arg) {
+    FfdProbe *p = arg;
+    p->fits = ffd_fits(p->order, p->n, p->m, p->capacity, p->tree, p->leaves, NULL);
+}
+
+/**
+ * [lo, hi]에서 FFD가 성공하는 가장 작은 용량을 찾는다 (단계마다 probes개를 동시에 시험)
+ * FFD 성공 여부는 C에 대해 엄밀히 단조롭지 않지만, MULTIFIT과 같이 단조로 보고 탐색한다.
+ * @return 찾은 용량, 없으면 0
+ */
+static uint64_t multifit_search(const uint64_t order[], size_t n, uint32_t m, uint64_t lo,
+                                uint64_t hi, unsigned rounds, unsigned probes,
+                                DsThreadPool *pool, unsigned *num_probes) {
+    size_t leaves = 1;
+    while (leaves < m) {
+        leaves *= 2;
+    }
+    FfdProbe *tasks = malloc(probes * sizeof(FfdProbe));
+    uint64_t *trees = NULL;
+    if (tasks != NULL && probes <= SIZE_MAX / sizeof(uint64_t) / 2 / leaves) {
+        trees = malloc((size_t)probes * 2 * leaves * sizeof(uint64_t));
+    }
+    if (trees == NULL) {
+        free(tasks);
+        return 0;
+    }
+
+    uint64_t best = 0;
+    for (unsigned round = 0; round < rounds && lo <= hi; round++) {
+        // 구간을 probes + 1등분하는 점들 (구간이 좁으면 중복 없이 줄임)
+        uint64_t span = hi - lo + 1;
+        unsigned count = span < probes ? (unsigned)span : probes;
+        DsTaskGroup group = DS_TASK_GROUP_INIT;
+        for (unsigned j = 0; j < count; j++) {
+            uint64_t c = lo + span * (j + 1) / (count + 1);
+            tasks[j] = (FfdProbe){order, n, m, leaves, c, trees + (size_t)j * 2 * leaves, false};
+            if (pool != NULL && j + 1 < count) {
+                ds_thread_pool_submit(pool, &group, ffd_probe_task, &tasks[j]);
+            } else {
+                ffd_probe_task(&tasks[j]);
+            }
+        }
+        if (pool != NULL) {
+            ds_thread_pool_wait(pool, &group);
+        }
+        *num_probes += count;
+
+        // 성공한 가장 작은 C 아래, 실패한 가장 큰 C 위로 구간을 좁힘
+        uint64_t new_lo = lo;
+        uint64_t new_hi = hi;
+        for (unsigned j = 0; j < count; j++) {
+            if (tasks[j].fits) {
+                if (best == 0 || tasks[j].capacity < best) {
+                    best = tasks[j].capacity;
+                }
+                if (tasks[j].capacity - 1 < new_hi) {
+                    new_hi = tasks[j].capacity - 1;
+                }
+            }
+        }
+        for (unsigned j = 0; j < count; j++) {
+            if (!tasks[j].fits && tasks[j].capacity <= new_hi && tasks[j].capacity + 1 > new_lo) {
+                new_lo = tasks[j].capacity + 1;
+            }
+        }
+        lo = new_lo;
+        hi = new_hi;
+    }
+
+    free(trees);
+    free(tasks);
+    return best;
+}
+
+static bool refine_multifit(const uint32_t times[], const uint64_t order[], size_t n,
+                            uint32_t m, uint64_t lower_bound, const DsLptOptions *opt,
+                            unsigned num_threads, uint32_t assignment[], uint64_t loads[],
+                            DsLptReport *report) {
+    uint64_t current = max_load(loads, m);
+    if (current <= lower_bound) {
+        return true;   // 이미 최적
+    }
+
+    DsThreadPool *pool = NULL;
+    if (num_threads > 1) {
+        pool = ds_thread_pool_create(num_threads - 1);   // 호출 스레드 포함
+    }
+    unsigned probes = pool != NULL ? ds_thread_pool_num_workers(pool) + 1 : 1;
+    uint64_t best = multifit_search(order, n, m, lower_bound, current - 1, opt->multifit_rounds,
+                                    probes, pool, &report->multifit_probes);
+    ds_thread_pool_destroy(pool);
+    if (best == 0) {
+        return true;   // LPT보다 나은 용량 없음 (또는 시험용 메모리 부족: LPT 결과 유지)
+    }
+
+    size_t leaves = 1;
+    while (leaves < m) {
+        leaves *= 2;
+    }
+    uint64_t *tree = malloc(2 * leaves * sizeof(uint64_t));
+    if (tree == NULL) {
+        return true;
+    }
+    ffd_fits(order, n, m, best, tree, leaves, assignment);
+    free(tree);
+
+    memset(loads, 0, m * sizeof(uint64_t));
+    for (size_t i = 0; i < n; i++) {
+        loads[assignment[i]] += times[i];
+    }
+    return true;
+}
+
+
+// ==================== 로컬 서치: 최대 ↔ 최소 머신 이동/교환 ====================
+
+// 머신별 작업 목록 (처리 시간 내림차순 유지)
+typedef struct {
+    uint32_t *jobs;
+    size_t size;
+    size_t capacity;
+} JobList;
+
+static bool list_reserve(JobList *list, size_t capacity) {
+    if (capacity <= list->capacity) {
+        return true;
+    }
+    size_t grown_capacity = list->capacity ? list->capacity * 2 : 4;
+    if (grown_capacity < capacity) {
+        grown_capacity = capacity;
+    }
+    uint32_t *grown = realloc(list->jobs, grown_capacity * sizeof(uint32_t));
+    if (grown == NULL) {
+        return false;
+    }
+    list->jobs = grown;
+    list->capacity = grown_capacity;
+    return true;
+}
+
+// 용량이 확보된 목록에 처리 시간 순서를 지키며 삽입
+static void list_insert_sorted(JobList *list, uint32_t job, const uint32_t times[]) {
+    // 처리 시간이 job보다 작은 첫 위치 (이분 탐색)
+    size_t lo = 0, hi = list->size;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (times[list->jobs[mid]] >= times[job]) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    memmove(&list->jobs[lo + 1], &list->jobs[lo], (list->size - lo) * sizeof(uint32_t));
+    list->jobs[lo] = job;
+    list->size++;
+}
+
+static void list_remove(JobList *list, size_t index) {
+    memmove(&list->jobs[index], &list->jobs[index + 1],
+            (list->size - index - 1) * sizeof(uint32_t));
+    list->size--;
+}
+
+// 부하 차 gap을 줄이는 이동량 d (0 < d < gap), gap/2에 가까울수록 좋다
+static inline uint64_t move_gain(uint64_t d, uint64_t gap) {
+    return d == 0 || d >= gap ? 0 : (d < gap - d ? d : gap - d);
+}
+
+// 부하 토너먼트 트리: 노드마다 서브트리의 최대/최소 부하 머신 번호 → 조회 O(1), 갱신 O(log m)
+// 빈 리프(m 이상)는 머신 0을 가리킨다 (중복은 최대/최소에 영향 없음)
+typedef struct {
+    uint32_t *max_id;
+    uint32_t *min_id;
+    size_t leaves;
+} LoadTree;
+
+static void load_tree_pull(LoadTree *t, const uint64_t loads[], size_t i) {
+    uint32_t l = t->max_id[2 * i], r = t->max_id[2 * i + 1];
+    t->max_id[i] = loads[r] > loads[l] ? r : l;
+    l = t->min_id[2 * i];
+    r = t->min_id[2 * i + 1];
+    t->min_id[i] = loads[r] < loads[l] ? r : l;
+}
+
+static bool load_tree_init(LoadTree *t, const uint64_t loads[], uint32_t m) {
+    t->leaves = 1;
+    while (t->leaves < m) {
+        t->leaves *= 2;
+    }
+    t->max_id = malloc(2 * t->leaves * sizeof(uint32_t));
+    t->min_id = malloc(2 * t->leaves * sizeof(uint32_t));
+    if (t->max_id == NULL || t->min_id == NULL) {
+        free(t->max_id);
+        free(t->min_id);
+        return false;
+    }
+    for (size_t i = 0; i < t->leaves; i++) {
+        t->max_id[t->leaves + i] = t->min_id[t->leaves + i] = i < m ? (uint32_t)i : 0;
+    }
+    for (size_t i = t->leaves; i-- > 1;) {
+        load_tree_pull(t, loads, i);
+    }
+    return true;
+}
+
+static void load_tree_update(LoadTree *t, const uint64_t loads[], uint32_t id) {
+    for (size_t i = (t->leaves + id) / 2; i >= 1; i /= 2) {
+        load_tree_pull(t, loads, i);
+    }
+}
+
+/**
+ * 머신 a에서 b로 작업 하나를 옮기거나 두 작업을 맞바꿔 부하 차 gap을 가장 많이 줄이는 수
+ * @param best_y 교환이면 b 목록의 위치, 이동이면 SIZE_MAX
+ * @return 두 머신 중 큰 부하가 줄어드는 양 (0: 개선 불가)
+ */
+static uint64_t best_exchange(const JobList *la, const JobList *lb, uint64_t gap,
+                              const uint32_t times[], size_t *best_x, size_t *best_y) {
+    uint64_t half = gap / 2;
+    uint64_t best_gain = 0;
+    *best_x = SIZE_MAX;
+    *best_y = SIZE_MAX;
+
+    // 이동: 처리 시간이 gap/2에 가장 가까운 작업 (내림차순 목록에서 이분 탐색)
+    size_t lo = 0, hi = la->size;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (times[la->jobs[mid]] > half) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    for (size_t x = lo > 0 ? lo - 1 : 0; x < la->size && x <= lo; x++) {
+        uint64_t gain = move_gain(times[la->jobs[x]], gap);
+        if (gain > best_gain) {
+            best_gain = gain;
+            *best_x = x;
+        }
+    }
+
+    // 교환: x - y가 gap/2에 가장 가까운 쌍 (두 목록 모두 내림차순 → 투 포인터)
+    size_t y = 0;
+    for (size_t x = 0; x < la->size && best_gain < half; x++) {
+        uint64_t tx = times[la->jobs[x]];
+        while (y < lb->size && (uint64_t)times[lb->jobs[y]] + half > tx) {
+            y++;   // y가 너무 커서 d < gap/2
+        }
+        for (size_t c = y > 0 ? y - 1 : 0; c < lb->size && c <= y; c++) {
+            uint64_t ty = times[lb->jobs[c]];
+            uint64_t gain = tx > ty ? move_gain(tx - ty, gap) : 0;
+            if (gain > best_gain) {
+                best_gain = gain;
+                *best_x = x;
+                *best_y = c;
+            }
+        }
+    }
+    return best_gain;
+}
+
+/**
+ * 가장 무거운 머신 a의 부하를 줄이는 이동/교환을 반복한다.
+ * 짝은 가장 가벼운 머신부터 시험하고, 거기서 개선이 없으면 지난번 짝 다음 머신부터 한 바퀴 돈다
+ * (짝을 찾은 자리 근처에 또 있는 경우가 많음). 한 바퀴를 돌아도 없으면 국소 최적이다.
+ * 한 단계마다 a의 부하가 줄거나 최대 부하 머신 수가 줄어 makespan은 늘지 않는다.
+ */
+static bool refine_local_search(const uint32_t times[], const uint64_t order[], size_t n,
+                                uint32_t m, uint64_t lower_bound, const DsLptOptions *opt,
+                                uint32_t assignment[], uint64_t loads[], DsLptReport *report) {
+    if (max_load(loads, m) <= lower_bound) {
+        return true;   // 이미 최적 (목록을 만들 필요 없음)
+    }
+    JobList *lists = calloc(m, sizeof(JobList));
+    LoadTree tree;
+    if (lists == NULL || !load_tree_init(&tree, loads, m)) {
+        free(lists);
+        return false;
+    }
+    bool ok = true;
+    uint32_t cursor = 0;   // 마지막으로 시험한 짝 (다음 단계는 그다음부터)
+    for (size_t k = 0; k < n && ok; k++) {   // 내림차순으로 넣으므로 끝에 붙음
+        uint32_t job = ORDER_JOB(order[k]);
+        JobList *list = &lists[assignment[job]];
+        ok = list_reserve(list, list->size + 1);
+        if (ok) {
+            list->jobs[list->size++] = job;
+        }
+    }
+
+    size_t max_moves = opt->max_moves ? opt->max_moves
+                                      : (size_t)m * LOCAL_SEARCH_MOVES_PER_MACHINE;
+    while (ok && report->moves < max_moves) {
+        uint32_t a = tree.max_id[1];
+        uint32_t b = tree.min_id[1];
+        if (loads[a] <= lower_bound) {
+            break;   // 최적
+        }
+
+        size_t best_x = SIZE_MAX, best_y = SIZE_MAX;
+        uint64_t gain = loads[a] - loads[b] > 1
+                            ? best_exchange(&lists[a], &lists[b], loads[a] - loads[b], times,
+                                            &best_x, &best_y)
+                            : 0;
+        for (uint32_t k = 1; k < m && gain == 0; k++) {
+            cursor = cursor + 1 < m ? cursor + 1 : 0;
+            if (cursor != a && loads[cursor] + 1 < loads[a]) {
+                b = cursor;
+                gain = best_exchange(&lists[a], &lists[b], loads[a] - loads[b], times,
+                                     &best_x, &best_y);
+            }
+        }
+        if (gain == 0) {
+            break;   // 가장 무거운 머신을 가볍게 하는 이동/교환이 없음 (국소 최적)
+        }
+
+        // 목록을 고치기 전에 용량부터 확보 (실패해도 배정 상태가 어긋나지 않게)
+        JobList *la = &lists[a];
+        JobList *lb = &lists[b];
+        if (!list_reserve(lb, lb->size + 1)) {
+            ok = false;
+            break;
+        }
+        uint32_t job_x = la->jobs[best_x];
+        uint64_t d = times[job_x];
+        list_remove(la, best_x);
+        if (best_y != SIZE_MAX) {   // 교환: y는 a로 (a에서 하나 빠졌으므로 용량 충분)
+            uint32_t job_y = lb->jobs[best_y];
+            d -= times[job_y];
+            list_remove(lb, best_y);
+            list_insert_sorted(la, job_y, times);
+            assignment[job_y] = a;
+        }
+        list_insert_sorted(lb, job_x, times);
+        assignment[job_x] = b;
+        loads[a] -= d;
+        loads[b] += d;
+        load_tree_update(&tree, loads, a);
+        load_tree_update(&tree, loads, b);
+        report->moves++;
+    }
+
+    for (uint32_t i = 0; i < m; i++) {
+        free(lists[i].jobs);
+    }
+    free(lists);
+    free(tree.max_id);
+    free(tree.min_id);
+    return ok;
+}
+
+
+// ==================== 공개 함수 ====================
+
+bool ds_lpt_schedule(const uint32_t times[], size_t n, uint32_t m, uint32_t assignment[],
+                     uint64_t loads[], const DsLptOptions *opt, DsLptReport *report) {
+    static const DsLptOptions default_options = DS_LPT_OPTIONS_DEFAULT;
+    DsLptReport local_report;
+    if (opt == NULL) {
+        opt = &default_options;
+    }
+    if (report == NULL) {
+        report = &local_report;
+    }
+    memset(report, 0, sizeof(*report));
+    if (m == 0 || n > UINT32_MAX) {
+        return false;
+    }
+
+    unsigned num_threads = opt->num_threads ? opt->num_threads : ds_cpu_count();
+    uint64_t *order = malloc((n ? n : 1) * sizeof(uint64_t));
+    MachineSlot *heap = malloc(((size_t)m + 1) * sizeof(MachineSlot));   // + 보초
+    uint64_t *own_loads = loads == NULL ? malloc((size_t)m * sizeof(uint64_t)) : NULL;
+    if (loads == NULL) {
+        loads = own_loads;
+    }
+    if (order == NULL || heap == NULL || loads == NULL) {
+        free(order);
+        free(heap);
+        free(own_loads);
+        return false;
+    }
+
+    // 1단계: (~처리 시간, 작업 번호) 키를 오름차순 정렬 = 처리 시간 내림차순
+    uint64_t total = 0;
+    uint32_t longest = 0;
+    for (size_t i = 0; i < n; i++) {
+        order[i] = ((uint64_t)(UINT32_MAX - times[i]) << 32) | (uint64_t)i;
+        total += times[i];
+        longest = times[i] > longest ? times[i] : longest;
+    }
+    ds_msd_radix_sort_u64(order, n, num_threads);
+
+    // 하한: 평균 부하, 가장 긴 작업, (작업 > 머신이면) m번째 + m+1번째로 긴 작업
+    uint64_t lower_bound = (total + m - 1) / m;
+    if (longest > lower_bound) {
+        lower_bound = longest;
+    }
+    if (n > m) {
+        uint64_t pair = (uint64_t)ORDER_TIME(order[m - 1]) + ORDER_TIME(order[m]);
+        if (pair > lower_bound) {
+            lower_bound = pair;
+        }
+    }
+    report->total_time = total;
+    report->lower_bound = lower_bound;
+
+    // 2단계: 가장 긴 작업부터 가장 한가한 머신에
+    assign_lpt(times, order, n, m, heap, assignment, loads);
+    report->lpt_makespan = max_load(loads, m);
+
+    // 3단계: 개선
+    bool ok = true;
+    if (opt->refine & DS_LPT_REFINE_MULTIFIT) {
+        ok = refine_multifit(times, order, n, m, lower_bound, opt, num_threads, assignment, loads,
+                             report);
+    }
+    if (ok && (opt->refine & DS_LPT_REFINE_LOCAL_SEARCH)) {
+        ok = refine_local_search(times, order, n, m, lower_bound, opt, assignment, loads, report);
+    }
+    report->makespan = max_load(loads, m);
+
+    free(order);
+    free(heap);
+    free(own_loads);
+    return ok;
+}
+
+
+// ==================== 온라인 스케줄러 ====================
+
+#define ONLINE_INITIAL_JOBS 64
+
+static inline void online_place(DsLptOnline *s, uint32_t i, DsLptSlot slot) {
+    s->heap[i] = slot;
+    s->machines[slot.machine].pos = i;
+}
+
+// 구멍 방식 상향 이동 (부하가 줄었거나 새로 들어온 칸)
+static void online_sift_up(DsLptOnline *s, uint32_t i) {
+    DsLptSlot slot = s->heap[i];
+    while (i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if (s->heap[parent].load <= slot.load) {
+            break;
+        }
+        online_place(s, i, s->heap[parent]);
+        i = parent;
+    }
+    online_place(s, i, slot);
+}
+
+// 구멍 방식 하향 이동 (부하가 늘었거나 마지막 칸으로 채운 자리)
+static void online_sift_down(DsLptOnline *s, uint32_t i) {
+    DsLptSlot slot = s->heap[i];
+    uint32_t child;
+    while ((child = 2 * i + 1) < s->heap_size) {
+        if (child + 1 < s->heap_size && s->heap[child + 1].load < s->heap[child].load) {
+            child++;
+        }
+        if (s->heap[child].load >= slot.load) {
+            break;
+        }
+        online_place(s, i, s->heap[child]);
+        i = child;
+    }
+    online_place(s, i, slot);
+}
+
+// 머신 슬롯을 capacity개 이상 담도록 확장 (머신 배열과 힙을 함께)
+static bool online_reserve_machines(DsLptOnline *s, uint32_t capacity) {
+    if (capacity <= s->machine_capacity) {
+        return true;
+    }
+    uint32_t grown_capacity = s->machine_capacity ? s->machine_capacity : 4;
+    while (grown_capacity < capacity) {
+        grown_capacity = grown_capacity > UINT32_MAX / 2 ? capacity : grown_capacity * 2;
+    }
+    DsLptMachine *machines = realloc(s->machines, (size_t)grown_capacity * sizeof(DsLptMachine));
+    if (machines == NULL) {
+        return false;
+    }
+    s->machines = machines;
+    DsLptSlot *heap = realloc(s->heap, (size_t)grown_capacity * sizeof(DsLptSlot));
+    if (heap == NULL) {
+        return false;   // 머신 배열만 커진 상태는 무해 (용량은 그대로 기록)
+    }
+    s->heap = heap;
+    s->machine_capacity = grown_capacity;
+    return true;
+}
+
+bool ds_lpt_online_init(DsLptOnline *s, uint32_t num_machines) {
+    memset(s, 0, sizeof(*s));
+    s->free_machine = DS_LPT_NONE;
+    s->free_job = DS_LPT_NONE;
+    if (num_machines == DS_LPT_NONE || !online_reserve_machines(s, num_machines)) {
+        ds_lpt_online_destroy(s);
+        return false;
+    }
+    for (uint32_t i = 0; i < num_machines; i++) {
+        s->machines[i] = (DsLptMachine){0, 0, i, DS_LPT_NONE, DS_LPT_MACHINE_ACTIVE};
+        s->heap[i] = (DsLptSlot){0, i};   // 부하가 모두 0 → 이미 힙
+    }
+    s->num_slots = num_machines;
+    s->heap_size = num_machines;
+    return true;
+}
+
+void ds_lpt_online_destroy(DsLptOnline *s) {
+    free(s->heap);
+    free(s->machines);
+    free(s->jobs);
+    memset(s, 0, sizeof(*s));
+    s->free_machine = DS_LPT_NONE;
+    s->free_job = DS_LPT_NONE;
+}
+
+// 빈 작업 칸 하나 (목록이 비었으면 배열 끝, 필요하면 2배 확장)
+static bool online_alloc_job(DsLptOnline *s, uint32_t *job) {
+    if (s->free_job != DS_LPT_NONE) {
+        *job = s->free_job;
+        s->free_job = s->jobs[*job].time;
+        return true;
+    }
+    if (s->job_slots == DS_LPT_NONE) {
+        return false;
+    }
+    if (s->job_slots == s->job_capacity) {
+        uint32_t grown_capacity = s->job_capacity ? s->job_capacity : ONLINE_INITIAL_JOBS;
+        grown_capacity = grown_capacity > UINT32_MAX / 2 ? DS_LPT_NONE : grown_capacity * 2;
+        DsLptJob *grown = realloc(s->jobs, (size_t)grown_capacity * sizeof(DsLptJob));
+        if (grown == NULL) {
+            return false;
+        }
+        s->jobs = grown;
+        s->job_capacity = grown_capacity;
+    }
+    *job = s->job_slots++;
+    return true;
+}
+
+bool ds_lpt_online_submit(DsLptOnline *s, uint32_t time, uint32_t *job, uint32_t *machine) {
+    uint32_t id;
+    if (s->heap_size == 0 || !online_alloc_job(s, &id)) {
+        return false;
+    }
+    // 루트 교체: 가장 한가한 머신의 부하를 늘리고 하향 이동 한 번
+    uint32_t target = s->heap[0].machine;
+    s->heap[0].load += time;
+    s->machines[target].load += time;
+    s->machines[target].num_jobs++;
+    online_sift_down(s, 0);
+
+    s->jobs[id] = (DsLptJob){target, time};
+    s->num_jobs++;
+    if (job != NULL) {
+        *job = id;
+    }
+    if (machine != NULL) {
+        *machine = target;
+    }
+    return true;
+}
+
+bool ds_lpt_online_complete(DsLptOnline *s, uint32_t job) {
+    if (job >= s->job_slots || s->jobs[job].machine == DS_LPT_NONE) {
+        return false;
+    }
+    DsLptJob done = s->jobs[job];
+    DsLptMachine *m = &s->machines[done.machine];
+    m->load -= done.time;
+    m->num_jobs--;
+    if (m->state == DS_LPT_MACHINE_ACTIVE) {
+        s->heap[m->pos].load = m->load;
+        online_sift_up(s, m->pos);
+    } else if (m->num_jobs == 0) {   // DRAINING 머신의 마지막 작업
+        m->state = DS_LPT_MACHINE_FREE;
+        m->next_free = s->free_machine;
+        s->free_machine = done.machine;
+    }
+
+    s->jobs[job] = (DsLptJob){DS_LPT_NONE, s->free_job};
+    s->free_job = job;
+    s->num_jobs--;
+    return true;
+}
+
+bool ds_lpt_online_add_machine(DsLptOnline *s, uint32_t *machine) {
+    uint32_t id = s->free_machine;
+    if (id == DS_LPT_NONE) {
+        if (s->num_slots == DS_LPT_NONE || !online_reserve_machines(s, s->num_slots + 1)) {
+            return false;
+        }
+        id = s->num_slots++;
+    } else {
+        s->free_machine = s->machines[id].next_free;
+    }
+    // FREE 슬롯은 힙에 없으므로 heap_size < machine_capacity
+    s->machines[id] = (DsLptMachine){0, 0, s->heap_size, DS_LPT_NONE, DS_LPT_MACHINE_ACTIVE};
+    s->heap[s->heap_size++] = (DsLptSlot){0, id};
+    online_sift_up(s, s->heap_size - 1);
+    if (machine != NULL) {
+        *machine = id;
+    }
+    return true;
+}
+
+bool ds_lpt_online_remove_machine(DsLptOnline *s, uint32_t machine) {
+    if (machine >= s->num_slots || s->machines[machine].state != DS_LPT_MACHINE_ACTIVE) {
+        return false;
+    }
+    DsLptMachine *m = &s->machines[machine];
+    uint32_t i = m->pos;
+    DsLptSlot last = s->heap[--s->heap_size];
+    if (i < s->heap_size) {   // 마지막 칸으로 빈자리를 채우고 위/아래 중 한쪽으로 이동
+        online_place(s, i, last);
+        if (i > 0 && s->heap[(i - 1) / 2].load > last.load) {
+            online_sift_up(s, i);
+        } else {
+            online_sift_down(s, i);
+        }
+    }
+
+    m->pos = DS_LPT_NONE;
+    if (m->num_jobs > 0) {
+        m->state = DS_LPT_MACHINE_DRAINING;
+    } else {
+        m->state = DS_LPT_MACHINE_FREE;
+        m->next_free = s->free_machine;
+        s->free_machine = machine;
+    }
+    return true;
+}
@@ -0,0 +1,187 @@
+/**
+ * ds_lpt.h: 대규모 LPT 스케줄링 엔진 (chapter09/lpt_scheduling.c 확장)
+ *
+ * 교재 버전은 작업 100개/머신 10개 고정 배열에, 작업을 Max-Heap에 하나씩 넣어 정렬하고
+ * 할당마다 출력한다. 이 모듈은 작업 1e7개, 머신 1e4대 규모를 목표로
+ *
+ * 1) 정렬: 키 (~처리 시간 << 32 | 작업 번호)를 병렬 MSD 기수 정렬 (ds_radix.h)
+ *    → 처리 시간 내림차순, 같은 시간은 작업 번호 순 (결과가 스레드 수와 무관)
+ * 2) 할당: 머신 Min-Heap(부하, 머신 번호)의 루트 부하를 늘리고 하향 이동 한 번 (루트 교체)
+ * 3) 선택적 개선
+ *    - DS_LPT_REFINE_LOCAL_SEARCH: 가장 무거운 머신에서 더 가벼운 머신(가장 가벼운 것부터)으로
+ *      makespan을 줄이는 작업 이동/교환을 더 없을 때까지 반복
+ *      (최대/최소 부하 머신은 토너먼트 트리로 O(1) 조회, 이동마다 O(log m) 갱신)
+ *    - DS_LPT_REFINE_MULTIFIT: 용량 C를 이분 탐색하며 FFD(First-Fit Decreasing)로
+ *      m개 상자에 들어가는지 시험, LPT보다 작은 C를 찾으면 그 배치를 사용
+ *      (첫 번째 맞는 상자는 세그먼트 트리로 O(log m), 스레드 수만큼 C를 동시에 시험)
+ *
+ * 결과는 작업별 머신 번호 배열(assignment)과 요약 보고서(DsLptReport)뿐이며 출력하지 않는다.
+ *
+ *   uint32_t *machine_of = malloc(n * sizeof(uint32_t));
+ *   DsLptOptions opt = DS_LPT_OPTIONS_DEFAULT;
+ *   opt.refine = DS_LPT_REFINE_LOCAL_SEARCH;
+ *   DsLptReport report;
+ *   ds_lpt_schedule(times, n, num_machines, machine_of, NULL, &opt, &report);
+ *
+ * 작업이 미리 다 주어지지 않고 시간에 따라 도착하면 온라인 스케줄러(DsLptOnline)를 쓴다.
+ * 도착 순서대로 가장 한가한 머신에 배정하고(정렬 단계 없음), 완료되면 부하를 되돌린다.
+ *
+ *   DsLptOnline s;
+ *   ds_lpt_online_init(&s, num_machines);
+ *   ds_lpt_online_submit(&s, time, &job, &machine);    // 도착: O(log m)
+ *   ds_lpt_online_complete(&s, job);                   // 완료 콜백에서: O(log m)
+ *   ds_lpt_online_add_machine(&s, &machine);           // 증설
+ *   ds_lpt_online_remove_machine(&s, machine);         // 배정 중단, 남은 작업은 그대로 완료
+ *   ds_lpt_online_destroy(&s);
+ */
+
+#ifndef DS_LPT_H
+#define DS_LPT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 개선 단계 (비트 OR로 함께 사용 가능: MULTIFIT 후 LOCAL_SEARCH)
+enum {
+    DS_LPT_REFINE_NONE = 0,
+    DS_LPT_REFINE_LOCAL_SEARCH = 1u << 0,
+    DS_LPT_REFINE_MULTIFIT = 1u << 1,
+};
+
+typedef struct {
+    unsigned refine;                // DS_LPT_REFINE_* 조합
+    unsigned multifit_rounds;       // 이분 탐색 단계 수 (단계마다 스레드 수만큼 C를 시험)
+    size_t max_moves;               // 로컬 서치 이동/교환 상한 (0: 머신 수 × 16)
+    unsigned num_threads;           // 0: 온라인 코어 수, 1: 순차
+} DsLptOptions;
+
+#define DS_LPT_OPTIONS_DEFAULT {DS_LPT_REFINE_NONE, 10, 0, 0}
+
+typedef struct {
+    uint64_t makespan;          // 최종 makespan (가장 늦게 끝나는 머신의 부하)
+    uint64_t lpt_makespan;      // 개선 전 LPT makespan
+    uint64_t lower_bound;       // 최적해 하한: max(⌈전체 시간 / m⌉, 가장 긴 작업,
+                                //              m번째 + m+1번째로 긴 작업)
+    uint64_t total_time;        // 처리 시간 합
+    size_t moves;               // 로컬 서치가 적용한 이동 + 교환 수
+    unsigned multifit_probes;   // FFD 시험 횟수
+} DsLptReport;
+
+/**
+ * 작업 n개를 머신 m대에 LPT로 배정
+ * @param times      작업별 처리 시간
+ * @param assignment 작업 i가 배정된 머신 번호 (크기 n, 출력)
+ * @param loads      머신별 부하 (크기 m, 출력, NULL 허용)
+ * @param opt        NULL이면 DS_LPT_OPTIONS_DEFAULT
+ * @param report     NULL 허용
+ * @return m = 0, n > UINT32_MAX, 메모리 부족이면 false (출력 배열 내용은 정해지지 않음)
+ */
+bool ds_lpt_schedule(const uint32_t times[], size_t n, uint32_t m, uint32_t assignment[],
+                     uint64_t loads[], const DsLptOptions *opt, DsLptReport *report);
+
+
+
+// ==================== 온라인 스케줄러 ====================
+
+#define DS_LPT_NONE UINT32_MAX   // 머신/작업 번호 없음
+
+typedef enum {
+    DS_LPT_MACHINE_FREE,       // 빈 슬롯 (add_machine이 재사용)
+    DS_LPT_MACHINE_ACTIVE,     // 힙에 있음 (새 작업을 받음)
+    DS_LPT_MACHINE_DRAINING,   // 제거됨, 남은 작업이 끝나면 FREE
+} DsLptMachineState;
+
+typedef struct {
+    uint64_t load;        // 배정되고 아직 완료되지 않은 처리 시간 합
+    uint32_t num_jobs;    // 진행 중 작업 수
+    uint32_t pos;         // 힙 위치 (ACTIVE일 때만)
+    uint32_t next_free;   // FREE 슬롯 연결
+    DsLptMachineState state;
+} DsLptMachine;
+
+// 힙 칸: 비교할 부하를 머신 번호와 같은 칸에 두어 하향 이동이 연속 접근
+typedef struct {
+    uint64_t load;
+    uint32_t machine;
+} DsLptSlot;
+
+// 진행 중 작업 (빈 칸은 machine = DS_LPT_NONE, time = 다음 빈 칸)
+typedef struct {
+    uint32_t machine;
+    uint32_t time;
+} DsLptJob;
+
+typedef struct {
+    DsLptSlot *heap;          // ACTIVE 머신의 (부하, 번호) Min-Heap
+    uint32_t heap_size;
+    DsLptMachine *machines;
+    uint32_t num_slots;       // 머신 번호 범위 [0, num_slots)
+    uint32_t machine_capacity;
+    uint32_t free_machine;    // FREE 슬롯 목록 머리
+    DsLptJob *jobs;
+    uint32_t job_slots;       // 작업 번호 범위 [0, job_slots)
+    uint32_t job_capacity;
+    uint32_t free_job;        // 빈 작업 칸 목록 머리
+    size_t num_jobs;          // 진행 중 작업 수
+} DsLptOnline;
+
+/**
+ * 머신 0 ~ num_machines-1 (부하 0)로 초기화
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_lpt_online_init(DsLptOnline *s, uint32_t num_machines);
+void ds_lpt_online_destroy(DsLptOnline *s);
+
+/**
+ * 도착한 작업을 가장 한가한 ACTIVE 머신에 배정 O(log m) (작업 칸 확장 시 분할 상환)
+ * 부하가 같으면 힙 순서를 따른다.
+ * @param job, machine 배정된 작업 번호 (complete에 넘김) / 머신 번호, NULL이면 버림
+ * @return ACTIVE 머신이 없거나 메모리 부족이면 false (상태 변화 없음)
+ */
+bool ds_lpt_online_submit(DsLptOnline *s, uint32_t time, uint32_t *job, uint32_t *machine);
+
+/**
+ * 작업 완료: 머신 부하를 줄이고 작업 번호를 반납 O(log m)
+ * DRAINING 머신의 마지막 작업이면 머신 슬롯이 FREE가 된다.
+ * @return 진행 중인 작업 번호가 아니면 false
+ */
+bool ds_lpt_online_complete(DsLptOnline *s, uint32_t job);
+
+/**
+ * 부하 0인 머신 추가 O(log m) (FREE 슬롯이 있으면 그 번호를 재사용)
+ * @return 메모리 부족이면 false
+ */
+bool ds_lpt_online_add_machine(DsLptOnline *s, uint32_t *machine);
+
+/**
+ * 머신을 배정 대상에서 뺀다 O(log m). 이미 배정된 작업은 그대로 complete로 끝난다.
+ * @return ACTIVE 머신이 아니면 false
+ */
+bool ds_lpt_online_remove_machine(DsLptOnline *s, uint32_t machine);
+
+// 새 작업을 받는 머신 수
+static inline uint32_t ds_lpt_online_num_machines(const DsLptOnline *s) {
+    return s->heap_size;
+}
+
+static inline size_t ds_lpt_online_num_jobs(const DsLptOnline *s) {
+    return s->num_jobs;
+}
+
+// 머신의 현재 부하 (범위 밖이면 0)
+static inline uint64_t ds_lpt_online_load(const DsLptOnline *s, uint32_t machine) {
+    return machine < s->num_slots ? s->machines[machine].load : 0;
+}
+
+// 다음 작업이 갈 머신과 그 부하 (ACTIVE 머신이 없으면 false)
+static inline bool ds_lpt_online_peek(const DsLptOnline *s, uint32_t *machine, uint64_t *load) {
+    if (s->heap_size == 0) {
+        return false;
+    }
+    *machine = s->heap[0].machine;
+    *load = s->heap[0].load;
+    return true;
+}
+
+#endif // DS_LPT_H
@@ -0,0 +1,180 @@
+/*
+ * ds_multiqueue.c: MultiQueue (샤드별 try-lock 4진 힙 + 원자적 최솟값 힌트)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ds_multiqueue.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "ds_dary_heap.h"
+#include "ds_thread_pool.h"
+
+#define SHARD_EMPTY UINT64_MAX
+#define POP_EMPTY_PROBES 4   // 빈 샤드를 연속 이만큼 고르면 전체를 훑어 공백 확인
+
+typedef struct {
+    uint64_t key;
+    uint64_t value;
+} MqItem;
+
+#define MQ_ITEM_BEFORE(a, b) ((a).key < (b).key)
+
+DS_DEFINE_DARY_HEAP(mq, MqItem, 4, MQ_ITEM_BEFORE)
+
+struct DsMultiQueueShard {
+    _Alignas(64) pthread_mutex_t lock;
+    _Atomic uint64_t top;   // 최솟값 키 (비었으면 SHARD_EMPTY), 잠금 없이 읽는 힌트
+    mq_DaryHeap heap;
+};
+
+// 스레드별 xorshift64 상태 (0이면 첫 사용 시 전역 카운터로 시드)
+static _Thread_local uint64_t rng_state;
+static _Atomic uint64_t rng_seed_counter = 1;
+
+static inline size_t random_shard(const DsMultiQueue *q) {
+    uint64_t x = rng_state;
+    if (x == 0) {
+        x = atomic_fetch_add_explicit(&rng_seed_counter, 1, memory_order_relaxed)
+            * 0x9E3779B97F4A7C15ull;
+        x |= 1;
+    }
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    rng_state = x;
+    // 곱셈-시프트로 [0, num_shards) 사상 (나눗셈 없음)
+    return (size_t)(((unsigned __int128)x * q->num_shards) >> 64);
+}
+
+// 잠금을 잡은 상태에서 호출: 힙의 현재 최솟값을 힌트로 게시
+static inline void publish_top(DsMultiQueueShard *s) {
+    MqItem item;
+    uint64_t top = mq_dary_heap_peek(&s->heap, &item) ? item.key : SHARD_EMPTY;
+    atomic_store_explicit(&s->top, top, memory_order_release);
+}
+
+bool ds_multiqueue_init(DsMultiQueue *q, size_t num_shards) {
+    q->shards = NULL;
+    q->num_shards = 0;
+    if (num_shards == 0) {
+        num_shards = (size_t)DS_MULTIQUEUE_SHARDS_PER_CPU * ds_cpu_count();
+    }
+    if (num_shards > SIZE_MAX / sizeof(DsMultiQueueShard)) {
+        return false;
+    }
+    DsMultiQueueShard *shards = aligned_alloc(_Alignof(DsMultiQueueShard),
+                                              num_shards * sizeof(DsMultiQueueShard));
+    if (shards == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < num_shards; i++) {
+        pthread_mutex_init(&shards[i].lock, NULL);
+        atomic_init(&shards[i].top, SHARD_EMPTY);
+        mq_dary_heap_init(&shards[i].heap);
+    }
+    q->shards = shards;
+    q->num_shards = num_shards;
+    return true;
+}
+
+void ds_multiqueue_destroy(DsMultiQueue *q) {
+    for (size_t i = 0; i < q->num_shards; i++) {
+        mq_dary_heap_destroy(&q->shards[i].heap);
+        pthread_mutex_destroy(&q->shards[i].lock);
+    }
+    free(q->shards);
+    q->shards = NULL;
+    q->num_shards = 0;
+}
+
+bool ds_multiqueue_push(DsMultiQueue *q, uint64_t key, uint64_t value) {
+    if (key > DS_MULTIQUEUE_KEY_MAX) {
+        return false;
+    }
+    DsMultiQueueShard *s;
+    for (unsigned attempt = 0;; attempt++) {
+        s = &q->shards[random_shard(q)];
+        if (pthread_mutex_trylock(&s->lock) == 0) {
+            break;
+        }
+        if (attempt >= q->num_shards) {
+            sched_yield();   // 샤드보다 스레드가 훨씬 많거나 잠금 보유자가 선점됨
+        }
+    }
+    bool ok = mq_dary_heap_push(&s->heap, (MqItem){key, value});
+    if (ok && key < atomic_load_explicit(&s->top, memory_order_relaxed)) {
+        atomic_store_explicit(&s->top, key, memory_order_release);
+    }
+    pthread_mutex_unlock(&s->lock);
+    return ok;
+}
+
+// 모든 샤드의 힌트가 비었는지 (동시 push 중이면 거짓 음성 가능)
+static bool all_shards_empty(const DsMultiQueue *q) {
+    for (size_t i = 0; i < q->num_shards; i++) {
+        if (atomic_load_explicit(&q->shards[i].top, memory_order_acquire) != SHARD_EMPTY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ds_multiqueue_pop(DsMultiQueue *q, uint64_t *key, uint64_t *value) {
+    unsigned empty_probes = 0;
+    unsigned busy = 0;
+
+    for (;;) {
+        DsMultiQueueShard *a = &q->shards[random_shard(q)];
+        DsMultiQueueShard *b = &q->shards[random_shard(q)];
+        uint64_t top_a = atomic_load_explicit(&a->top, memory_order_acquire);
+        uint64_t top_b = atomic_load_explicit(&b->top, memory_order_acquire);
+        DsMultiQueueShard *s = top_b < top_a ? b : a;
+
+        if ((top_b < top_a ? top_b : top_a) == SHARD_EMPTY) {
+            if (++empty_probes >= POP_EMPTY_PROBES) {
+                if (all_shards_empty(q)) {
+                    return false;
+                }
+                empty_probes = 0;
+            }
+            continue;
+        }
+        if (pthread_mutex_trylock(&s->lock) != 0) {
+            if (++busy >= q->num_shards) {
+                sched_yield();
+                busy = 0;
+            }
+            continue;
+        }
+        MqItem item;
+        bool ok = mq_dary_heap_pop(&s->heap, &item);   // 힌트를 읽은 뒤 다른 스레드가 비웠을 수 있음
+        if (ok) {
+            publish_top(s);
+        }
+        pthread_mutex_unlock(&s->lock);
+        if (ok) {
+            if (key != NULL) {
+                *key = item.key;
+            }
+            if (value != NULL) {
+                *value = item.value;
+            }
+            return true;
+        }
+    }
+}
+
+size_t ds_multiqueue_size(DsMultiQueue *q) {
+    size_t total = 0;
+    for (size_t i = 0; i < q->num_shards; i++) {
+        pthread_mutex_lock(&q->shards[i].lock);
+        total += mq_dary_heap_size(&q->shards[i].heap);
+        pthread_mutex_unlock(&q->shards[i].lock);
+    }
+    return total;
+}
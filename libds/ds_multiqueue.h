@@ -0,0 +1,71 @@
+/**
+ * ds_multiqueue.h: MultiQueue - 다중 생산자/소비자용 완화(relaxed) 동시 우선순위 큐
+ *
+ * 뮤텍스 하나로 감싼 힙은 스레드가 늘수록 모든 push/pop이 한 잠금과 한 캐시 라인(루트)을
+ * 두고 다툰다. MultiQueue는 잠금을 가진 작은 힙(샤드)을 스레드 수의 몇 배 두고
+ *
+ *   push: 무작위 샤드 하나에 넣는다 (try-lock 실패 시 다른 샤드로)
+ *   pop : 무작위 샤드 두 개의 최솟값(잠금 없이 읽는 원자적 힌트)을 비교해
+ *         더 작은 쪽에서 꺼낸다 ("두 개 중 나은 것" 선택)
+ *
+ * 꺼내는 원소가 전역 최솟값이라는 보장은 없지만, 기대 순위 오차는 O(샤드 수)로 작고
+ * 스레드 간 충돌은 거의 사라진다. 작업 분배처럼 "대략 우선순위 순서"면 충분한 곳에 쓴다.
+ *
+ * - 샤드는 64바이트 경계에 맞춰 서로 다른 캐시 라인을 쓴다 (거짓 공유 방지)
+ * - 샤드 내부는 4진 힙 (libds/ds_dary_heap.h)
+ * - 스레드별 난수 상태 (_Thread_local)로 샤드를 고르므로 공유 카운터가 없다
+ *
+ *   DsMultiQueue q;
+ *   ds_multiqueue_init(&q, 0);                  // 0: 샤드 = 2 × CPU 코어 수
+ *   ds_multiqueue_push(&q, deadline, job_id);   // 여러 스레드에서 동시에
+ *   ds_multiqueue_pop(&q, &deadline, &job_id);
+ *   ds_multiqueue_destroy(&q);
+ *
+ * init/destroy는 다른 스레드가 큐를 쓰지 않을 때만 호출한다.
+ */
+
+#ifndef DS_MULTIQUEUE_H
+#define DS_MULTIQUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS_MULTIQUEUE_SHARDS_PER_CPU 2
+#define DS_MULTIQUEUE_KEY_MAX (UINT64_MAX - 1)   // UINT64_MAX는 "빈 샤드" 표시로 예약
+
+typedef struct DsMultiQueueShard DsMultiQueueShard;
+
+typedef struct {
+    DsMultiQueueShard *shards;
+    size_t num_shards;
+} DsMultiQueue;
+
+/**
+ * 샤드 num_shards개로 초기화 (0이면 DS_MULTIQUEUE_SHARDS_PER_CPU × CPU 코어 수)
+ * 소비자 스레드 수의 2~4배가 적당하다.
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+bool ds_multiqueue_init(DsMultiQueue *q, size_t num_shards);
+void ds_multiqueue_destroy(DsMultiQueue *q);
+
+/**
+ * (key, value)를 넣는다 (스레드 안전)
+ * @return key > DS_MULTIQUEUE_KEY_MAX이거나 메모리 부족이면 false
+ */
+bool ds_multiqueue_push(DsMultiQueue *q, uint64_t key, uint64_t value);
+
+/**
+ * 작은 키 쪽 원소 하나를 꺼낸다 (스레드 안전, 완화된 순서)
+ * @param key, value NULL이면 버림
+ * @return 모든 샤드가 비어 보이면 false
+ *         (다른 스레드가 push하는 도중이면 원소가 있어도 false일 수 있음)
+ */
+bool ds_multiqueue_pop(DsMultiQueue *q, uint64_t *key, uint64_t *value);
+
+/**
+ * 원소 수 (각 샤드를 차례로 잠가 합산하므로 동시 수정 중에는 근삿값) O(샤드 수)
+ */
+size_t ds_multiqueue_size(DsMultiQueue *q);
+
+#endif // DS_MULTIQUEUE_H
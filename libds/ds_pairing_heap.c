@@ -0,0 +1,135 @@
+/*
+ * ds_pairing_heap.c: 페어링 힙 (침입형 노드, two-pass pop)
+ */
+
+#include "ds_pairing_heap.h"
+
+// 두 루트를 합친다: 키가 큰 쪽이 작은 쪽의 첫 자식이 됨 (반환 노드의 next/prev는 호출자가 정리)
+static DsPairingNode *link_roots(DsPairingNode *a, DsPairingNode *b) {
+    if (b->key < a->key) {
+        DsPairingNode *t = a;
+        a = b;
+        b = t;
+    }
+    b->prev = a;
+    b->next = a->child;
+    if (a->child != NULL) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+/**
+ * 형제 리스트 first를 트리 하나로 합친다 (two-pass)
+ * 1) 왼쪽부터 둘씩 link, 결과를 역순 리스트로 쌓음
+ * 2) 그 리스트(= 오른쪽 쌍부터)를 차례로 하나에 link
+ * 재귀 없이 next 포인터만 재사용하므로 자식이 수백만 개여도 스택을 쓰지 않는다.
+ */
+static DsPairingNode *merge_pairs(DsPairingNode *first) {
+    DsPairingNode *acc = NULL;
+
+    while (first != NULL) {
+        DsPairingNode *a = first;
+        DsPairingNode *b = a->next;
+        if (b == NULL) {
+            a->next = acc;
+            acc = a;
+            break;
+        }
+        first = b->next;
+        DsPairingNode *m = link_roots(a, b);
+        m->next = acc;
+        acc = m;
+    }
+
+    DsPairingNode *root = acc;
+    acc = acc->next;
+    while (acc != NULL) {
+        DsPairingNode *next = acc->next;
+        root = link_roots(root, acc);
+        acc = next;
+    }
+    root->next = NULL;
+    root->prev = NULL;
+    return root;
+}
+
+// 루트가 아닌 node를 부모/형제 리스트에서 떼어 낸다 (node의 서브트리는 그대로)
+static void cut(DsPairingNode *node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->next;   // 첫 자식: prev는 부모
+    } else {
+        node->prev->next = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    }
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+// 독립된 트리 t를 루트와 합친다
+static void attach(DsPairingHeap *h, DsPairingNode *t) {
+    if (h->root == NULL) {
+        h->root = t;
+        return;
+    }
+    h->root = link_roots(h->root, t);
+    h->root->next = NULL;
+    h->root->prev = NULL;
+}
+
+void ds_pairing_heap_push(DsPairingHeap *h, DsPairingNode *node, uint64_t key) {
+    node->key = key;
+    node->child = NULL;
+    node->next = NULL;
+    node->prev = NULL;
+    attach(h, node);
+    h->size++;
+}
+
+DsPairingNode *ds_pairing_heap_pop(DsPairingHeap *h) {
+    DsPairingNode *top = h->root;
+    if (top == NULL) {
+        return NULL;
+    }
+    h->root = top->child != NULL ? merge_pairs(top->child) : NULL;
+    h->size--;
+    top->child = NULL;
+    return top;
+}
+
+bool ds_pairing_heap_decrease_key(DsPairingHeap *h, DsPairingNode *node, uint64_t key) {
+    if (key > node->key) {
+        return false;
+    }
+    node->key = key;
+    if (node != h->root) {
+        cut(node);
+        attach(h, node);
+    }
+    return true;
+}
+
+void ds_pairing_heap_remove(DsPairingHeap *h, DsPairingNode *node) {
+    if (node == h->root) {
+        ds_pairing_heap_pop(h);
+        return;
+    }
+    cut(node);
+    if (node->child != NULL) {
+        attach(h, merge_pairs(node->child));
+        node->child = NULL;
+    }
+    h->size--;
+}
+
+void ds_pairing_heap_meld(DsPairingHeap *dst, DsPairingHeap *src) {
+    if (src->root == NULL) {
+        return;
+    }
+    attach(dst, src->root);
+    dst->size += src->size;
+    ds_pairing_heap_init(src);
+}
@@ -0,0 +1,95 @@
+/**
+ * ds_pairing_heap.h: 페어링 힙 (pairing heap) - O(1) 삽입/병합, 빠른 decrease-key
+ *
+ * 배열 힙(chapter09/heap.c)은 삽입마다 상향 이동 O(log n)이 필요하고, 두 힙을 합치려면
+ * 한쪽을 전부 다시 넣어야 한다. 페어링 힙은 "자식 리스트를 가진 다진 트리"로
+ *
+ *   link(a, b)  : 키가 큰 쪽 루트를 작은 쪽 루트의 첫 자식으로 붙인다 (비교 1번)
+ *   push / meld : 루트끼리 link 한 번 O(1)
+ *   decrease_key: 노드를 부모에서 잘라 루트와 link O(1) (분할 상환 o(log n))
+ *   pop         : 루트의 자식들을 왼쪽부터 둘씩 link → 오른쪽부터 차례로 link (two-pass)
+ *                 분할 상환 O(log n)
+ *
+ * 노드는 호출자가 자기 구조체 안에 넣어 두는 침입형(intrusive) 방식이다.
+ * 힙은 메모리를 할당하지 않으므로 push가 실패하지 않고, 다익스트라처럼 정점 수만큼
+ * 노드 배열을 한 번 잡아 두면 정점 번호 = 노드 위치로 바로 찾아 decrease-key할 수 있다.
+ *
+ *   typedef struct { DsPairingNode node; int id; } Job;
+ *   DsPairingHeap h;
+ *   ds_pairing_heap_init(&h);
+ *   ds_pairing_heap_push(&h, &job.node, priority);
+ *   ds_pairing_heap_decrease_key(&h, &job.node, new_priority);
+ *   Job *first = DS_PAIRING_ENTRY(ds_pairing_heap_pop(&h), Job, node);
+ *
+ * 키는 uint64_t, 작을수록 루트 쪽 (Min-Heap). 같은 노드를 두 힙에 동시에 넣을 수 없다.
+ */
+
+#ifndef DS_PAIRING_HEAP_H
+#define DS_PAIRING_HEAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct DsPairingNode {
+    uint64_t key;
+    struct DsPairingNode *child;   // 첫 자식
+    struct DsPairingNode *next;    // 다음 형제
+    struct DsPairingNode *prev;    // 이전 형제 (첫 자식이면 부모, 루트면 NULL)
+} DsPairingNode;
+
+typedef struct {
+    DsPairingNode *root;
+    size_t size;
+} DsPairingHeap;
+
+// 노드 포인터 → 노드를 품은 구조체 포인터
+#define DS_PAIRING_ENTRY(node_ptr, type, member) \
+    ((type *)((char *)(node_ptr) - offsetof(type, member)))
+
+static inline void ds_pairing_heap_init(DsPairingHeap *h) {
+    h->root = NULL;
+    h->size = 0;
+}
+
+/**
+ * node를 key로 삽입 O(1)
+ * @param node 힙에 들어 있지 않은 노드 (힙에 있는 동안 옮기거나 해제하면 안 됨)
+ */
+void ds_pairing_heap_push(DsPairingHeap *h, DsPairingNode *node, uint64_t key);
+
+/**
+ * 최소 키 노드를 꺼낸다 (two-pass 병합) 분할 상환 O(log n)
+ * @return 꺼낸 노드, 공백이면 NULL
+ */
+DsPairingNode *ds_pairing_heap_pop(DsPairingHeap *h);
+
+/**
+ * 힙에 있는 node의 키를 key로 줄인다 O(1) (분할 상환 o(log n))
+ * @return key가 현재 키보다 크면 false (힙은 그대로)
+ */
+bool ds_pairing_heap_decrease_key(DsPairingHeap *h, DsPairingNode *node, uint64_t key);
+
+/**
+ * 힙에 있는 임의의 node를 제거 (타이머 취소 등) 분할 상환 O(log n)
+ */
+void ds_pairing_heap_remove(DsPairingHeap *h, DsPairingNode *node);
+
+/**
+ * src의 모든 노드를 dst로 옮긴다 O(1), src는 빈 힙이 된다
+ */
+void ds_pairing_heap_meld(DsPairingHeap *dst, DsPairingHeap *src);
+
+static inline DsPairingNode *ds_pairing_heap_peek(const DsPairingHeap *h) {
+    return h->root;
+}
+
+static inline size_t ds_pairing_heap_size(const DsPairingHeap *h) {
+    return h->size;
+}
+
+static inline bool ds_pairing_heap_is_empty(const DsPairingHeap *h) {
+    return h->root == NULL;
+}
+
+#endif // DS_PAIRING_HEAP_H
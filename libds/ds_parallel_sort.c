@@ -0,0 +1,157 @@
+/*
+ * ds_parallel_sort.c: 멀티코어 정렬
+ *
+ * 병렬 병합 정렬의 ping-pong 구조:
+ *   merge_sort_task(src, dst, to_dst)는 src 구간을 정렬해 결과를
+ *   to_dst ? dst : src 에 남긴다. 두 자식은 결과를 반대편 배열에 남기고
+ *   부모가 그 둘을 원하는 쪽으로 병합하므로, 단계마다 복사 없이 방향만 바뀐다.
+ */
+
+#include "ds_parallel_sort.h"
+#include "ds_sort.h"
+#include "ds_thread_pool.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PMS_SEQUENTIAL_CUTOFF (1u << 14)   // 이 크기 이하 구간은 순차 정렬
+#define PMS_MERGE_CHUNK       (1u << 15)   // 병렬 병합 조각의 최소 출력 크기
+#define PMS_MAX_MERGE_PARTS   64
+
+// ==================== 병합 ====================
+
+// a[0..na)와 b[0..nb)를 out에 병합 (같은 값은 a 먼저: 안정)
+static void merge_sequential(const int *a, size_t na, const int *b, size_t nb, int *out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        out[k++] = (b[j] < a[i]) ? b[j++] : a[i++];
+    }
+    memcpy(out + k, a + i, (na - i) * sizeof(int));
+    memcpy(out + k + (na - i), b + j, (nb - j) * sizeof(int));
+}
+
+/**
+ * co-rank: 병합 결과의 앞 k개 중 a에서 온 원소 수를 이진 탐색으로 구한다
+ * 조건: a[i] > b[k-i-1]을 만족하는 가장 작은 i (같은 값은 a가 먼저)
+ */
+static size_t co_rank(size_t k, const int *a, size_t na, const int *b, size_t nb) {
+    size_t lo = k > nb ? k - nb : 0;
+    size_t hi = k < na ? k : na;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (a[mid] > b[k - mid - 1]) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+typedef struct {
+    const int *a, *b;
+    size_t na, nb;
+    int *out;
+    size_t k_begin, k_end;   // 이 조각이 채울 출력 구간 [k_begin, k_end)
+} MergePart;
+
+static void merge_part_task(void *arg) {
+    MergePart *p = arg;
+    size_t i0 = co_rank(p->k_begin, p->a, p->na, p->b, p->nb);
+    size_t i1 = co_rank(p->k_end, p->a, p->na, p->b, p->nb);
+    size_t j0 = p->k_begin - i0;
+    size_t j1 = p->k_end - i1;
+    merge_sequential(p->a + i0, i1 - i0, p->b + j0, j1 - j0, p->out + p->k_begin);
+}
+
+static void merge_parallel(DsThreadPool *pool, const int *a, size_t na,
+                           const int *b, size_t nb, int *out) {
+    size_t total = na + nb;
+    size_t parts = total / PMS_MERGE_CHUNK;
+    size_t max_parts = (size_t)ds_thread_pool_num_workers(pool) + 1;
+    if (parts > max_parts) {
+        parts = max_parts;
+    }
+    if (parts > PMS_MAX_MERGE_PARTS) {
+        parts = PMS_MAX_MERGE_PARTS;
+    }
+    if (parts < 2) {
+        merge_sequential(a, na, b, nb, out);
+        return;
+    }
+
+    MergePart part[PMS_MAX_MERGE_PARTS];
+    DsTaskGroup group = DS_TASK_GROUP_INIT;
+    for (size_t p = 0; p < parts; p++) {
+        part[p] = (MergePart){a, b, na, nb, out, total * p / parts, total * (p + 1) / parts};
+        if (p + 1 < parts) {
+            ds_thread_pool_submit(pool, &group, merge_part_task, &part[p]);
+        }
+    }
+    merge_part_task(&part[parts - 1]);
+    ds_thread_pool_wait(pool, &group);
+}
+
+// ==================== 병렬 병합 정렬 ====================
+
+typedef struct {
+    DsThreadPool *pool;
+    int *src;
+    int *dst;
+    size_t n;
+    bool to_dst;   // 결과를 dst에 둘지 (false면 src)
+} MergeSortTask;
+
+static void merge_sort_task(void *arg) {
+    MergeSortTask *t = arg;
+    if (t->n <= PMS_SEQUENTIAL_CUTOFF) {
+        ds_pdq_sort(t->src, t->n);   // 정수 키는 안정성이 관찰되지 않으므로 가장 빠른 순차 정렬
+        if (t->to_dst) {
+            memcpy(t->dst, t->src, t->n * sizeof(int));
+        }
+        return;
+    }
+
+    size_t half = t->n / 2;
+    MergeSortTask left = {t->pool, t->src, t->dst, half, !t->to_dst};
+    MergeSortTask right = {t->pool, t->src + half, t->dst + half, t->n - half, !t->to_dst};
+    DsTaskGroup group = DS_TASK_GROUP_INIT;
+    ds_thread_pool_submit(t->pool, &group, merge_sort_task, &left);
+    merge_sort_task(&right);
+    ds_thread_pool_wait(t->pool, &group);
+
+    // 자식 결과는 반대편 배열에 있다 → 원하는 쪽으로 병합
+    const int *from = t->to_dst ? t->src : t->dst;
+    int *into = t->to_dst ? t->dst : t->src;
+    merge_parallel(t->pool, from, half, from + half, t->n - half, into);
+}
+
+bool ds_parallel_merge_sort(int arr[], size_t n, unsigned num_threads) {
+    if (n <= PMS_SEQUENTIAL_CUTOFF) {
+        ds_pdq_sort(arr, n);
+        return true;
+    }
+    if (num_threads == 0) {
+        num_threads = ds_cpu_count();
+    }
+    if (n > SIZE_MAX / sizeof(int)) {
+        return false;
+    }
+    int *buffer = malloc(n * sizeof(int));
+    if (buffer == NULL) {
+        return false;
+    }
+    DsThreadPool *pool = ds_thread_pool_create(num_threads - 1);   // 호출 스레드 포함
+    if (pool == NULL) {
+        free(buffer);
+        return false;
+    }
+
+    MergeSortTask root = {pool, arr, buffer, n, false};
+    merge_sort_task(&root);
+
+    ds_thread_pool_destroy(pool);
+    free(buffer);
+    return true;
+}
@@ -0,0 +1,23 @@
+/**
+ * ds_parallel_sort.h: 멀티코어 정렬 (ds_thread_pool 기반)
+ *
+ * num_threads = 0이면 온라인 코어 수만큼 사용한다 (호출 스레드 포함).
+ * 추가 메모리가 필요하므로 bool을 반환한다 (메모리 부족 시 false, 배열은 변경되지 않음).
+ */
+
+#ifndef DS_PARALLEL_SORT_H
+#define DS_PARALLEL_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * 병렬 병합 정렬
+ * - 작업 단위 재귀 분할: 절반은 풀에 등록, 절반은 직접 처리 (작은 구간은 순차 정렬)
+ * - 병렬 병합: 출력 구간을 조각으로 나누고 각 조각의 시작점을 이진 탐색(co-rank)으로 구함
+ * - 보조 버퍼 n개를 한 번만 할당하고 단계마다 원본/버퍼를 번갈아 사용 (ping-pong)
+ * 시간 O(n log n / p + log² n), 추가 메모리 O(n)
+ */
+bool ds_parallel_merge_sort(int arr[], size_t n, unsigned num_threads);
+
+#endif // DS_PARALLEL_SORT_H
@@ -0,0 +1,153 @@
+/*
+ * ds_pqueue.c: 임의 원소 타입 우선순위 큐 (동적 배열 이진 힙)
+ */
+
+#include "ds_pqueue.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DS_PQUEUE_INIT_CAPACITY 16
+
+#define ELEM(pq, i) ((pq)->data + (i) * (pq)->elem_size)
+#define SCRATCH(pq) ELEM(pq, (pq)->capacity)
+
+// a가 b보다 루트 쪽에 있어야 하면 참
+static inline bool before(const DsPQueue *pq, const void *a, const void *b) {
+    int order = pq->cmp(a, b);
+    return pq->order == DS_HEAP_MIN ? order < 0 : order > 0;
+}
+
+// i번 구멍에 item(임시 칸)을 상향 이동으로 배치
+static void sift_up(DsPQueue *pq, size_t i, const void *item) {
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!before(pq, item, ELEM(pq, parent))) {
+            break;
+        }
+        memcpy(ELEM(pq, i), ELEM(pq, parent), pq->elem_size);
+        i = parent;
+    }
+    memcpy(ELEM(pq, i), item, pq->elem_size);
+}
+
+// i번 구멍에 item(임시 칸)을 하향 이동으로 배치
+static void sift_down(DsPQueue *pq, size_t i, const void *item) {
+    size_t child;
+    while ((child = 2 * i + 1) < pq->size) {
+        if (child + 1 < pq->size && before(pq, ELEM(pq, child + 1), ELEM(pq, child))) {
+            child++;
+        }
+        if (!before(pq, ELEM(pq, child), item)) {
+            break;
+        }
+        memcpy(ELEM(pq, i), ELEM(pq, child), pq->elem_size);
+        i = child;
+    }
+    memcpy(ELEM(pq, i), item, pq->elem_size);
+}
+
+// 원소 capacity개 + 임시 칸 1개로 정확히 재할당
+static bool resize(DsPQueue *pq, size_t capacity) {
+    if (capacity >= SIZE_MAX / pq->elem_size) {
+        return false;
+    }
+    unsigned char *new_data = realloc(pq->data, (capacity + 1) * pq->elem_size);
+    if (new_data == NULL) {
+        return false;
+    }
+    pq->data = new_data;
+    pq->capacity = capacity;
+    return true;
+}
+
+void ds_pqueue_init(DsPQueue *pq, size_t elem_size, DsCompareFn cmp, DsHeapOrder order) {
+    pq->data = NULL;
+    pq->size = 0;
+    pq->capacity = 0;
+    pq->elem_size = elem_size;
+    pq->cmp = cmp;
+    pq->order = order;
+}
+
+void ds_pqueue_destroy(DsPQueue *pq) {
+    free(pq->data);
+    pq->data = NULL;
+    pq->size = 0;
+    pq->capacity = 0;
+}
+
+bool ds_pqueue_reserve(DsPQueue *pq, size_t capacity) {
+    if (capacity <= pq->capacity) {
+        return true;
+    }
+    return resize(pq, capacity);
+}
+
+bool ds_pqueue_shrink_to_fit(DsPQueue *pq) {
+    if (pq->size == pq->capacity) {
+        return true;
+    }
+    if (pq->size == 0) {
+        ds_pqueue_destroy(pq);
+        return true;
+    }
+    return resize(pq, pq->size);
+}
+
+bool ds_pqueue_push(DsPQueue *pq, const void *item) {
+    if (pq->size == pq->capacity) {
+        size_t grown = pq->capacity == 0 ? DS_PQUEUE_INIT_CAPACITY : pq->capacity * 2;
+        if (grown < pq->capacity || !resize(pq, grown)) {
+            return false;
+        }
+    }
+    memcpy(SCRATCH(pq), item, pq->elem_size);
+    sift_up(pq, pq->size++, SCRATCH(pq));
+    return true;
+}
+
+bool ds_pqueue_pop(DsPQueue *pq, void *out) {
+    if (pq->size == 0) {
+        return false;
+    }
+    if (out != NULL) {
+        memcpy(out, ELEM(pq, 0), pq->elem_size);
+    }
+    pq->size--;
+    if (pq->size > 0) {
+        memcpy(SCRATCH(pq), ELEM(pq, pq->size), pq->elem_size);
+        sift_down(pq, 0, SCRATCH(pq));
+    }
+    return true;
+}
+
+bool ds_pqueue_replace_top(DsPQueue *pq, const void *item, void *old) {
+    if (pq->size == 0) {
+        return false;
+    }
+    memcpy(SCRATCH(pq), item, pq->elem_size);
+    if (old != NULL) {
+        memcpy(old, ELEM(pq, 0), pq->elem_size);
+    }
+    sift_down(pq, 0, SCRATCH(pq));
+    return true;
+}
+
+bool ds_pqueue_build(DsPQueue *pq, const void *items, size_t n) {
+    if (!ds_pqueue_reserve(pq, n)) {
+        return false;
+    }
+    if (n > 0) {
+        memcpy(pq->data, items, n * pq->elem_size);
+    }
+    pq->size = n;
+
+    // 마지막 비리프 노드부터 하향 이동
+    for (size_t i = n / 2; i-- > 0;) {
+        memcpy(SCRATCH(pq), ELEM(pq, i), pq->elem_size);
+        sift_down(pq, i, SCRATCH(pq));
+    }
+    return true;
+}
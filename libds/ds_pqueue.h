@@ -0,0 +1,99 @@
+/**
+ * ds_pqueue.h: 임의 원소 타입 우선순위 큐 (chapter09/heap.c의 일반화)
+ *
+ * 교재의 Heap은 int 100개 고정 배열이라 꽉 차면 종료한다. 이 모듈은
+ * - 원소 크기와 비교 함수(qsort 규약)를 받아 어떤 구조체든 담고
+ * - 용량이 부족하면 2배씩 늘리며 (원소당 분할 상환 O(1) 재할당)
+ * - Min/Max 모드를 고를 수 있고 (ds_heap.h의 DsHeapOrder)
+ * - 배열로부터 O(n) 상향식 구성, 다 쓴 뒤 shrink_to_fit으로 메모리를 돌려준다.
+ *
+ *   typedef struct { uint64_t deadline; uint32_t id; } Timer;
+ *   DsPQueue timers;
+ *   ds_pqueue_init(&timers, sizeof(Timer), compare_timer, DS_HEAP_MIN);
+ *   ds_pqueue_push(&timers, &(Timer){now + 30, 7});
+ *   const Timer *next = ds_pqueue_peek(&timers);
+ *
+ * 원소 이동은 "구멍" 방식: 옮길 원소를 임시 칸에 두고 부모/자식을 한 칸씩 당긴 뒤 한 번만 쓴다.
+ * int만 필요하면 비교가 인라인되는 ds_heap.h(DsHeap)가 더 빠르다.
+ * bool을 반환하는 함수는 메모리 부족 시 false를 반환하고 큐를 변경하지 않는다.
+ */
+
+#ifndef DS_PQUEUE_H
+#define DS_PQUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ds_generic_sort.h"
+#include "ds_heap.h"
+
+typedef struct {
+    unsigned char *data;   // (capacity + 1)개 칸, 마지막 칸은 하향/상향 이동용 임시 공간
+    size_t size;
+    size_t capacity;
+    size_t elem_size;
+    DsCompareFn cmp;
+    DsHeapOrder order;     // DS_HEAP_MIN: cmp 기준 가장 작은 원소가 루트
+} DsPQueue;
+
+/**
+ * 빈 큐로 초기화 (메모리는 첫 push 때 할당)
+ * @param elem_size 원소 크기 (바이트, 0보다 커야 함)
+ */
+void ds_pqueue_init(DsPQueue *pq, size_t elem_size, DsCompareFn cmp, DsHeapOrder order);
+void ds_pqueue_destroy(DsPQueue *pq);
+
+/**
+ * 원소 capacity개를 담을 공간을 미리 확보 (현재 용량 이하이면 아무것도 하지 않음)
+ */
+bool ds_pqueue_reserve(DsPQueue *pq, size_t capacity);
+
+/**
+ * 용량을 현재 원소 수로 줄인다 (비어 있으면 메모리를 모두 해제)
+ * @return 실패(realloc 실패) 시 false, 큐는 그대로 유효
+ */
+bool ds_pqueue_shrink_to_fit(DsPQueue *pq);
+
+/**
+ * 원소를 복사해 넣는다 (상향 이동) O(log n), 가득 차면 용량 2배
+ */
+bool ds_pqueue_push(DsPQueue *pq, const void *item);
+
+/**
+ * 루트를 꺼내 out에 복사한다 (하향 이동) O(log n)
+ * @param out NULL이면 버림
+ * @return 공백이면 false
+ */
+bool ds_pqueue_pop(DsPQueue *pq, void *out);
+
+/**
+ * 루트를 꺼내고 item을 넣는 것을 하향 이동 한 번으로 처리 O(log n)
+ * (주기 타이머 재등록처럼 꺼내자마자 다시 넣는 경우)
+ * @param old NULL이면 버림
+ * @return 공백이면 false
+ */
+bool ds_pqueue_replace_top(DsPQueue *pq, const void *item, void *old);
+
+/**
+ * 배열 items[0..n)을 복사해 O(n)으로 힙을 구성 (기존 내용은 버림)
+ */
+bool ds_pqueue_build(DsPQueue *pq, const void *items, size_t n);
+
+// 루트 원소 (공백이면 NULL, 다음 변경 연산 전까지 유효)
+static inline const void *ds_pqueue_peek(const DsPQueue *pq) {
+    return pq->size > 0 ? pq->data : NULL;
+}
+
+static inline size_t ds_pqueue_size(const DsPQueue *pq) {
+    return pq->size;
+}
+
+static inline size_t ds_pqueue_capacity(const DsPQueue *pq) {
+    return pq->capacity;
+}
+
+static inline bool ds_pqueue_is_empty(const DsPQueue *pq) {
+    return pq->size == 0;
+}
+
+#endif // DS_PQUEUE_H
@@ -0,0 +1,59 @@
+/*
+ * ds_queue.c: 원형 큐 / 덱 링 버퍼
+ */
+
+#include "ds_queue.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DS_RING_INIT_CAPACITY 16
+
+void ds_ring_init(DsRing *r) {
+    r->data = NULL;
+    r->head = 0;
+    r->size = 0;
+    r->mask = 0;
+}
+
+void ds_ring_destroy(DsRing *r) {
+    free(r->data);
+    ds_ring_init(r);
+}
+
+bool ds_ring_reserve(DsRing *r, size_t capacity) {
+    size_t old_capacity = ds_ring_capacity(r);
+    size_t new_capacity = DS_RING_INIT_CAPACITY;
+
+    while (new_capacity < capacity) {
+        if (new_capacity > SIZE_MAX / 2 / sizeof(int)) {
+            return false;
+        }
+        new_capacity *= 2;
+    }
+    if (new_capacity <= old_capacity) {
+        return true;
+    }
+
+    int *new_data = malloc(new_capacity * sizeof(int));
+    if (new_data == NULL) {
+        return false;
+    }
+
+    // 순환된 내용을 펼쳐서 [0, size)로 복사
+    if (r->size > 0) {
+        size_t first = old_capacity - r->head;
+        if (first > r->size) {
+            first = r->size;
+        }
+        memcpy(new_data, r->data + r->head, first * sizeof(int));
+        memcpy(new_data + first, r->data, (r->size - first) * sizeof(int));
+    }
+
+    free(r->data);
+    r->data = new_data;
+    r->head = 0;
+    r->mask = new_capacity - 1;
+    return true;
+}
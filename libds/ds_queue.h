@@ -0,0 +1,133 @@
+/**
+ * ds_queue.h: 원형 큐 / 덱 (chapter05/circular_queue.c, deque.c 기반)
+ *
+ * - 용량은 2의 거듭제곱으로 유지 → 나머지 연산(%) 대신 비트 마스크
+ * - 포화 시 2배 확장 (교재 버전의 "1칸 비워두기" 없이 size로 공백/포화 구분)
+ * - 큐와 덱은 같은 링 버퍼 구조를 공유한다
+ */
+
+#ifndef DS_QUEUE_H
+#define DS_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int *data;     // 링 버퍼
+    size_t head;   // 전단 요소 위치
+    size_t size;   // 요소 개수
+    size_t mask;   // 용량 - 1 (용량 0이면 data == NULL)
+} DsRing;
+
+typedef DsRing DsQueue;   // 원형 큐: 후단 삽입, 전단 삭제
+typedef DsRing DsDeque;   // 덱: 양쪽 끝 삽입/삭제
+
+void ds_ring_init(DsRing *r);
+void ds_ring_destroy(DsRing *r);
+
+/**
+ * 용량을 최소 capacity 이상(2의 거듭제곱)으로 확보한다
+ * @return 성공 시 true, 메모리 부족 시 false (기존 내용 유지)
+ */
+bool ds_ring_reserve(DsRing *r, size_t capacity);
+
+static inline bool ds_ring_is_empty(const DsRing *r) {
+    return r->size == 0;
+}
+
+static inline size_t ds_ring_size(const DsRing *r) {
+    return r->size;
+}
+
+static inline size_t ds_ring_capacity(const DsRing *r) {
+    return r->data != NULL ? r->mask + 1 : 0;
+}
+
+/**
+ * 후단 삽입 (add_rear / enqueue)
+ */
+static inline bool ds_ring_push_back(DsRing *r, int item) {
+    if (r->size == ds_ring_capacity(r) && !ds_ring_reserve(r, r->size * 2)) {
+        return false;
+    }
+    r->data[(r->head + r->size) & r->mask] = item;
+    r->size++;
+    return true;
+}
+
+/**
+ * 전단 삽입 (add_front)
+ */
+static inline bool ds_ring_push_front(DsRing *r, int item) {
+    if (r->size == ds_ring_capacity(r) && !ds_ring_reserve(r, r->size * 2)) {
+        return false;
+    }
+    r->head = (r->head - 1) & r->mask;
+    r->data[r->head] = item;
+    r->size++;
+    return true;
+}
+
+/**
+ * 전단 삭제 (delete_front / dequeue)
+ */
+static inline bool ds_ring_pop_front(DsRing *r, int *item) {
+    if (r->size == 0) {
+        return false;
+    }
+    *item = r->data[r->head];
+    r->head = (r->head + 1) & r->mask;
+    r->size--;
+    return true;
+}
+
+/**
+ * 후단 삭제 (delete_rear)
+ */
+static inline bool ds_ring_pop_back(DsRing *r, int *item) {
+    if (r->size == 0) {
+        return false;
+    }
+    r->size--;
+    *item = r->data[(r->head + r->size) & r->mask];
+    return true;
+}
+
+static inline bool ds_ring_peek_front(const DsRing *r, int *item) {
+    if (r->size == 0) {
+        return false;
+    }
+    *item = r->data[r->head];
+    return true;
+}
+
+static inline bool ds_ring_peek_back(const DsRing *r, int *item) {
+    if (r->size == 0) {
+        return false;
+    }
+    *item = r->data[(r->head + r->size - 1) & r->mask];
+    return true;
+}
+
+// 큐 연산 별칭
+#define ds_queue_init     ds_ring_init
+#define ds_queue_destroy  ds_ring_destroy
+#define ds_queue_is_empty ds_ring_is_empty
+#define ds_queue_size     ds_ring_size
+#define ds_enqueue        ds_ring_push_back
+#define ds_dequeue        ds_ring_pop_front
+#define ds_queue_peek     ds_ring_peek_front
+
+// 덱 연산 별칭
+#define ds_deque_init         ds_ring_init
+#define ds_deque_destroy      ds_ring_destroy
+#define ds_deque_is_empty     ds_ring_is_empty
+#define ds_deque_size         ds_ring_size
+#define ds_deque_add_front    ds_ring_push_front
+#define ds_deque_add_rear     ds_ring_push_back
+#define ds_deque_delete_front ds_ring_pop_front
+#define ds_deque_delete_rear  ds_ring_pop_back
+#define ds_deque_get_front    ds_ring_peek_front
+#define ds_deque_get_rear     ds_ring_peek_back
+
+#endif // DS_QUEUE_H
@@ -0,0 +1,544 @@
+/*
+ * ds_radix.c: LSD 기수 정렬 (11비트 자릿수) / MSD American flag 정렬
+ *
+ * 키 변환 (부호 없는 정수 순서와 같아지도록):
+ *   부호 있는 정수: 부호 비트 반전
+ *   부동소수점    : 음수면 모든 비트 반전, 양수면 부호 비트만 반전
+ * 변환은 히스토그램을 세는 첫 패스에서 제자리로 적용하고 마지막에 되돌린다.
+ */
+
+#include "ds_radix.h"
+#include "ds_counters.h"
+#include "ds_thread_pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define RADIX_BITS    11
+#define RADIX_BUCKETS (1u << RADIX_BITS)   // 2048개 × 패스 수: L1/L2에 머무는 크기
+#define RADIX_MASK    (RADIX_BUCKETS - 1)
+
+_Static_assert(sizeof(float) == sizeof(uint32_t), "float는 32비트여야 함");
+_Static_assert(sizeof(double) == sizeof(uint64_t), "double은 64비트여야 함");
+
+typedef enum {
+    KEY_UNSIGNED,
+    KEY_SIGNED,
+    KEY_FLOAT
+} KeyKind;
+
+/**
+ * DEFINE_LSD(bits, KEY_T, PASSES): KEY_T 키용 LSD 기수 정렬 lsd_sort_<bits> 생성
+ * payload가 NULL이 아니면 키와 같은 순서로 함께 이동한다.
+ */
+#define DEFINE_LSD(bits, KEY_T, PASSES)                                           \
+    static inline KEY_T to_sortable_##bits(KEY_T k, KeyKind kind) {               \
+        const KEY_T sign = (KEY_T)1 << (bits - 1);                                \
+        if (kind == KEY_SIGNED) {                                                 \
+            return k ^ sign;                                                      \
+        }                                                                         \
+        if (kind == KEY_FLOAT) {                                                  \
+            return k ^ (((KEY_T)0 - (k >> (bits - 1))) | sign);                   \
+        }                                                                         \
+        return k;                                                                 \
+    }                                                                             \
+                                                                                  \
+    static inline KEY_T from_sortable_##bits(KEY_T k, KeyKind kind) {             \
+        const KEY_T sign = (KEY_T)1 << (bits - 1);                                \
+        if (kind == KEY_SIGNED) {                                                 \
+            return k ^ sign;                                                      \
+        }                                                                         \
+        if (kind == KEY_FLOAT) {                                                  \
+            return k ^ (((k >> (bits - 1)) - 1) | sign);                          \
+        }                                                                         \
+        return k;                                                                 \
+    }                                                                             \
+                                                                                  \
+    static bool lsd_sort_##bits(KEY_T keys[], uint32_t payload[], size_t n,       \
+                                KeyKind kind) {                                   \
+        if (n < 2) {                                                              \
+            return true;                                                          \
+        }                                                                         \
+        if (n > SIZE_MAX / sizeof(KEY_T)) {                                       \
+            return false;                                                         \
+        }                                                                         \
+        size_t (*count)[RADIX_BUCKETS] = calloc(PASSES, sizeof(*count));          \
+        KEY_T *key_buffer = malloc(n * sizeof(KEY_T));                            \
+        uint32_t *payload_buffer = payload ? malloc(n * sizeof(uint32_t)) : NULL; \
+        if (count == NULL || key_buffer == NULL                                   \
+            || (payload != NULL && payload_buffer == NULL)) {                     \
+            free(count);                                                          \
+            free(key_buffer);                                                     \
+            free(payload_buffer);                                                 \
+            return false;                                                         \
+        }                                                                         \
+                                                                                  \
+        /* 1) 키 변환 + 모든 자릿수 히스토그램을 한 번에 */                       \
+        for (size_t i = 0; i < n; i++) {                                          \
+            KEY_T k = to_sortable_##bits(keys[i], kind);                          \
+            keys[i] = k;                                                          \
+            for (int p = 0; p < PASSES; p++) {                                    \
+                count[p][(k >> (p * RADIX_BITS)) & RADIX_MASK]++;                 \
+            }                                                                     \
+        }                                                                         \
+                                                                                  \
+        /* 2) 자릿수별 분배 (모든 키가 한 버킷이면 생략) */                       \
+        KEY_T *src = keys, *dst = key_buffer;                                     \
+        uint32_t *src_payload = payload, *dst_payload = payload_buffer;           \
+        for (int p = 0; p < PASSES; p++) {                                        \
+            unsigned shift = (unsigned)(p * RADIX_BITS);                          \
+            size_t *c = count[p];                                                 \
+            if (c[(src[0] >> shift) & RADIX_MASK] == n) {                         \
+                continue;                                                         \
+            }                                                                     \
+            size_t offset = 0;                                                    \
+            for (size_t d = 0; d < RADIX_BUCKETS; d++) {                          \
+                size_t bucket = c[d];                                             \
+                c[d] = offset;                                                    \
+                offset += bucket;                                                 \
+            }                                                                     \
+            if (src_payload != NULL) {                                            \
+                for (size_t i = 0; i < n; i++) {                                  \
+                    size_t pos = c[(src[i] >> shift) & RADIX_MASK]++;             \
+                    dst[pos] = src[i];                                            \
+                    dst_payload[pos] = src_payload[i];                            \
+                }                                                                 \
+                uint32_t *swap_payload = src_payload;                             \
+                src_payload = dst_payload;                                        \
+                dst_payload = swap_payload;                                       \
+            } else {                                                              \
+                for (size_t i = 0; i < n; i++) {                                  \
+                    dst[c[(src[i] >> shift) & RADIX_MASK]++] = src[i];            \
+                }                                                                 \
+            }                                                                     \
+            DS_COUNT_MOVE(n);   /* 비교 없이 분배만 */                            \
+            KEY_T *swap_keys = src;                                               \
+            src = dst;                                                            \
+            dst = swap_keys;                                                      \
+        }                                                                         \
+                                                                                  \
+        /* 3) 결과가 보조 버퍼에 있으면 되돌리며 키 역변환 */                     \
+        if (src != keys || kind != KEY_UNSIGNED) {                                \
+            for (size_t i = 0; i < n; i++) {                                      \
+                keys[i] = from_sortable_##bits(src[i], kind);                     \
+            }                                                                     \
+            DS_COUNT_MOVE(src != keys ? n : 0);                                   \
+        }                                                                         \
+        if (payload != NULL && src_payload != payload) {                          \
+            memcpy(payload, src_payload, n * sizeof(uint32_t));                   \
+        }                                                                         \
+                                                                                  \
+        free(count);                                                              \
+        free(key_buffer);                                                         \
+        free(payload_buffer);                                                     \
+        return true;                                                              \
+    }
+
+DEFINE_LSD(32, uint32_t, 3)   // 11 + 11 + 10비트
+DEFINE_LSD(64, uint64_t, 6)   // 11 × 5 + 9비트
+
+// ==================== 32비트 키 ====================
+
+bool ds_radix_sort_u32(uint32_t keys[], size_t n) {
+    return lsd_sort_32(keys, NULL, n, KEY_UNSIGNED);
+}
+
+bool ds_radix_sort_i32(int32_t keys[], size_t n) {
+    return lsd_sort_32((uint32_t *)keys, NULL, n, KEY_SIGNED);
+}
+
+bool ds_radix_sort_f32(float keys[], size_t n) {
+    return lsd_sort_32((uint32_t *)(void *)keys, NULL, n, KEY_FLOAT);
+}
+
+bool ds_radix_sort_u32_pairs(uint32_t keys[], uint32_t payload[], size_t n) {
+    return lsd_sort_32(keys, payload, n, KEY_UNSIGNED);
+}
+
+bool ds_radix_sort_i32_pairs(int32_t keys[], uint32_t payload[], size_t n) {
+    return lsd_sort_32((uint32_t *)keys, payload, n, KEY_SIGNED);
+}
+
+// ==================== 64비트 키 ====================
+
+bool ds_radix_sort_u64(uint64_t keys[], size_t n) {
+    return lsd_sort_64(keys, NULL, n, KEY_UNSIGNED);
+}
+
+bool ds_radix_sort_i64(int64_t keys[], size_t n) {
+    return lsd_sort_64((uint64_t *)keys, NULL, n, KEY_SIGNED);
+}
+
+bool ds_radix_sort_f64(double keys[], size_t n) {
+    return lsd_sort_64((uint64_t *)(void *)keys, NULL, n, KEY_FLOAT);
+}
+
+bool ds_radix_sort_u64_pairs(uint64_t keys[], uint32_t payload[], size_t n) {
+    return lsd_sort_64(keys, payload, n, KEY_UNSIGNED);
+}
+
+bool ds_radix_sort_i64_pairs(int64_t keys[], uint32_t payload[], size_t n) {
+    return lsd_sort_64((uint64_t *)keys, payload, n, KEY_SIGNED);
+}
+
+// ==================== MSD (American flag) 기수 정렬 ====================
+//
+// 한 단계: 현재 바이트의 히스토그램 → 버킷별 [head, tail) 구간 계산 →
+// 버킷마다 제자리에 있지 않은 원소를 목적 버킷의 head와 맞바꾸는 순환 치환.
+// 각 원소는 최종 버킷으로 한 번만 이동한다.
+
+#define MSD_INSERTION_CUTOFF 32           // 이 크기 이하 버킷은 삽입 정렬
+#define MSD_PARALLEL_CUTOFF  (1u << 16)   // 이 크기 이상 버킷만 별도 작업으로 분리
+
+/**
+ * DEFINE_AFLAG(bits, KEY_T): KEY_T 키용 American flag 정렬 생성
+ *   aflag_sort_<bits>     : 순차 (버킷마다 재귀, 깊이 ≤ 키 바이트 수)
+ *   aflag_parallel_<bits> : 큰 버킷을 풀 작업으로 등록하는 병렬 버전
+ */
+#define DEFINE_AFLAG(bits, KEY_T)                                                 \
+    static void insertion_sort_##bits(KEY_T keys[], size_t n) {                   \
+        for (size_t i = 1; i < n; i++) {                                          \
+            KEY_T key = keys[i];                                                  \
+            size_t j = i;                                                         \
+            while (j > 0 && DS_CMP(keys[j - 1] > key)) {                          \
+                keys[j] = keys[j - 1];                                            \
+                j--;                                                              \
+            }                                                                     \
+            keys[j] = key;                                                        \
+            DS_COUNT_MOVE(i - j + 1);                                             \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    /* 버킷별로 순환 치환 (count: 버킷 크기) */                                   \
+    static void aflag_permute_##bits(KEY_T keys[], unsigned shift,                \
+                                     const size_t count[256]) {                   \
+        size_t head[256], tail[256];                                              \
+        size_t offset = 0;                                                        \
+        for (unsigned d = 0; d < 256; d++) {                                      \
+            head[d] = offset;                                                     \
+            offset += count[d];                                                   \
+            tail[d] = offset;                                                     \
+        }                                                                         \
+        for (unsigned d = 0; d < 256; d++) {                                      \
+            while (head[d] < tail[d]) {                                           \
+                KEY_T value = keys[head[d]];                                      \
+                unsigned digit = (unsigned)(value >> shift) & 0xFF;               \
+                while (digit != d) {                                              \
+                    KEY_T displaced = keys[head[digit]];                          \
+                    keys[head[digit]++] = value;                                  \
+                    DS_COUNT_MOVE(1);                                             \
+                    value = displaced;                                            \
+                    digit = (unsigned)(value >> shift) & 0xFF;                    \
+                }                                                                 \
+                keys[head[d]++] = value;                                          \
+                DS_COUNT_MOVE(1);                                                 \
+            }                                                                     \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    /* 모든 키가 한 버킷이면 다음 바이트로 넘어간다                            */ \
+    /* @return 분할할 바이트가 남아 있으면 true (shift는 그 바이트 위치)       */ \
+    static bool aflag_count_##bits(const KEY_T keys[], size_t n, unsigned *shift, \
+                                   size_t count[256]) {                           \
+        for (;;) {                                                                \
+            memset(count, 0, 256 * sizeof(size_t));                               \
+            for (size_t i = 0; i < n; i++) {                                      \
+                count[(keys[i] >> *shift) & 0xFF]++;                              \
+            }                                                                     \
+            if (count[(keys[0] >> *shift) & 0xFF] != n) {                         \
+                return true;                                                      \
+            }                                                                     \
+            if (*shift == 0) {                                                    \
+                return false;   /* 모든 키가 같음 */                              \
+            }                                                                     \
+            *shift -= 8;                                                          \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static void aflag_sort_##bits(KEY_T keys[], size_t n, unsigned shift) {       \
+        if (n <= MSD_INSERTION_CUTOFF) {                                          \
+            insertion_sort_##bits(keys, n);                                       \
+            return;                                                               \
+        }                                                                         \
+        size_t count[256];                                                        \
+        if (!aflag_count_##bits(keys, n, &shift, count)) {                        \
+            return;                                                               \
+        }                                                                         \
+        aflag_permute_##bits(keys, shift, count);                                 \
+        if (shift == 0) {                                                         \
+            return;   /* 마지막 바이트: 버킷 안의 키는 모두 같다 */               \
+        }                                                                         \
+        size_t start = 0;                                                         \
+        for (unsigned d = 0; d < 256; d++) {                                      \
+            aflag_sort_##bits(keys + start, count[d], shift - 8);                 \
+            start += count[d];                                                    \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    typedef struct {                                                              \
+        DsThreadPool *pool;                                                       \
+        KEY_T *keys;                                                              \
+        size_t n;                                                                 \
+        unsigned shift;                                                           \
+    } AflagTask##bits;                                                            \
+                                                                                  \
+    static void aflag_parallel_##bits(void *arg) {                                \
+        AflagTask##bits *t = arg;                                                 \
+        if (t->n < MSD_PARALLEL_CUTOFF) {                                         \
+            aflag_sort_##bits(t->keys, t->n, t->shift);                           \
+            return;                                                               \
+        }                                                                         \
+        unsigned shift = t->shift;                                                \
+        size_t count[256];                                                        \
+        if (!aflag_count_##bits(t->keys, t->n, &shift, count)) {                  \
+            return;                                                               \
+        }                                                                         \
+        aflag_permute_##bits(t->keys, shift, count);                              \
+        if (shift == 0) {                                                         \
+            return;                                                               \
+        }                                                                         \
+        /* 큰 버킷은 작업으로 등록, 작은 버킷은 직접 처리 */                      \
+        AflagTask##bits child[256];                                               \
+        DsTaskGroup group = DS_TASK_GROUP_INIT;                                   \
+        size_t start = 0;                                                         \
+        for (unsigned d = 0; d < 256; d++) {                                      \
+            child[d] = (AflagTask##bits){t->pool, t->keys + start, count[d],      \
+                                         shift - 8};                              \
+            if (count[d] >= MSD_PARALLEL_CUTOFF) {                                \
+                ds_thread_pool_submit(t->pool, &group, aflag_parallel_##bits,     \
+                                      &child[d]);                                 \
+            }                                                                     \
+            start += count[d];                                                    \
+        }                                                                         \
+        for (unsigned d = 0; d < 256; d++) {                                      \
+            if (count[d] < MSD_PARALLEL_CUTOFF) {                                 \
+                aflag_sort_##bits(child[d].keys, child[d].n, child[d].shift);     \
+            }                                                                     \
+        }                                                                         \
+        ds_thread_pool_wait(t->pool, &group);                                     \
+    }                                                                             \
+                                                                                  \
+    static void msd_sort_##bits(KEY_T keys[], size_t n, unsigned num_threads) {   \
+        if (num_threads == 0) {                                                   \
+            num_threads = ds_cpu_count();                                         \
+        }                                                                         \
+        DsThreadPool *pool = NULL;                                                \
+        if (num_threads > 1 && n >= MSD_PARALLEL_CUTOFF) {                        \
+            pool = ds_thread_pool_create(num_threads - 1);                        \
+        }                                                                         \
+        if (pool == NULL) {                                                       \
+            aflag_sort_##bits(keys, n, bits - 8);                                 \
+            return;                                                               \
+        }                                                                         \
+        AflagTask##bits root = {pool, keys, n, bits - 8};                         \
+        aflag_parallel_##bits(&root);                                             \
+        ds_thread_pool_destroy(pool);                                             \
+    }
+
+DEFINE_AFLAG(32, uint32_t)
+DEFINE_AFLAG(64, uint64_t)
+
+void ds_msd_radix_sort_u32(uint32_t keys[], size_t n, unsigned num_threads) {
+    msd_sort_32(keys, n, num_threads);
+}
+
+void ds_msd_radix_sort_u64(uint64_t keys[], size_t n, unsigned num_threads) {
+    msd_sort_64(keys, n, num_threads);
+}
+
+// ==================== MSD 문자열 정렬 ====================
+
+#define STRING_BUCKETS 257   // 0: 문자열 끝, 1~256: 바이트 값 + 1
+
+static inline unsigned string_digit(const DsByteString *s, size_t depth) {
+    return depth < s->length ? (unsigned)s->data[depth] + 1 : 0;
+}
+
+// depth 이후 부분만 비교 (앞부분은 같다고 보장됨)
+static int compare_from(const DsByteString *a, const DsByteString *b, size_t depth) {
+    size_t la = a->length - depth;
+    size_t lb = b->length - depth;
+    int order = memcmp(a->data + depth, b->data + depth, la < lb ? la : lb);
+    if (order != 0) {
+        return order;
+    }
+    return (la > lb) - (la < lb);
+}
+
+static void string_insertion_sort(DsByteString strs[], size_t n, size_t depth) {
+    for (size_t i = 1; i < n; i++) {
+        DsByteString key = strs[i];
+        size_t j = i;
+        while (j > 0 && DS_CMP(compare_from(&strs[j - 1], &key, depth) > 0)) {
+            strs[j] = strs[j - 1];
+            j--;
+        }
+        strs[j] = key;
+        DS_COUNT_MOVE(i - j + 1);
+    }
+}
+
+/**
+ * 공통 접두사를 건너뛰며 히스토그램 계산, 각 문자열의 자릿수를 digits[]에 기록
+ * (치환 단계에서 문자열 본문을 다시 읽지 않도록: 임의 접근 캐시 미스 절반 제거)
+ * @return 분할할 깊이가 남아 있으면 true (*depth는 분할 위치), 모두 같으면 false
+ */
+static bool string_count(const DsByteString strs[], uint16_t digits[], size_t n,
+                         size_t *depth, size_t count[STRING_BUCKETS]) {
+    for (;;) {
+        memset(count, 0, STRING_BUCKETS * sizeof(size_t));
+        for (size_t i = 0; i < n; i++) {
+            unsigned digit = string_digit(&strs[i], *depth);
+            digits[i] = (uint16_t)digit;
+            count[digit]++;
+        }
+        if (count[digits[0]] != n) {
+            return true;
+        }
+        if (digits[0] == 0) {
+            return false;   // 모두 이 깊이에서 끝남 → 모두 같은 문자열
+        }
+        (*depth)++;
+    }
+}
+
+static void string_permute(DsByteString strs[], uint16_t digits[],
+                           const size_t count[STRING_BUCKETS]) {
+    size_t head[STRING_BUCKETS], tail[STRING_BUCKETS];
+    size_t offset = 0;
+    for (unsigned d = 0; d < STRING_BUCKETS; d++) {
+        head[d] = offset;
+        offset += count[d];
+        tail[d] = offset;
+    }
+    for (unsigned d = 0; d < STRING_BUCKETS; d++) {
+        while (head[d] < tail[d]) {
+            DsByteString value = strs[head[d]];
+            unsigned digit = digits[head[d]];
+            while (digit != d) {
+                size_t to = head[digit]++;
+                DsByteString displaced = strs[to];
+                unsigned displaced_digit = digits[to];
+                strs[to] = value;
+                digits[to] = (uint16_t)digit;
+                DS_COUNT_MOVE(1);
+                value = displaced;
+                digit = displaced_digit;
+            }
+            digits[head[d]] = (uint16_t)d;
+            strs[head[d]++] = value;
+            DS_COUNT_MOVE(1);
+        }
+    }
+}
+
+static void string_msd_sort(DsByteString strs[], uint16_t digits[], size_t n, size_t depth) {
+    for (;;) {
+        if (n <= MSD_INSERTION_CUTOFF) {
+            string_insertion_sort(strs, n, depth);
+            return;
+        }
+        size_t count[STRING_BUCKETS];
+        if (!string_count(strs, digits, n, &depth, count)) {
+            return;
+        }
+        string_permute(strs, digits, count);
+
+        // 버킷 0(끝난 문자열)은 모두 같으므로 정렬 불필요
+        // 가장 큰 버킷은 반복으로 처리해 재귀 깊이를 O(log n)으로 제한
+        size_t largest = 1, largest_start = count[0];
+        size_t start = count[0] + count[1];
+        for (unsigned d = 2; d < STRING_BUCKETS; d++) {
+            if (count[d] > count[largest]) {
+                largest = d;
+                largest_start = start;
+            }
+            start += count[d];
+        }
+        start = count[0];
+        for (unsigned d = 1; d < STRING_BUCKETS; d++) {
+            if (d != largest) {
+                string_msd_sort(strs + start, digits + start, count[d], depth + 1);
+            }
+            start += count[d];
+        }
+        strs += largest_start;
+        digits += largest_start;
+        n = count[largest];
+        depth++;
+    }
+}
+
+typedef struct {
+    DsThreadPool *pool;
+    DsByteString *strs;
+    uint16_t *digits;
+    size_t n;
+    size_t depth;
+} StringTask;
+
+static void string_msd_parallel(void *arg) {
+    StringTask *t = arg;
+    if (t->n < MSD_PARALLEL_CUTOFF) {
+        string_msd_sort(t->strs, t->digits, t->n, t->depth);
+        return;
+    }
+    size_t depth = t->depth;
+    size_t count[STRING_BUCKETS];
+    if (!string_count(t->strs, t->digits, t->n, &depth, count)) {
+        return;
+    }
+    string_permute(t->strs, t->digits, count);
+
+    // 큰 버킷만 작업으로 등록 (재귀 단계마다 스택에 두지 않도록 힙에 할당)
+    StringTask *child = malloc(STRING_BUCKETS * sizeof(StringTask));
+    DsTaskGroup group = DS_TASK_GROUP_INIT;
+    size_t start = count[0];
+    for (unsigned d = 1; d < STRING_BUCKETS; d++) {
+        if (child != NULL && count[d] >= MSD_PARALLEL_CUTOFF) {
+            child[d] = (StringTask){t->pool, t->strs + start, t->digits + start,
+                                    count[d], depth + 1};
+            ds_thread_pool_submit(t->pool, &group, string_msd_parallel, &child[d]);
+        }
+        start += count[d];
+    }
+    start = count[0];
+    for (unsigned d = 1; d < STRING_BUCKETS; d++) {
+        if (child == NULL || count[d] < MSD_PARALLEL_CUTOFF) {
+            string_msd_sort(t->strs + start, t->digits + start, count[d], depth + 1);
+        }
+        start += count[d];
+    }
+    ds_thread_pool_wait(t->pool, &group);
+    free(child);
+}
+
+bool ds_msd_radix_sort_strings(DsByteString strs[], size_t n, unsigned num_threads) {
+    if (n <= MSD_INSERTION_CUTOFF) {
+        string_insertion_sort(strs, n, 0);
+        return true;
+    }
+    if (n > SIZE_MAX / sizeof(uint16_t)) {
+        return false;
+    }
+    uint16_t *digits = malloc(n * sizeof(uint16_t));
+    if (digits == NULL) {
+        return false;
+    }
+    if (num_threads == 0) {
+        num_threads = ds_cpu_count();
+    }
+    DsThreadPool *pool = NULL;
+    if (num_threads > 1 && n >= MSD_PARALLEL_CUTOFF) {
+        pool = ds_thread_pool_create(num_threads - 1);
+    }
+    if (pool == NULL) {
+        string_msd_sort(strs, digits, n, 0);
+    } else {
+        StringTask root = {pool, strs, digits, n, 0};
+        string_msd_parallel(&root);
+        ds_thread_pool_destroy(pool);
+    }
+    free(digits);
+    return true;
+}
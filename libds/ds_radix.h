@@ -0,0 +1,68 @@
+/**
+ * ds_radix.h: 비교 없는 기수 정렬 엔진 (chapter12/radix_sort.c 확장)
+ *
+ * 교재 버전은 10진 자릿수마다 나눗셈/나머지를 쓰고 음수를 지원하지 않는다.
+ * 이 모듈은 2진 자릿수(11비트)를 비트 연산으로 꺼낸다.
+ * - 32비트 키: 3회, 64비트 키: 6회 분배 (10진 최대 10회/20회 대비)
+ * - 모든 자릿수의 히스토그램을 입력 한 번 훑을 때 함께 계산
+ * - 모든 키가 같은 버킷에 들어가는 자릿수는 분배를 건너뜀
+ *   (예: 값 범위가 작은 키는 상위 자릿수 분배가 모두 생략)
+ * - 부호 있는 정수/부동소수점은 키 변환으로 부호 없는 순서에 맞춘 뒤 정렬하고 되돌린다
+ *
+ * LSD 함수(ds_radix_sort_*)는 안정 정렬이며 추가 메모리 O(n)을 쓴다.
+ * 메모리 부족 시 false를 반환하고 배열은 변경되지 않는다.
+ * MSD 함수(ds_msd_radix_sort_*)는 제자리 정렬이며 여러 코어를 쓸 수 있다.
+ *
+ * 부동소수점 순서: -inf < 음수 < -0.0 < +0.0 < 양수 < +inf
+ * (NaN은 부호 비트에 따라 맨 앞 또는 맨 뒤)
+ */
+
+#ifndef DS_RADIX_H
+#define DS_RADIX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+bool ds_radix_sort_u32(uint32_t keys[], size_t n);
+bool ds_radix_sort_i32(int32_t keys[], size_t n);
+bool ds_radix_sort_f32(float keys[], size_t n);
+
+bool ds_radix_sort_u64(uint64_t keys[], size_t n);
+bool ds_radix_sort_i64(int64_t keys[], size_t n);
+bool ds_radix_sort_f64(double keys[], size_t n);
+
+/**
+ * 키 + 페이로드 정렬: keys 순서대로 payload[i]도 함께 이동 (행 번호, 레코드 인덱스 등)
+ */
+bool ds_radix_sort_u32_pairs(uint32_t keys[], uint32_t payload[], size_t n);
+bool ds_radix_sort_i32_pairs(int32_t keys[], uint32_t payload[], size_t n);
+bool ds_radix_sort_u64_pairs(uint64_t keys[], uint32_t payload[], size_t n);
+bool ds_radix_sort_i64_pairs(int64_t keys[], uint32_t payload[], size_t n);
+
+// ==================== MSD (American flag) 기수 정렬 ====================
+//
+// 상위 바이트부터 256개 버킷으로 제자리 순환 치환 (추가 배열 없음, 불안정)
+// - 작은 버킷(32개 이하)은 삽입 정렬로 마무리
+// - num_threads > 1: 큰 버킷(2^16개 이상)을 스레드 풀 작업으로 나눠 병렬 처리
+//   (num_threads = 0이면 온라인 코어 수, 1이면 순차)
+// - 정수 버전은 추가 메모리가 없으므로 항상 성공 (스레드를 만들지 못하면 순차로 처리)
+
+void ds_msd_radix_sort_u32(uint32_t keys[], size_t n, unsigned num_threads);
+void ds_msd_radix_sort_u64(uint64_t keys[], size_t n, unsigned num_threads);
+
+// 가변 길이 바이트 문자열 (NUL 포함 가능, 사전 순: 접두사가 더 짧은 쪽이 앞)
+typedef struct {
+    const unsigned char *data;
+    size_t length;
+} DsByteString;
+
+/**
+ * 문자열 MSD 기수 정렬: 깊이 d에서 d번째 바이트(+ "끝" 버킷)로 257분할
+ * - 공통 접두사는 분할 없이 건너뛰고, 가장 큰 버킷은 재귀 대신 반복 → 재귀 깊이 O(log n)
+ * - 단계마다 자릿수를 2바이트 캐시에 기록해 치환 중 문자열 본문을 다시 읽지 않음
+ * @return 성공 시 true, 자릿수 캐시(n × 2바이트) 할당 실패 시 false (배열 변경 없음)
+ */
+bool ds_msd_radix_sort_strings(DsByteString strs[], size_t n, unsigned num_threads);
+
+#endif // DS_RADIX_H
@@ -0,0 +1,139 @@
+/*
+ * ds_radix_heap.c: 기수 힙 (버킷 = last와 처음 달라지는 비트 위치)
+ */
+
+#include "ds_radix_heap.h"
+
+#include <stdlib.h>
+
+#define DS_RADIX_BUCKET_INIT_CAPACITY 16
+
+// key가 들어갈 버킷 번호 (0: key == last, 1~64: 최상위 다른 비트 + 1)
+static inline unsigned bucket_of(uint64_t key, uint64_t last) {
+    uint64_t diff = key ^ last;
+    return diff == 0 ? 0 : 64u - (unsigned)__builtin_clzll(diff);
+}
+
+// 원소 needed개가 들어가도록 용량 확보 (2배씩)
+static bool bucket_reserve(DsRadixBucket *b, size_t needed) {
+    if (needed <= b->capacity) {
+        return true;
+    }
+    size_t capacity = b->capacity > 0 ? b->capacity : DS_RADIX_BUCKET_INIT_CAPACITY;
+    while (capacity < needed) {
+        if (capacity > SIZE_MAX / 2 / sizeof(DsRadixHeapItem)) {
+            return false;
+        }
+        capacity *= 2;
+    }
+    DsRadixHeapItem *items = realloc(b->items, capacity * sizeof(DsRadixHeapItem));
+    if (items == NULL) {
+        return false;
+    }
+    b->items = items;
+    b->capacity = capacity;
+    return true;
+}
+
+void ds_radix_heap_init(DsRadixHeap *h) {
+    for (int i = 0; i < DS_RADIX_HEAP_BUCKETS; i++) {
+        h->buckets[i] = (DsRadixBucket){NULL, 0, 0};
+    }
+    h->nonempty = 0;
+    h->last = 0;
+    h->size = 0;
+}
+
+void ds_radix_heap_destroy(DsRadixHeap *h) {
+    for (int i = 0; i < DS_RADIX_HEAP_BUCKETS; i++) {
+        free(h->buckets[i].items);
+    }
+    ds_radix_heap_init(h);
+}
+
+void ds_radix_heap_clear(DsRadixHeap *h) {
+    for (int i = 0; i < DS_RADIX_HEAP_BUCKETS; i++) {
+        h->buckets[i].size = 0;
+    }
+    h->nonempty = 0;
+    h->last = 0;
+    h->size = 0;
+}
+
+bool ds_radix_heap_push(DsRadixHeap *h, uint64_t key, uint64_t value) {
+    if (key < h->last) {
+        return false;
+    }
+    unsigned t = bucket_of(key, h->last);
+    DsRadixBucket *b = &h->buckets[t];
+    if (b->size == b->capacity && !bucket_reserve(b, b->size + 1)) {
+        return false;
+    }
+    b->items[b->size++] = (DsRadixHeapItem){key, value};
+    if (t > 0) {
+        h->nonempty |= 1ull << (t - 1);
+    }
+    h->size++;
+    return true;
+}
+
+/**
+ * 버킷 0이 비었을 때: 비어 있지 않은 첫 버킷의 최솟값을 새 last로 삼고 그 버킷을 비운다
+ * 옮겨 갈 버킷별 개수를 먼저 세어 용량을 확보하므로, 메모리 부족 시 힙은 그대로다.
+ */
+static bool redistribute(DsRadixHeap *h) {
+    unsigned from = (unsigned)__builtin_ctzll(h->nonempty) + 1;
+    DsRadixBucket *src = &h->buckets[from];
+
+    uint64_t min_key = src->items[0].key;
+    for (size_t i = 1; i < src->size; i++) {
+        if (src->items[i].key < min_key) {
+            min_key = src->items[i].key;
+        }
+    }
+
+    size_t counts[DS_RADIX_HEAP_BUCKETS] = {0};
+    for (size_t i = 0; i < src->size; i++) {
+        counts[bucket_of(src->items[i].key, min_key)]++;
+    }
+    for (unsigned t = 0; t < from; t++) {
+        if (counts[t] > 0 && !bucket_reserve(&h->buckets[t], h->buckets[t].size + counts[t])) {
+            return false;
+        }
+    }
+
+    // 원소는 모두 from보다 낮은 버킷으로 간다 (최상위 다른 비트가 last 쪽에서 사라지므로)
+    for (size_t i = 0; i < src->size; i++) {
+        DsRadixHeapItem item = src->items[i];
+        DsRadixBucket *dst = &h->buckets[bucket_of(item.key, min_key)];
+        dst->items[dst->size++] = item;
+    }
+    src->size = 0;
+    h->nonempty &= ~(1ull << (from - 1));
+    for (unsigned t = 1; t < from; t++) {
+        if (counts[t] > 0) {
+            h->nonempty |= 1ull << (t - 1);
+        }
+    }
+    h->last = min_key;
+    return true;
+}
+
+bool ds_radix_heap_pop(DsRadixHeap *h, uint64_t *key, uint64_t *value) {
+    if (h->size == 0) {
+        return false;
+    }
+    DsRadixBucket *zero = &h->buckets[0];
+    if (zero->size == 0 && !redistribute(h)) {
+        return false;
+    }
+    DsRadixHeapItem item = zero->items[--zero->size];
+    if (key != NULL) {
+        *key = item.key;
+    }
+    if (value != NULL) {
+        *value = item.value;
+    }
+    h->size--;
+    return true;
+}
@@ -0,0 +1,93 @@
+/**
+ * ds_radix_heap.h: 기수 힙 (radix heap) - 단조 정수 키 전용 우선순위 큐
+ *
+ * 다익스트라(음이 아닌 정수 가중치)와 타이머처럼 "꺼낸 키보다 작은 키는 다시 넣지 않는"
+ * 단조(monotone) 작업에서는 비교 기반 힙의 O(log n) 하향 이동이 필요 없다.
+ * 기수 힙은 마지막으로 꺼낸 키 last를 기준으로 원소를 버킷에 나눈다.
+ *
+ *   버킷 0       : key == last
+ *   버킷 b (1~64): key와 last가 처음 달라지는 비트가 b-1번 (= 64 - clz(key ^ last))
+ *
+ * - push: 버킷 번호 계산 후 배열 끝에 추가 O(1)
+ * - pop: 버킷 0이 비었으면 비어 있지 않은 첫 버킷 b의 최솟값을 새 last로 삼고,
+ *   b의 원소를 모두 더 낮은 버킷으로 재분배한다. 원소는 버킷 번호가 줄어들기만 하므로
+ *   원소당 재분배는 최대 64번 → 분할 상환 O(log C) (C: 키 범위)
+ * - 원소 이동은 버킷 배열 순차 접근이라 캐시 미스가 적다
+ *
+ * 비어 있지 않은 버킷은 비트마스크로 추적해 첫 버킷을 ctz 한 번에 찾는다.
+ * decrease-key는 없다: 다익스트라에서는 지연 삭제(더 짧은 거리를 새로 넣고, 꺼낼 때 낡은 항목을 버림)로 쓴다.
+ *
+ *   DsRadixHeap h;
+ *   ds_radix_heap_init(&h);
+ *   ds_radix_heap_push(&h, distance, vertex);   // distance < 마지막으로 꺼낸 키이면 false
+ *   ds_radix_heap_pop(&h, &distance, &vertex);
+ *   ds_radix_heap_destroy(&h);
+ *
+ * bool을 반환하는 함수는 메모리 부족 시 false를 반환하고 힙을 변경하지 않는다.
+ */
+
+#ifndef DS_RADIX_HEAP_H
+#define DS_RADIX_HEAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DS_RADIX_HEAP_BUCKETS 65   // 버킷 0 + 비트 위치 64개
+
+typedef struct {
+    uint64_t key;
+    uint64_t value;   // 호출자 데이터 (정점 번호, 타이머 ID 등)
+} DsRadixHeapItem;
+
+typedef struct {
+    DsRadixHeapItem *items;
+    size_t size;
+    size_t capacity;
+} DsRadixBucket;
+
+typedef struct {
+    DsRadixBucket buckets[DS_RADIX_HEAP_BUCKETS];
+    uint64_t nonempty;   // 비트 b-1: 버킷 b(1~64)가 비어 있지 않음
+    uint64_t last;       // 마지막으로 꺼낸 키 (push 가능한 최소 키)
+    size_t size;
+} DsRadixHeap;
+
+/**
+ * 빈 힙으로 초기화, last = 0 (메모리는 첫 push 때 할당)
+ */
+void ds_radix_heap_init(DsRadixHeap *h);
+void ds_radix_heap_destroy(DsRadixHeap *h);
+
+/**
+ * 모든 원소를 버리고 last = 0으로 되돌린다 (버킷 메모리는 유지해 재사용)
+ */
+void ds_radix_heap_clear(DsRadixHeap *h);
+
+/**
+ * key로 삽입 O(1) (분할 상환)
+ * @return key < last(단조성 위반)이거나 메모리 부족이면 false
+ */
+bool ds_radix_heap_push(DsRadixHeap *h, uint64_t key, uint64_t value);
+
+/**
+ * 최소 키 원소를 꺼낸다 분할 상환 O(log C)
+ * 같은 키끼리의 순서는 정해져 있지 않다.
+ * @param key, value NULL이면 버림
+ * @return 공백이거나 재분배 중 메모리 부족이면 false
+ */
+bool ds_radix_heap_pop(DsRadixHeap *h, uint64_t *key, uint64_t *value);
+
+static inline uint64_t ds_radix_heap_last_key(const DsRadixHeap *h) {
+    return h->last;
+}
+
+static inline size_t ds_radix_heap_size(const DsRadixHeap *h) {
+    return h->size;
+}
+
+static inline bool ds_radix_heap_is_empty(const DsRadixHeap *h) {
+    return h->size == 0;
+}
+
+#endif // DS_RADIX_HEAP_H
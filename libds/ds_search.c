@@ -0,0 +1,91 @@
+/*
+ * ds_search.c: 순차/이진/보간/색인 순차 탐색 (출력 없음)
+ */
+
+#include "ds_search.h"
+#include "ds_counters.h"
+
+long ds_sequential_search(const int arr[], size_t n, int key) {
+    for (size_t i = 0; i < n; i++) {
+        if (DS_CMP(arr[i] == key)) {
+            return (long)i;
+        }
+    }
+    return -1;
+}
+
+long ds_binary_search(const int arr[], size_t n, int key) {
+    size_t low = 0, high = n;   // 반열린 구간 [low, high)
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;   // 오버플로우 방지
+        if (DS_CMP(arr[mid] == key)) {
+            return (long)mid;
+        }
+        if (DS_CMP(arr[mid] < key)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return -1;
+}
+
+long ds_interpolation_search(const int arr[], size_t n, int key) {
+    if (n == 0) {
+        return -1;
+    }
+    size_t low = 0, high = n - 1;
+    while (low <= high && DS_CMP(key >= arr[low]) && DS_CMP(key <= arr[high])) {
+        if (arr[high] == arr[low]) {
+            return DS_CMP(arr[low] == key) ? (long)low : -1;
+        }
+        // pos = low + (key - arr[low]) × (high - low) / (arr[high] - arr[low])
+        size_t pos = low + (size_t)(((double)key - arr[low]) * (double)(high - low)
+                                    / ((double)arr[high] - arr[low]));
+        if (DS_CMP(arr[pos] == key)) {
+            return (long)pos;
+        }
+        if (DS_CMP(arr[pos] < key)) {
+            low = pos + 1;
+        } else {
+            if (pos == 0) {
+                break;
+            }
+            high = pos - 1;
+        }
+    }
+    return -1;
+}
+
+void ds_index_build(const int arr[], size_t n, DsIndexEntry table[], size_t m) {
+    size_t block_size = n / m;
+    for (size_t i = 0; i < m; i++) {
+        size_t start = i * block_size;
+        size_t end = (i == m - 1) ? n - 1 : start + block_size - 1;
+        table[i].key = arr[end];     // 구간의 최댓값
+        table[i].start = start;
+    }
+}
+
+long ds_indexed_search(const int arr[], size_t n,
+                       const DsIndexEntry table[], size_t m, int key) {
+    if (n == 0 || m == 0 || DS_CMP(key < arr[0]) || DS_CMP(key > table[m - 1].key)) {
+        return -1;
+    }
+
+    // 1단계: key가 속할 구간 찾기
+    size_t i = 0;
+    while (DS_CMP(table[i].key < key)) {
+        i++;
+    }
+
+    // 2단계: 구간 내 순차 탐색
+    size_t start = table[i].start;
+    size_t end = (i + 1 < m) ? table[i + 1].start : n;
+    for (size_t j = start; j < end; j++) {
+        if (DS_CMP(arr[j] == key)) {
+            return (long)j;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,45 @@
+/**
+ * ds_search.h: 정렬된 정수 배열 탐색 (chapter13 기반)
+ *
+ * 모든 함수는 찾은 위치를, 없으면 -1을 반환한다.
+ * 중복 키가 있으면 그중 하나의 위치를 반환한다.
+ */
+
+#ifndef DS_SEARCH_H
+#define DS_SEARCH_H
+
+#include <stddef.h>
+
+// 색인 엔트리: 구간의 최댓값과 시작 위치
+typedef struct {
+    int key;
+    size_t start;
+} DsIndexEntry;
+
+/**
+ * 순차 탐색 O(n) (정렬 불필요)
+ */
+long ds_sequential_search(const int arr[], size_t n, int key);
+
+/**
+ * 이진 탐색 O(log n)
+ */
+long ds_binary_search(const int arr[], size_t n, int key);
+
+/**
+ * 보간 탐색: 균등 분포에서 평균 O(log log n), 최악 O(n)
+ */
+long ds_interpolation_search(const int arr[], size_t n, int key);
+
+/**
+ * 색인 테이블 생성: n개 데이터를 m개 구간으로 나눔 (1 <= m <= n)
+ */
+void ds_index_build(const int arr[], size_t n, DsIndexEntry table[], size_t m);
+
+/**
+ * 색인 순차 탐색 O(m + n/m)
+ */
+long ds_indexed_search(const int arr[], size_t n,
+                       const DsIndexEntry table[], size_t m, int key);
+
+#endif // DS_SEARCH_H
@@ -0,0 +1,296 @@
+/*
+ * ds_small_sort.c: 작은 배열 정렬 커널 (이진/분기 없는 삽입 정렬, bitonic 정렬 네트워크)
+ *
+ * bitonic 정렬 (원소 N = 2^m개, 전역 인덱스 g):
+ *   for k = 2, 4, ..., N          // 길이 k인 bitonic 수열을 정렬된 수열로 병합
+ *     for j = k/2, k/4, ..., 1    // 거리 j 원소끼리 비교-교환
+ *       g와 g^j 중 (g & k) == 0이면 작은 값이 앞, 아니면 큰 값이 앞
+ *
+ * 벡터 구현에서 원소 g는 레지스터 g / W의 레인 g % W에 있다 (W: 레인 수).
+ * - j >= W: 레지스터 두 개 사이 비교-교환 → min/max 한 번씩
+ * - j <  W: 레지스터 안에서 레인 i와 i^j를 치환으로 맞댄 뒤 min/max, 레인마다 선택
+ *   레인 i가 큰 값을 갖는 조건 = (i & j != 0) XOR (g & k != 0)
+ */
+
+#include "ds_small_sort.h"
+#include "ds_counters.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SMALL_SORT_X86 1
+#else
+#define SMALL_SORT_X86 0
+#endif
+
+// ==================== 삽입 정렬 변형 ====================
+
+void ds_binary_insertion_sort(int arr[], size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        int key = arr[i];
+        if (DS_CMP(arr[i - 1] <= key)) {
+            continue;   // 이미 제자리 (정렬된 입력에서 O(n))
+        }
+        // arr[0..i)에서 key보다 큰 첫 위치 (같은 값 뒤에 넣어 안정 정렬 유지)
+        size_t low = 0, high = i - 1;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (DS_CMP(arr[mid] <= key)) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        memmove(&arr[low + 1], &arr[low], (i - low) * sizeof(int));
+        arr[low] = key;
+        DS_COUNT_MOVE(i - low + 1);
+    }
+}
+
+void ds_branchless_insertion_sort(int arr[], size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        int key = arr[i];
+        // 정렬된 arr[0..i) 뒤에 key 삽입: 뒤에서부터 한 칸씩 (a[j-1]은 아직 옛 값)
+        for (size_t j = i; j > 0; j--) {
+            int low = arr[j] < key ? arr[j] : key;
+            arr[j] = arr[j - 1] > low ? arr[j - 1] : low;
+        }
+        arr[0] = arr[0] < key ? arr[0] : key;
+        DS_COUNT_CMP(2 * i + 1);   // 자리마다 min/max, 조기 종료 없음
+        DS_COUNT_MOVE(i + 1);
+    }
+}
+
+// ==================== 스칼라 정렬 네트워크 ====================
+
+static void network_scalar(int arr[], size_t n) {
+    for (size_t k = 2; k <= n; k *= 2) {
+        for (size_t j = k / 2; j > 0; j /= 2) {
+            for (size_t i = 0; i < n; i++) {
+                size_t partner = i ^ j;
+                if (partner <= i) {
+                    continue;
+                }
+                int a = arr[i], b = arr[partner];
+                DS_COUNT_CMP(1);
+                int low = a < b ? a : b;
+                int high = a < b ? b : a;
+                bool ascending = (i & k) == 0;
+                arr[i] = ascending ? low : high;
+                arr[partner] = ascending ? high : low;
+            }
+        }
+    }
+    DS_COUNT_MOVE(n);
+}
+
+// ==================== AVX2 정렬 네트워크 (8레인) ====================
+
+#if SMALL_SORT_X86
+
+__attribute__((target("avx2"), always_inline))
+static inline void network_avx2(int arr[], unsigned regs) {
+    __m256i r[8];
+    for (unsigned a = 0; a < regs; a++) {
+        r[a] = _mm256_loadu_si256((const __m256i *)(arr + 8 * a));
+    }
+    // 거리 j = 1, 2, 4의 짝 레인 치환과 "비트 j가 켜진 레인" 마스크
+    const __m256i partner[3] = {
+        _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+        _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5),
+        _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3),
+    };
+    const __m256i bit_set[3] = {
+        _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1),
+        _mm256_setr_epi32(0, 0, -1, -1, 0, 0, -1, -1),
+        _mm256_setr_epi32(0, 0, 0, 0, -1, -1, -1, -1),
+    };
+    const __m256i all = _mm256_set1_epi32(-1);
+    const unsigned total = 8 * regs;
+
+    for (unsigned k = 2; k <= total; k *= 2) {
+        for (unsigned j = k / 2; j > 0; j /= 2) {
+            if (j >= 8) {
+                for (unsigned a = 0; a < regs; a++) {
+                    unsigned b = a ^ (j / 8);
+                    if (b < a) {
+                        continue;
+                    }
+                    __m256i low = _mm256_min_epi32(r[a], r[b]);
+                    __m256i high = _mm256_max_epi32(r[a], r[b]);
+                    bool ascending = ((8 * a) & k) == 0;
+                    r[a] = ascending ? low : high;
+                    r[b] = ascending ? high : low;
+                }
+                continue;
+            }
+            unsigned s = j == 1 ? 0 : j == 2 ? 1 : 2;
+            for (unsigned a = 0; a < regs; a++) {
+                __m256i descending;
+                if (k < 8) {
+                    descending = bit_set[k == 2 ? 1 : 2];
+                } else {
+                    descending = ((8 * a) & k) ? all : _mm256_setzero_si256();
+                }
+                __m256i take_high = _mm256_xor_si256(bit_set[s], descending);
+                __m256i other = _mm256_permutevar8x32_epi32(r[a], partner[s]);
+                r[a] = _mm256_blendv_epi8(_mm256_min_epi32(r[a], other),
+                                          _mm256_max_epi32(r[a], other), take_high);
+            }
+        }
+    }
+    for (unsigned a = 0; a < regs; a++) {
+        _mm256_storeu_si256((__m256i *)(arr + 8 * a), r[a]);
+    }
+}
+
+// ==================== SSE4.1 정렬 네트워크 (4레인) ====================
+
+__attribute__((target("sse4.1"), always_inline))
+static inline void network_sse41(int arr[], unsigned regs) {
+    __m128i r[16];
+    for (unsigned a = 0; a < regs; a++) {
+        r[a] = _mm_loadu_si128((const __m128i *)(arr + 4 * a));
+    }
+    const __m128i bit_set[2] = {
+        _mm_setr_epi32(0, -1, 0, -1),
+        _mm_setr_epi32(0, 0, -1, -1),
+    };
+    const __m128i all = _mm_set1_epi32(-1);
+    const unsigned total = 4 * regs;
+
+    for (unsigned k = 2; k <= total; k *= 2) {
+        for (unsigned j = k / 2; j > 0; j /= 2) {
+            if (j >= 4) {
+                for (unsigned a = 0; a < regs; a++) {
+                    unsigned b = a ^ (j / 4);
+                    if (b < a) {
+                        continue;
+                    }
+                    __m128i low = _mm_min_epi32(r[a], r[b]);
+                    __m128i high = _mm_max_epi32(r[a], r[b]);
+                    bool ascending = ((4 * a) & k) == 0;
+                    r[a] = ascending ? low : high;
+                    r[b] = ascending ? high : low;
+                }
+                continue;
+            }
+            for (unsigned a = 0; a < regs; a++) {
+                __m128i descending;
+                if (k < 4) {
+                    descending = bit_set[1];
+                } else {
+                    descending = ((4 * a) & k) ? all : _mm_setzero_si128();
+                }
+                __m128i take_high = _mm_xor_si128(bit_set[j - 1], descending);
+                __m128i other = j == 1 ? _mm_shuffle_epi32(r[a], _MM_SHUFFLE(2, 3, 0, 1))
+                                       : _mm_shuffle_epi32(r[a], _MM_SHUFFLE(1, 0, 3, 2));
+                r[a] = _mm_blendv_epi8(_mm_min_epi32(r[a], other),
+                                       _mm_max_epi32(r[a], other), take_high);
+            }
+        }
+    }
+    for (unsigned a = 0; a < regs; a++) {
+        _mm_storeu_si128((__m128i *)(arr + 4 * a), r[a]);
+    }
+}
+
+#endif // SMALL_SORT_X86
+
+// 벡터 네트워크의 비교 수: 단계 log2(N)·(log2(N)+1)/2개 × 단계당 N/2쌍, 결과 N개 쓰기
+static inline void count_network(unsigned n) {
+    unsigned log_n = 0;
+    while ((1u << log_n) < n) {
+        log_n++;
+    }
+    DS_COUNT_CMP(n / 2 * (log_n * (log_n + 1) / 2));
+    DS_COUNT_MOVE(n);
+}
+
+/*
+ * 크기별 진입점: 레지스터 수를 상수로 넘겨 루프가 완전히 풀리도록 한다.
+ * (target 속성 함수끼리만 인라인되므로 명령어 집합별 래퍼를 따로 둔다)
+ */
+#if SMALL_SORT_X86
+#define DEFINE_NETWORK_SORT(N)                                                    \
+    __attribute__((target("avx2"))) static void network_avx2_##N(int arr[]) {     \
+        network_avx2(arr, N / 8);                                                 \
+    }                                                                             \
+                                                                                  \
+    __attribute__((target("sse4.1"))) static void network_sse41_##N(int arr[]) {  \
+        network_sse41(arr, N / 4);                                                \
+    }                                                                             \
+                                                                                  \
+    void ds_network_sort_##N(int arr[N]) {                                        \
+        if (__builtin_cpu_supports("avx2")) {                                     \
+            network_avx2_##N(arr);                                                \
+            count_network(N);                                                     \
+        } else if (__builtin_cpu_supports("sse4.1")) {                            \
+            network_sse41_##N(arr);                                               \
+            count_network(N);                                                     \
+        } else {                                                                  \
+            network_scalar(arr, N);                                               \
+        }                                                                         \
+    }
+#else
+#define DEFINE_NETWORK_SORT(N)                                                    \
+    void ds_network_sort_##N(int arr[N]) {                                        \
+        network_scalar(arr, N);                                                   \
+    }
+#endif
+
+DEFINE_NETWORK_SORT(8)
+DEFINE_NETWORK_SORT(16)
+DEFINE_NETWORK_SORT(32)
+DEFINE_NETWORK_SORT(64)
+
+// ==================== 작은 배열 정렬 ====================
+
+void ds_small_sort(int arr[], size_t n) {
+    if (n < 8) {
+        ds_branchless_insertion_sort(arr, n);   // 8개 미만은 채우기 비용이 네트워크 이득보다 큼
+        return;
+    }
+    if (n > DS_SMALL_SORT_MAX) {
+        ds_binary_insertion_sort(arr, n);
+        return;
+    }
+    // 이미 정렬된 구간은 검사만 하고 끝냄 (거의 정렬된 입력의 분할 결과에 흔함)
+    size_t sorted = 1;
+    while (sorted < n && DS_CMP(arr[sorted - 1] <= arr[sorted])) {
+        sorted++;
+    }
+    if (sorted == n) {
+        return;
+    }
+    size_t size = n <= 8 ? 8 : n <= 16 ? 16 : n <= 32 ? 32 : 64;
+    int padded[DS_SMALL_SORT_MAX];
+    int *target = arr;
+    if (n < size) {
+        memcpy(padded, arr, n * sizeof(int));
+        for (size_t i = n; i < size; i++) {
+            padded[i] = INT_MAX;   // 정렬 후 모두 뒤쪽으로
+        }
+        target = padded;
+    }
+    switch (size) {
+    case 8:
+        ds_network_sort_8(target);
+        break;
+    case 16:
+        ds_network_sort_16(target);
+        break;
+    case 32:
+        ds_network_sort_32(target);
+        break;
+    default:
+        ds_network_sort_64(target);
+        break;
+    }
+    if (target != arr) {
+        memcpy(arr, padded, n * sizeof(int));
+    }
+}
@@ -0,0 +1,41 @@
+/**
+ * ds_small_sort.h: 작은 배열 정렬 커널 (chapter12/insertion_sort.c 확장)
+ *
+ * 교재의 삽입 정렬은 한 칸씩 비교하며 미는데, 무작위 입력에서는 비교 분기의 절반 가까이가
+ * 예측 실패한다. 수십 개 이하 배열을 아주 많이 정렬하는 곳(집계 연산자, 하이브리드 정렬의
+ * 바닥 단계)을 위해 분기가 적은 커널을 제공한다.
+ *
+ * - ds_binary_insertion_sort: 삽입 위치를 이진 탐색 → 비교 O(n log n), 이동은 memmove
+ * - ds_branchless_insertion_sort: 새 배열[j] = max(a[j-1], min(a[j], key)) 를 끝까지 계산
+ *   (조기 종료 분기 없음, 원소당 O(i) 고정 작업, 컴파일러가 벡터화 가능)
+ * - ds_network_sort_8/16/32/64: 고정 크기 bitonic 정렬 네트워크
+ *   AVX2(8레인) 또는 SSE4.1(4레인) 레지스터 안에서 min/max + 레인 치환으로 수행하며,
+ *   명령어 집합은 실행 시 CPU를 확인해 고른다. 둘 다 없으면 스칼라 네트워크.
+ * - ds_small_sort: 8 <= n <= 64는 다음 네트워크 크기로 채워(INT_MAX) 정렬,
+ *   8 미만은 분기 없는 삽입 정렬, 이미 정렬된 입력은 한 번 훑고 끝냄
+ *
+ * ds_intro_sort와 ds_merge_sort는 바닥 단계에서 ds_small_sort를 쓴다.
+ */
+
+#ifndef DS_SMALL_SORT_H
+#define DS_SMALL_SORT_H
+
+#include <stddef.h>
+
+#define DS_SMALL_SORT_MAX 64   // ds_small_sort가 네트워크로 처리하는 최대 크기
+
+void ds_binary_insertion_sort(int arr[], size_t n);   // 안정
+void ds_branchless_insertion_sort(int arr[], size_t n);
+
+void ds_network_sort_8(int arr[8]);
+void ds_network_sort_16(int arr[16]);
+void ds_network_sort_32(int arr[32]);
+void ds_network_sort_64(int arr[64]);
+
+/**
+ * 작은 배열 정렬 (불안정)
+ * n < 8: 분기 없는 삽입, n <= DS_SMALL_SORT_MAX: 정렬 네트워크, 그보다 크면 이진 삽입 정렬
+ */
+void ds_small_sort(int arr[], size_t n);
+
+#endif // DS_SMALL_SORT_H
@@ -0,0 +1,950 @@
+/*
+ * ds_sort.c: 정수 배열 정렬 (chapter12 알고리즘, 출력 없음)
+ */
+
+#include "ds_sort.h"
+#include "ds_counters.h"
+#include "ds_small_sort.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+#include <immintrin.h>
+#endif
+
+static inline void swap_int(int *a, int *b) {
+    DS_COUNT_SWAP(1);
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// ==================== O(n²) 정렬 ====================
+
+void ds_selection_sort(int arr[], size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        size_t least = i;
+        for (size_t j = i + 1; j < n; j++) {
+            if (DS_CMP(arr[j] < arr[least])) {
+                least = j;
+            }
+        }
+        swap_int(&arr[i], &arr[least]);
+    }
+}
+
+void ds_insertion_sort(int arr[], size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        int key = arr[i];
+        size_t j = i;
+        while (j > 0 && DS_CMP(arr[j - 1] > key)) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = key;
+        DS_COUNT_MOVE(i - j + 1);
+    }
+}
+
+void ds_bubble_sort(int arr[], size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        bool swapped = false;
+        for (size_t j = 0; j + 1 < n - i; j++) {
+            if (DS_CMP(arr[j] > arr[j + 1])) {
+                swap_int(&arr[j], &arr[j + 1]);
+                swapped = true;
+            }
+        }
+        if (!swapped) {
+            break;   // Early termination
+        }
+    }
+}
+
+// ==================== 쉘 정렬 ====================
+
+#define SHELL_MAX_GAPS 64   // 수식 수열은 항마다 2.25배 이상 증가 → size_t 범위에서 56개 이하
+
+// Ciura (2001)의 실험적 최적 간격, 이후는 2.25배씩 확장
+static const size_t ciura_gaps[] = {1, 4, 10, 23, 57, 132, 301, 701, 1750};
+
+#define NUM_CIURA_GAPS (sizeof(ciura_gaps) / sizeof(ciura_gaps[0]))
+
+/**
+ * Pratt 이외 수열에서 n 미만인 간격을 오름차순으로 gaps에 기록
+ * @return 간격 수 (n < 2이면 0)
+ */
+static size_t formula_gaps(DsShellGaps seq, size_t n, size_t gaps[SHELL_MAX_GAPS]) {
+    size_t count = 0;
+    size_t h = 1;
+    double t = 1.0;    // Tokuda: 올림 전 실수 값
+    size_t pow2 = 1;   // Sedgewick: 2^(k-1)
+    while (h < n && count < SHELL_MAX_GAPS) {
+        gaps[count++] = h;
+        switch (seq) {
+        case DS_SHELL_GAPS_CIURA:
+            if (count < NUM_CIURA_GAPS) {
+                h = ciura_gaps[count];
+            } else {
+                h = h > SIZE_MAX / 9 ? SIZE_MAX : h * 9 / 4;
+            }
+            break;
+        case DS_SHELL_GAPS_TOKUDA:   // h'(k) = 2.25·h'(k-1) + 1, h = ⌈h'⌉
+            t = 2.25 * t + 1.0;
+            if (t >= (double)n) {
+                h = SIZE_MAX;
+            } else {
+                h = (size_t)t;
+                h += (double)h < t;
+            }
+            break;
+        case DS_SHELL_GAPS_SEDGEWICK:   // 4^k + 3·2^(k-1) + 1
+            h = pow2 > n / (4 * pow2) ? SIZE_MAX : 4 * pow2 * pow2 + 3 * pow2 + 1;
+            pow2 *= 2;
+            break;
+        default:   // Knuth: (3^k - 1) / 2
+            h = h > (SIZE_MAX - 1) / 3 ? SIZE_MAX : 3 * h + 1;
+            break;
+        }
+    }
+    return count;
+}
+
+// Pratt 수열(2^p·3^q)에서 bound 미만인 가장 큰 간격 (bound >= 2)
+static size_t pratt_gap_below(size_t bound) {
+    size_t best = 1;
+    for (size_t pow3 = 1;; pow3 *= 3) {
+        size_t h = pow3;
+        while (h <= (bound - 1) / 2) {
+            h *= 2;
+        }
+        if (h > best) {
+            best = h;
+        }
+        if (pow3 > (bound - 1) / 3) {
+            break;
+        }
+    }
+    return best;
+}
+
+size_t ds_shell_gaps(DsShellGaps seq, size_t n, size_t gaps[], size_t capacity) {
+    size_t count = 0;
+    if (seq == DS_SHELL_GAPS_PRATT) {
+        for (size_t h = n; h > 1;) {
+            h = pratt_gap_below(h);
+            if (count < capacity) {
+                gaps[count] = h;
+            }
+            count++;
+        }
+        return count;
+    }
+    size_t ascending[SHELL_MAX_GAPS];
+    count = formula_gaps(seq, n, ascending);
+    for (size_t k = 0; k < count && k < capacity; k++) {
+        gaps[k] = ascending[count - 1 - k];
+    }
+    return count;
+}
+
+/*
+ * 간격 gap의 삽입 정렬 한 단계 (벡터 버전)
+ *
+ * gap >= 레인 수이면 연속한 원소 arr[i..i+W)는 서로 다른 부분 배열(체인)에 속하므로
+ * W개 삽입을 한꺼번에 진행할 수 있다. 각 레인은 앞 원소가 더 크면 한 칸씩 밀고,
+ * 멈춘 레인은 자기 자리에 값을 쓴 뒤 마스크로 빠진다. 모든 레인이 멈추면 다음 묶음.
+ * 작은 간격 단계는 원소당 이동이 몇 칸뿐이라 W개를 비교 한 번으로 처리하는 이득이 크다.
+ *
+ * @return 벡터로 처리하지 못하고 남은 첫 위치 (나머지는 스칼라로 처리)
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHELL_HAVE_AVX2 1
+
+__attribute__((target("avx2")))
+static size_t shell_pass_avx2(int arr[], size_t n, size_t gap) {
+    size_t i = gap;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(arr + i));
+        __m256i active = _mm256_set1_epi32(-1);
+        size_t j = i;
+        while (j >= gap) {
+            __m256i prev = _mm256_loadu_si256((const __m256i *)(arr + j - gap));
+            __m256i move = _mm256_and_si256(active, _mm256_cmpgt_epi32(prev, v));
+            if (DS_COUNTERS_ENABLED) {
+                DS_COUNT_CMP(__builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(active))));
+                DS_COUNT_MOVE(__builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(move))));
+            }
+            if (_mm256_testz_si256(move, move)) {
+                break;
+            }
+            __m256i cur = _mm256_loadu_si256((const __m256i *)(arr + j));
+            cur = _mm256_blendv_epi8(cur, v, _mm256_andnot_si256(move, active));
+            cur = _mm256_blendv_epi8(cur, prev, move);
+            _mm256_storeu_si256((__m256i *)(arr + j), cur);
+            active = move;
+            j -= gap;
+        }
+        __m256i cur = _mm256_loadu_si256((const __m256i *)(arr + j));
+        _mm256_storeu_si256((__m256i *)(arr + j), _mm256_blendv_epi8(cur, v, active));
+        DS_COUNT_MOVE(8);
+    }
+    return i;
+}
+#else
+#define SHELL_HAVE_AVX2 0
+#endif
+
+#if defined(__SSE2__)
+// SSE2에는 blendv가 없으므로 and/andnot/or로 선택
+static inline __m128i select_128(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static size_t shell_pass_sse2(int arr[], size_t n, size_t gap) {
+    size_t i = gap;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(arr + i));
+        __m128i active = _mm_set1_epi32(-1);
+        size_t j = i;
+        while (j >= gap) {
+            __m128i prev = _mm_loadu_si128((const __m128i *)(arr + j - gap));
+            __m128i move = _mm_and_si128(active, _mm_cmpgt_epi32(prev, v));
+            if (DS_COUNTERS_ENABLED) {
+                DS_COUNT_CMP(__builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(active))));
+                DS_COUNT_MOVE(__builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(move))));
+            }
+            if (_mm_movemask_epi8(move) == 0) {
+                break;
+            }
+            __m128i cur = _mm_loadu_si128((const __m128i *)(arr + j));
+            cur = select_128(_mm_andnot_si128(move, active), v, cur);
+            cur = select_128(move, prev, cur);
+            _mm_storeu_si128((__m128i *)(arr + j), cur);
+            active = move;
+            j -= gap;
+        }
+        __m128i cur = _mm_loadu_si128((const __m128i *)(arr + j));
+        _mm_storeu_si128((__m128i *)(arr + j), select_128(active, v, cur));
+        DS_COUNT_MOVE(4);
+    }
+    return i;
+}
+#endif
+
+static void shell_pass(int arr[], size_t n, size_t gap) {
+    size_t start = gap;
+#if SHELL_HAVE_AVX2
+    if (gap >= 8 && __builtin_cpu_supports("avx2")) {
+        start = shell_pass_avx2(arr, n, gap);
+    } else
+#endif
+#if defined(__SSE2__)
+    if (gap >= 4) {
+        start = shell_pass_sse2(arr, n, gap);
+    }
+#endif
+    for (size_t i = start; i < n; i++) {
+        int temp = arr[i];
+        size_t j = i;
+        while (j >= gap && DS_CMP(arr[j - gap] > temp)) {
+            arr[j] = arr[j - gap];
+            j -= gap;
+        }
+        arr[j] = temp;
+        DS_COUNT_MOVE((i - j) / gap + 1);
+    }
+}
+
+void ds_shell_sort_gaps(int arr[], size_t n, DsShellGaps seq) {
+    if (seq == DS_SHELL_GAPS_PRATT) {
+        for (size_t gap = n; gap > 1;) {
+            gap = pratt_gap_below(gap);
+            shell_pass(arr, n, gap);
+        }
+        return;
+    }
+    size_t gaps[SHELL_MAX_GAPS];
+    for (size_t k = formula_gaps(seq, n, gaps); k-- > 0;) {
+        shell_pass(arr, n, gaps[k]);
+    }
+}
+
+void ds_shell_sort(int arr[], size_t n) {
+    ds_shell_sort_gaps(arr, n, DS_SHELL_GAPS_CIURA);
+}
+
+// ==================== 병합 정렬 ====================
+
+// arr[left..mid)와 arr[mid..right)를 병합 (왼쪽 절반만 temp로 복사)
+static void merge(int arr[], int temp[], size_t left, size_t mid, size_t right) {
+    size_t n1 = mid - left;
+    memcpy(temp, arr + left, n1 * sizeof(int));
+
+    size_t i = 0, j = mid, k = left;
+    while (i < n1 && j < right) {
+        arr[k++] = DS_CMP(temp[i] <= arr[j]) ? temp[i++] : arr[j++];   // <=: 안정 정렬
+    }
+    while (i < n1) {
+        arr[k++] = temp[i++];
+    }
+    DS_COUNT_MOVE(n1 + (k - left));   // temp 복사 + 출력
+    // 오른쪽 나머지는 이미 제자리
+}
+
+#define MERGE_SMALL_CUTOFF 32   // 이 크기 이하 구간은 작은 배열 커널로 정렬 (int는 안정성 무관)
+
+static void merge_sort_recursive(int arr[], int temp[], size_t left, size_t right) {
+    if (right - left <= MERGE_SMALL_CUTOFF) {
+        ds_small_sort(arr + left, right - left);
+        return;
+    }
+    size_t mid = left + (right - left) / 2;
+    merge_sort_recursive(arr, temp, left, mid);
+    merge_sort_recursive(arr, temp, mid, right);
+    if (DS_CMP(arr[mid - 1] <= arr[mid])) {
+        return;   // 이미 순서대로면 병합 생략
+    }
+    merge(arr, temp, left, mid, right);
+}
+
+bool ds_merge_sort(int arr[], size_t n) {
+    if (n < 2) {
+        return true;
+    }
+    int *temp = malloc((n / 2 + 1) * sizeof(int));
+    if (temp == NULL) {
+        return false;
+    }
+    merge_sort_recursive(arr, temp, 0, n);
+    free(temp);
+    return true;
+}
+
+// ==================== 퀵 정렬 ====================
+
+// Lomuto 분할: arr[low..high], 피벗 = arr[high]
+static size_t partition(int arr[], size_t low, size_t high) {
+    int pivot = arr[high];
+    size_t i = low;
+    for (size_t j = low; j < high; j++) {
+        if (DS_CMP(arr[j] <= pivot)) {
+            swap_int(&arr[i], &arr[j]);
+            i++;
+        }
+    }
+    swap_int(&arr[i], &arr[high]);
+    return i;
+}
+
+void ds_quick_sort(int arr[], size_t n) {
+    size_t low = 0, high = n;   // 반열린 구간 [low, high)
+
+    while (high - low > 1) {
+        size_t pi = partition(arr, low, high - 1);
+        // 작은 쪽 재귀, 큰 쪽은 반복
+        if (pi - low < high - pi - 1) {
+            ds_quick_sort(arr + low, pi - low);
+            low = pi + 1;
+        } else {
+            ds_quick_sort(arr + pi + 1, high - pi - 1);
+            high = pi;
+        }
+    }
+}
+
+// ==================== 힙 정렬 ====================
+
+// 교재 방식 하향 이동: 단계마다 두 자식 비교 + 자식과 item 비교 (비교 2번)
+static void heapify(int arr[], size_t n, size_t i) {
+    int item = arr[i];
+    size_t child;
+    while ((child = 2 * i + 1) < n) {
+        if (child + 1 < n && DS_CMP(arr[child + 1] > arr[child])) {
+            child++;
+        }
+        if (DS_CMP(arr[child] <= item)) {
+            break;
+        }
+        arr[i] = arr[child];
+        DS_COUNT_MOVE(1);
+        i = child;
+    }
+    arr[i] = item;
+    DS_COUNT_MOVE(1);
+}
+
+void ds_heap_sort_top_down(int arr[], size_t n) {
+    for (size_t i = n / 2; i-- > 0;) {
+        heapify(arr, n, i);
+    }
+    for (size_t i = n; i-- > 1;) {
+        swap_int(&arr[0], &arr[i]);
+        heapify(arr, i, 0);
+    }
+}
+
+/**
+ * 상향식(bottom-up) 하향 이동 (Wegener)
+ * 1) 구멍을 item과 비교하지 않고 큰 자식 쪽으로 리프까지 내린다 (단계당 비교 1번, 분기 없이 선택)
+ * 2) 리프에서 item이 들어갈 자리까지 거슬러 올라간다
+ * 힙 정렬에서 루트로 올린 원소는 원래 리프였으므로 2)는 평균 1~2단계로 끝난다.
+ */
+static void sift_bottom_up(int arr[], size_t n, size_t i) {
+    int item = arr[i];
+    size_t hole = i;
+    size_t child;
+
+    while ((child = 2 * hole + 2) < n) {   // 자식 둘 다 있음
+        // 증손자 8개(32바이트) 미리 읽기: 손자는 다음 단계에서 바로 비교하므로 이미 늦다
+        if (8 * hole + 7 < n) {
+            __builtin_prefetch(&arr[8 * hole + 7]);
+        }
+        child -= DS_CMP(arr[child] < arr[child - 1]);
+        arr[hole] = arr[child];
+        DS_COUNT_MOVE(1);
+        hole = child;
+    }
+    if (child == n) {   // 왼쪽 자식만 있는 마지막 내부 노드
+        arr[hole] = arr[n - 1];
+        DS_COUNT_MOVE(1);
+        hole = n - 1;
+    }
+    while (hole > i) {
+        size_t parent = (hole - 1) / 2;
+        if (DS_CMP(arr[parent] >= item)) {
+            break;
+        }
+        arr[hole] = arr[parent];
+        DS_COUNT_MOVE(1);
+        hole = parent;
+    }
+    arr[hole] = item;
+    DS_COUNT_MOVE(1);
+}
+
+// Floyd 힙 구성(O(n))과 정렬 단계 모두 상향식 하향 이동 사용
+void ds_heap_sort(int arr[], size_t n) {
+    for (size_t i = n / 2; i-- > 0;) {
+        sift_bottom_up(arr, n, i);
+    }
+    for (size_t i = n; i-- > 1;) {
+        swap_int(&arr[0], &arr[i]);
+        sift_bottom_up(arr, i, 0);
+    }
+}
+
+// ==================== 인트로 정렬 (Introsort) ====================
+
+#define INTRO_SMALL_CUTOFF 32        // 이 크기 이하 구간은 작은 배열 커널(정렬 네트워크)로 마무리
+#define INTRO_NINTHER_THRESHOLD 128  // 이 크기 초과 구간은 ninther로 피벗 선택
+
+// 세 원소를 *a <= *b <= *c 순서로 정렬
+static inline void sort3(int *a, int *b, int *c) {
+    if (DS_CMP(*b < *a)) {
+        swap_int(a, b);
+    }
+    if (DS_CMP(*c < *b)) {
+        swap_int(b, c);
+    }
+    if (DS_CMP(*b < *a)) {
+        swap_int(a, b);
+    }
+}
+
+/**
+ * 피벗을 골라 arr[0]으로 옮긴다
+ * - 작은 구간: 처음/가운데/끝의 중앙값 (median-of-three)
+ * - 큰 구간: 세 그룹 중앙값들의 중앙값 (Tukey ninther)
+ * 정렬/역순/거의 정렬된 입력에서도 가운데 근처 값이 선택된다.
+ */
+static void choose_pivot(int arr[], size_t n) {
+    size_t mid = n / 2;
+    if (n > INTRO_NINTHER_THRESHOLD) {
+        size_t s = n / 8;
+        sort3(&arr[0], &arr[s], &arr[2 * s]);
+        sort3(&arr[mid - s], &arr[mid], &arr[mid + s]);
+        sort3(&arr[n - 1 - 2 * s], &arr[n - 1 - s], &arr[n - 1]);
+        sort3(&arr[s], &arr[mid], &arr[n - 1 - s]);
+    } else {
+        sort3(&arr[0], &arr[mid], &arr[n - 1]);
+    }
+    swap_int(&arr[0], &arr[mid]);
+}
+
+/**
+ * Hoare 분할: 피벗 arr[0] 기준으로 나누고 피벗의 최종 위치를 반환
+ * 양쪽 모두 피벗과 같은 값에서 멈추므로 중복 키가 많아도 균형 있게 나뉜다.
+ */
+static size_t hoare_partition(int arr[], size_t n) {
+    int pivot = arr[0];
+    size_t i = 0, j = n;
+    for (;;) {
+        do {
+            i++;
+        } while (i < n && DS_CMP(arr[i] < pivot));
+        do {
+            j--;
+        } while (DS_CMP(arr[j] > pivot));   // arr[0] == pivot에서 반드시 멈춤
+        if (i >= j) {
+            break;
+        }
+        swap_int(&arr[i], &arr[j]);
+    }
+    swap_int(&arr[0], &arr[j]);
+    return j;
+}
+
+static void intro_sort_loop(int arr[], size_t n, unsigned depth_limit) {
+    while (n > INTRO_SMALL_CUTOFF) {
+        if (depth_limit == 0) {
+            ds_heap_sort(arr, n);   // 분할이 계속 치우침 → O(n log n) 보장
+            return;
+        }
+        depth_limit--;
+
+        choose_pivot(arr, n);
+        size_t p = hoare_partition(arr, n);
+        // 작은 쪽 재귀, 큰 쪽은 반복
+        if (p < n - p - 1) {
+            intro_sort_loop(arr, p, depth_limit);
+            arr += p + 1;
+            n -= p + 1;
+        } else {
+            intro_sort_loop(arr + p + 1, n - p - 1, depth_limit);
+            n = p;
+        }
+    }
+    ds_small_sort(arr, n);
+}
+
+void ds_intro_sort(int arr[], size_t n) {
+    unsigned depth_limit = 0;
+    for (size_t m = n; m > 1; m >>= 1) {
+        depth_limit += 2;   // 2·⌊log2 n⌋
+    }
+    intro_sort_loop(arr, n, depth_limit);
+}
+
+// ==================== 선택 (nth_element / partial_sort) ====================
+//
+// 인트로 정렬의 분할을 그대로 쓰되 k가 들어 있는 쪽만 계속 나눈다 (quickselect).
+// 분할이 2·log2(n)번 넘게 치우치면 median-of-medians 피벗으로 바꿔 최악 O(n)을 보장한다.
+
+static void select_loop(int arr[], size_t n, size_t k, unsigned depth_limit);
+
+/**
+ * median-of-medians 피벗을 arr[0]으로 옮긴다
+ * 5개씩 묶은 그룹의 중앙값을 앞쪽에 모으고 그 중앙값을 다시 선택한다.
+ * 피벗보다 작은 값과 큰 값이 각각 최소 3n/10개 → 분할 후 남는 쪽은 7n/10 이하
+ */
+static void median_of_medians_pivot(int arr[], size_t n) {
+    size_t groups = n / 5;
+    for (size_t g = 0; g < groups; g++) {
+        int *group = arr + 5 * g;
+        ds_small_sort(group, 5);
+        swap_int(&arr[g], &group[2]);
+    }
+    select_loop(arr, groups, groups / 2, 0);   // 중앙값들 안에서도 최악 O(n) 경로
+    swap_int(&arr[0], &arr[groups / 2]);
+}
+
+static void select_loop(int arr[], size_t n, size_t k, unsigned depth_limit) {
+    while (n > INTRO_SMALL_CUTOFF) {
+        if (depth_limit == 0) {
+            median_of_medians_pivot(arr, n);
+        } else {
+            depth_limit--;
+            choose_pivot(arr, n);
+        }
+        size_t p = hoare_partition(arr, n);
+        if (k == p) {
+            return;
+        }
+        if (k < p) {
+            n = p;
+        } else {
+            arr += p + 1;
+            n -= p + 1;
+            k -= p + 1;
+        }
+    }
+    ds_small_sort(arr, n);
+}
+
+void ds_nth_element(int arr[], size_t n, size_t k) {
+    if (k >= n) {
+        return;
+    }
+    unsigned depth_limit = 0;
+    for (size_t m = n; m > 1; m >>= 1) {
+        depth_limit += 2;   // 2·⌊log2 n⌋
+    }
+    select_loop(arr, n, k, depth_limit);
+}
+
+void ds_partial_sort(int arr[], size_t n, size_t k) {
+    if (k >= n) {
+        ds_intro_sort(arr, n);
+        return;
+    }
+    if (k == 0) {
+        return;
+    }
+    ds_nth_element(arr, n, k);   // arr[0..k) <= arr[k] <= arr[k+1..n)
+    ds_intro_sort(arr, k);
+}
+
+// ==================== 블록 분할 퀵 정렬 (pdqsort) ====================
+//
+// Pattern-defeating quicksort (Orson Peters)와 BlockQuicksort (Edelkamp & Weiß) 방식.
+// - 분할: 비교 결과를 오프셋 버퍼에 모은 뒤 한꺼번에 교환 → 분기 예측 실패 제거
+// - 패턴 감지: 이미 정렬/역순/같은 키가 많은 입력을 선형 시간에 처리
+// - 분할이 log2(n)번 넘게 치우치면 힙 정렬로 전환 (최악 O(n log n))
+
+#define PDQ_INSERTION_CUTOFF 24       // 이 크기 미만은 삽입 정렬
+#define PDQ_NINTHER_THRESHOLD 128     // 이 크기 초과는 ninther 피벗
+#define PDQ_PARTIAL_INSERTION_LIMIT 8 // 부분 삽입 정렬이 포기하는 이동 횟수
+#define PDQ_BLOCK_SIZE 64             // 오프셋 블록 크기 (unsigned char 범위 이내)
+
+// begin[-1]이 구간의 모든 원소 이하임이 보장될 때의 삽입 정렬 (경계 검사 생략)
+static void unguarded_insertion_sort(int *begin, int *end) {
+    for (int *cur = begin + 1; cur < end; cur++) {
+        int key = *cur;
+        int *sift = cur;
+        while (DS_CMP(key < sift[-1])) {
+            *sift = sift[-1];
+            sift--;
+        }
+        *sift = key;
+        DS_COUNT_MOVE(cur - sift + 1);
+    }
+}
+
+/**
+ * 이동 횟수가 한도를 넘으면 중단하는 삽입 정렬
+ * @return 끝까지 정렬했으면 true (이미 거의 정렬된 구간)
+ */
+static bool partial_insertion_sort(int *begin, int *end) {
+    size_t moves = 0;
+    for (int *cur = begin + 1; cur < end; cur++) {
+        int key = *cur;
+        int *sift = cur;
+        while (sift > begin && DS_CMP(key < sift[-1])) {
+            *sift = sift[-1];
+            sift--;
+        }
+        *sift = key;
+        DS_COUNT_MOVE(cur - sift + 1);
+        moves += (size_t)(cur - sift);
+        if (moves > PDQ_PARTIAL_INSERTION_LIMIT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 오프셋 쌍이 가리키는 원소들을 교환
+ * 개수가 다르면 순환 이동(cyclic permutation)으로 대입 횟수를 줄인다.
+ */
+static void swap_offsets(int *first, int *last, const unsigned char *offsets_l,
+                         const unsigned char *offsets_r, size_t num, bool use_swaps) {
+    if (use_swaps) {
+        for (size_t i = 0; i < num; i++) {
+            swap_int(first + offsets_l[i], last - offsets_r[i]);
+        }
+    } else if (num > 0) {
+        int *l = first + offsets_l[0];
+        int *r = last - offsets_r[0];
+        int temp = *l;
+        *l = *r;
+        for (size_t i = 1; i < num; i++) {
+            l = first + offsets_l[i];
+            *r = *l;
+            r = last - offsets_r[i];
+            *l = *r;
+        }
+        *r = temp;
+        DS_COUNT_MOVE(2 * num + 1);   // 순환 이동: 교환 num번 대신 대입 2·num + 1번
+    }
+}
+
+/**
+ * 블록 분할: 피벗 *begin 기준으로 [< 피벗 | 피벗 | >= 피벗]
+ * @param already_partitioned 교환이 한 번도 필요 없었는지 (정렬된 입력 감지)
+ * @return 피벗의 최종 위치
+ */
+static int *partition_right_branchless(int *begin, int *end, bool *already_partitioned) {
+    int pivot = *begin;
+    int *first = begin;
+    int *last = end;
+
+    // 피벗 이상인 첫 원소 (median-of-three가 존재를 보장)
+    while (DS_CMP(*++first < pivot)) {
+    }
+    // 피벗 미만인 마지막 원소 (앞쪽에 원소가 없었다면 경계 검사 필요)
+    if (first - 1 == begin) {
+        while (first < last && !DS_CMP(*--last < pivot)) {
+        }
+    } else {
+        while (!DS_CMP(*--last < pivot)) {
+        }
+    }
+
+    *already_partitioned = first >= last;
+    if (!*already_partitioned) {
+        swap_int(first, last);
+        first++;
+
+        _Alignas(64) unsigned char offsets_l[PDQ_BLOCK_SIZE];
+        _Alignas(64) unsigned char offsets_r[PDQ_BLOCK_SIZE];
+        int *offsets_l_base = first;
+        int *offsets_r_base = last;
+        size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (first < last) {
+            // 남은 구간을 양쪽 블록에 나눠 배정
+            size_t num_unknown = (size_t)(last - first);
+            size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+            // 비교 결과를 분기 없이 오프셋으로 기록: 조건이 참일 때만 num이 증가
+            if (left_split > PDQ_BLOCK_SIZE) {
+                left_split = PDQ_BLOCK_SIZE;
+            }
+            DS_COUNT_CMP(left_split);
+            for (size_t i = 0; i < left_split; i++) {
+                offsets_l[num_l] = (unsigned char)i;
+                num_l += !(*first < pivot);
+                first++;
+            }
+            if (right_split > PDQ_BLOCK_SIZE) {
+                right_split = PDQ_BLOCK_SIZE;
+            }
+            DS_COUNT_CMP(right_split);
+            for (size_t i = 0; i < right_split;) {
+                offsets_r[num_r] = (unsigned char)++i;
+                num_r += *--last < pivot;
+            }
+
+            // 양쪽에서 잘못 놓인 원소끼리 교환
+            size_t num = num_l < num_r ? num_l : num_r;
+            swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l,
+                         offsets_r + start_r, num, num_l == num_r);
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // 한쪽 블록에 남은 원소를 경계 쪽으로 밀어 넣는다
+        if (num_l > 0) {
+            while (num_l-- > 0) {
+                swap_int(offsets_l_base + offsets_l[start_l + num_l], --last);
+            }
+            first = last;
+        }
+        if (num_r > 0) {
+            while (num_r-- > 0) {
+                swap_int(offsets_r_base - offsets_r[start_r + num_r], first);
+                first++;
+            }
+        }
+    }
+
+    int *pivot_pos = first - 1;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    DS_COUNT_MOVE(2);
+    return pivot_pos;
+}
+
+/**
+ * 같은 키 분할: [<= 피벗 | > 피벗], 피벗의 최종 위치 반환
+ * 피벗이 앞 구간의 최댓값과 같을 때 사용 → 왼쪽은 모두 같은 값이라 재귀 불필요
+ */
+static int *partition_left(int *begin, int *end) {
+    int pivot = *begin;
+    int *first = begin;
+    int *last = end;
+
+    while (DS_CMP(pivot < *--last)) {
+    }
+    if (last + 1 == end) {
+        while (first < last && !DS_CMP(pivot < *++first)) {
+        }
+    } else {
+        while (!DS_CMP(pivot < *++first)) {
+        }
+    }
+    while (first < last) {
+        swap_int(first, last);
+        while (DS_CMP(pivot < *--last)) {
+        }
+        while (!DS_CMP(pivot < *++first)) {
+        }
+    }
+
+    *begin = *last;
+    *last = pivot;
+    DS_COUNT_MOVE(2);
+    return last;
+}
+
+// 치우친 분할 뒤 패턴을 깨기 위해 몇 원소를 섞는다
+static void break_patterns(int *begin, int *pivot_pos, int *end) {
+    size_t l_size = (size_t)(pivot_pos - begin);
+    size_t r_size = (size_t)(end - (pivot_pos + 1));
+
+    if (l_size >= PDQ_INSERTION_CUTOFF) {
+        swap_int(begin, begin + l_size / 4);
+        swap_int(pivot_pos - 1, pivot_pos - l_size / 4);
+        if (l_size > PDQ_NINTHER_THRESHOLD) {
+            swap_int(begin + 1, begin + (l_size / 4 + 1));
+            swap_int(begin + 2, begin + (l_size / 4 + 2));
+            swap_int(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+            swap_int(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+    }
+    if (r_size >= PDQ_INSERTION_CUTOFF) {
+        swap_int(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        swap_int(end - 1, end - r_size / 4);
+        if (r_size > PDQ_NINTHER_THRESHOLD) {
+            swap_int(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+            swap_int(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+            swap_int(end - 2, end - (1 + r_size / 4));
+            swap_int(end - 3, end - (2 + r_size / 4));
+        }
+    }
+}
+
+/**
+ * @param bad_allowed 남은 치우친 분할 허용 횟수 (0이 되면 힙 정렬)
+ * @param leftmost    전체 배열의 맨 왼쪽 구간인지 (아니면 begin[-1]이 하한 역할)
+ */
+static void pdq_sort_loop(int *begin, int *end, unsigned bad_allowed, bool leftmost) {
+    for (;;) {
+        size_t size = (size_t)(end - begin);
+        if (size < PDQ_INSERTION_CUTOFF) {
+            if (leftmost) {
+                ds_insertion_sort(begin, size);
+            } else {
+                unguarded_insertion_sort(begin, end);
+            }
+            return;
+        }
+
+        // 피벗을 *begin에 둔다
+        size_t s2 = size / 2;
+        if (size > PDQ_NINTHER_THRESHOLD) {
+            sort3(begin, begin + s2, end - 1);
+            sort3(begin + 1, begin + (s2 - 1), end - 2);
+            sort3(begin + 2, begin + (s2 + 1), end - 3);
+            sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1));
+            swap_int(begin, begin + s2);
+        } else {
+            sort3(begin + s2, begin, end - 1);
+        }
+
+        // 피벗이 앞 구간의 최댓값과 같다 → 같은 키가 많음, 같은 값 묶음을 한 번에 건너뜀
+        if (!leftmost && !DS_CMP(begin[-1] < *begin)) {
+            begin = partition_left(begin, end) + 1;
+            continue;
+        }
+
+        bool already_partitioned;
+        int *pivot_pos = partition_right_branchless(begin, end, &already_partitioned);
+        size_t l_size = (size_t)(pivot_pos - begin);
+        size_t r_size = (size_t)(end - (pivot_pos + 1));
+
+        if (l_size < size / 8 || r_size < size / 8) {
+            if (--bad_allowed == 0) {
+                ds_heap_sort(begin, size);
+                return;
+            }
+            break_patterns(begin, pivot_pos, end);
+        } else if (already_partitioned
+                   && partial_insertion_sort(begin, pivot_pos)
+                   && partial_insertion_sort(pivot_pos + 1, end)) {
+            return;   // 이미 정렬된 구간: 분할 1회 + 선형 확인으로 종료
+        }
+
+        // 왼쪽은 재귀, 오른쪽은 반복
+        pdq_sort_loop(begin, pivot_pos, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+void ds_pdq_sort(int arr[], size_t n) {
+    if (n < 2) {
+        return;
+    }
+    // 전체가 내림차순이면 뒤집기만 하면 된다 (정렬된 입력은 분할 단계에서 감지)
+    size_t run = 1;
+    while (run < n && DS_CMP(arr[run] <= arr[run - 1])) {
+        run++;
+    }
+    if (run == n) {
+        for (size_t i = 0, j = n - 1; i < j; i++, j--) {
+            swap_int(&arr[i], &arr[j]);
+        }
+        return;
+    }
+
+    unsigned bad_allowed = 0;
+    for (size_t m = n; m > 1; m >>= 1) {
+        bad_allowed++;
+    }
+    pdq_sort_loop(arr, arr + n, bad_allowed, true);
+}
+
+// ==================== 기수 정렬 ====================
+
+#define RADIX 10
+
+bool ds_radix_sort(int arr[], size_t n) {
+    if (n < 2) {
+        return true;
+    }
+    int *output = malloc(n * sizeof(int));
+    if (output == NULL) {
+        return false;
+    }
+
+    int max = arr[0];
+    for (size_t i = 1; i < n; i++) {
+        if (arr[i] > max) {
+            max = arr[i];
+        }
+    }
+
+    for (long long exp = 1; max / exp > 0; exp *= RADIX) {
+        size_t count[RADIX] = {0};
+        for (size_t i = 0; i < n; i++) {
+            count[(arr[i] / exp) % RADIX]++;
+        }
+        for (int d = 1; d < RADIX; d++) {
+            count[d] += count[d - 1];
+        }
+        for (size_t i = n; i-- > 0;) {
+            output[--count[(arr[i] / exp) % RADIX]] = arr[i];
+        }
+        memcpy(arr, output, n * sizeof(int));
+        DS_COUNT_MOVE(2 * n);   // 분배 + 되돌려 복사 (비교 없음)
+    }
+
+    free(output);
+    return true;
+}
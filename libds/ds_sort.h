@@ -0,0 +1,122 @@
+/**
+ * ds_sort.h: 정수 배열 정렬 (chapter12 기반)
+ *
+ * 모든 함수는 arr[0..n-1]을 오름차순으로 제자리 정렬한다.
+ * 추가 메모리가 필요한 정렬은 bool을 반환한다 (메모리 부족 시 false, 배열은 변경되지 않음).
+ *
+ * | 함수                 | 평균        | 최악        | 안정 | 추가 메모리 |
+ * |----------------------|-------------|-------------|------|-------------|
+ * | ds_selection_sort    | O(n²)       | O(n²)       | X    | O(1)        |
+ * | ds_insertion_sort    | O(n²)       | O(n²)       | O    | O(1)        |
+ * | ds_bubble_sort       | O(n²)       | O(n²)       | O    | O(1)        |
+ * | ds_shell_sort        | ~O(n^1.25)  | 미증명      | X    | O(1)        |
+ * | ds_merge_sort        | O(n log n)  | O(n log n)  | O    | O(n)        |
+ * | ds_quick_sort        | O(n log n)  | O(n²)       | X    | O(log n)    |
+ * | ds_heap_sort         | O(n log n)  | O(n log n)  | X    | O(1)        |
+ * | ds_intro_sort        | O(n log n)  | O(n log n)  | X    | O(log n)    |
+ * | ds_pdq_sort          | O(n log n)  | O(n log n)  | X    | O(log n)    |
+ * | ds_radix_sort        | O(d·n)      | O(d·n)      | O    | O(n)        |
+ *
+ * 선택 (전체를 정렬하지 않고 k개만 필요할 때):
+ * | ds_nth_element       | O(n)        | O(n)        | X    | O(log n)    |
+ * | ds_partial_sort      | O(n+k lg k) | O(n+k lg k) | X    | O(log n)    |
+ */
+
+#ifndef DS_SORT_H
+#define DS_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+void ds_selection_sort(int arr[], size_t n);
+void ds_insertion_sort(int arr[], size_t n);
+void ds_bubble_sort(int arr[], size_t n);
+
+// 쉘 정렬 간격 수열
+typedef enum {
+    DS_SHELL_GAPS_KNUTH,       // (3^k - 1) / 2: 1, 4, 13, 40, 121, ...  최악 O(n^1.5)
+    DS_SHELL_GAPS_CIURA,       // 1, 4, 10, 23, 57, 132, 301, 701, 1750, 이후 ×2.25 (실험적 최적)
+    DS_SHELL_GAPS_TOKUDA,      // ⌈(9^k - 4^k) / (5·4^(k-1))⌉: 1, 4, 9, 20, 46, 103, ...
+    DS_SHELL_GAPS_SEDGEWICK,   // 1, 4^k + 3·2^(k-1) + 1: 1, 8, 23, 77, 281, ...  최악 O(n^4/3)
+    DS_SHELL_GAPS_PRATT        // 2^p·3^q: 1, 2, 3, 4, 6, 8, 9, 12, ...  최악 O(n log² n)
+} DsShellGaps;
+
+/**
+ * 쉘 정렬 (추가 메모리 없음, 간격 목록도 스택에 고정 크기)
+ * 간격이 벡터 레인 수 이상인 단계는 SSE2/AVX2로 여러 체인의 삽입을 함께 진행한다
+ * (AVX2는 실행 시 CPU 지원 여부를 확인).
+ */
+void ds_shell_sort_gaps(int arr[], size_t n, DsShellGaps seq);
+void ds_shell_sort(int arr[], size_t n);   // Ciura 간격
+
+/**
+ * n개 정렬에 쓰이는 간격을 큰 것부터 gaps에 기록 (최대 capacity개)
+ * @return 전체 간격 수 (capacity보다 크면 앞부분만 기록됨, capacity = 0이면 개수만 계산)
+ */
+size_t ds_shell_gaps(DsShellGaps seq, size_t n, size_t gaps[], size_t capacity);
+
+/**
+ * 병합 정렬: 임시 버퍼를 한 번만 할당해 모든 병합 단계에서 재사용
+ * 32개 이하 구간은 ds_small_sort(정렬 네트워크)로 정렬
+ */
+bool ds_merge_sort(int arr[], size_t n);
+
+/**
+ * 퀵 정렬 (Lomuto 분할, 마지막 원소 피벗)
+ * 작은 쪽만 재귀하고 큰 쪽은 반복 → 재귀 깊이 O(log n)
+ */
+void ds_quick_sort(int arr[], size_t n);
+
+/**
+ * 힙 정렬: 상향식(bottom-up, Wegener) 하향 이동
+ * 구멍을 큰 자식 쪽으로 리프까지 내린 뒤(단계당 비교 1번, 분기 없는 자식 선택, 두 단계 앞 프리페치)
+ * 원소가 들어갈 자리까지 거슬러 올라간다. 비교 횟수 약 n log2 n (교재 방식의 절반).
+ * 힙 구성도 같은 방식으로 O(n) (Floyd)
+ */
+void ds_heap_sort(int arr[], size_t n);
+
+/**
+ * 교재 방식 힙 정렬 (하향 이동 단계마다 비교 2번, 비교용)
+ */
+void ds_heap_sort_top_down(int arr[], size_t n);
+
+/**
+ * 인트로 정렬 (퀵 + 힙 정렬 + 작은 배열 커널 혼합)
+ * - 피벗: median-of-three, 큰 구간은 ninther
+ * - 재귀 깊이가 2·log2(n)을 넘으면 해당 구간을 힙 정렬로 전환
+ * - 32개 이하 구간은 ds_small_sort(정렬 네트워크)로 마무리
+ * 정렬/역순/거의 정렬된 입력에서도 최악 O(n log n), 재귀 깊이 O(log n)
+ */
+void ds_intro_sort(int arr[], size_t n);
+
+/**
+ * 블록 분할 퀵 정렬 (pdqsort / BlockQuicksort 방식)
+ * - 분할 시 비교 결과를 오프셋 블록에 모아 분기 없이 교환
+ * - 정렬/역순/같은 키가 많은 입력은 선형 시간에 처리
+ * - 치우친 분할이 log2(n)번을 넘으면 힙 정렬로 전환
+ */
+void ds_pdq_sort(int arr[], size_t n);
+
+/**
+ * k번째로 작은 값 선택 (introselect, 0-based k)
+ * arr[k]에 정렬했을 때의 값이 오고, arr[0..k)는 그 이하, arr[k+1..n)은 그 이상이 된다
+ * (양쪽 내부 순서는 정해지지 않음). k >= n이면 아무것도 하지 않는다.
+ * - 인트로 정렬과 같은 피벗/분할로 k가 있는 쪽만 반복 → 평균 O(n)
+ * - 분할이 2·log2(n)번 넘게 치우치면 median-of-medians 피벗으로 전환 → 최악 O(n)
+ *
+ * 가장 큰 k개: ds_nth_element(arr, n, n - k) 후 arr[n-k..n)
+ */
+void ds_nth_element(int arr[], size_t n, size_t k);
+
+/**
+ * 부분 정렬: 가장 작은 k개를 arr[0..k)에 오름차순으로 놓는다 (나머지 순서는 정해지지 않음)
+ * ds_nth_element로 k개를 골라낸 뒤 그 구간만 인트로 정렬 → O(n + k log k)
+ */
+void ds_partial_sort(int arr[], size_t n, size_t k);
+
+/**
+ * 기수 정렬 (LSD, 10진 자릿수) - 음이 아닌 정수만 지원
+ */
+bool ds_radix_sort(int arr[], size_t n);
+
+#endif // DS_SORT_H
@@ -0,0 +1,41 @@
+/*
+ * ds_stack.c: 동적 배열 스택
+ */
+
+#include "ds_stack.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define DS_STACK_INIT_CAPACITY 16
+
+void ds_stack_init(DsStack *s) {
+    s->data = NULL;
+    s->size = 0;
+    s->capacity = 0;
+}
+
+void ds_stack_destroy(DsStack *s) {
+    free(s->data);
+    ds_stack_init(s);
+}
+
+bool ds_stack_reserve(DsStack *s, size_t capacity) {
+    if (capacity < DS_STACK_INIT_CAPACITY) {
+        capacity = DS_STACK_INIT_CAPACITY;
+    }
+    if (capacity <= s->capacity) {
+        return true;
+    }
+    if (capacity > SIZE_MAX / sizeof(int)) {
+        return false;
+    }
+
+    int *new_data = realloc(s->data, capacity * sizeof(int));
+    if (new_data == NULL) {
+        return false;
+    }
+    s->data = new_data;
+    s->capacity = capacity;
+    return true;
+}
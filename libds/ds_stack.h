@@ -0,0 +1,74 @@
+/**
+ * ds_stack.h: 동적 배열 스택 (chapter04/stack_dynamic_array.c 기반)
+ *
+ * - 포화 시 용량을 2배로 확장 → push 분할 상환 O(1)
+ * - push/pop/peek는 헤더 인라인 (확장 경로만 함수 호출)
+ * - 출력/exit 없음: 실패는 false 반환으로 알린다
+ */
+
+#ifndef DS_STACK_H
+#define DS_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    int *data;         // 동적 배열
+    size_t size;       // 요소 개수 (다음 삽입 위치)
+    size_t capacity;   // 현재 용량
+} DsStack;
+
+void ds_stack_init(DsStack *s);
+void ds_stack_destroy(DsStack *s);
+
+/**
+ * 용량을 최소 capacity 이상으로 확보한다
+ * @return 성공 시 true, 메모리 부족 시 false (기존 내용 유지)
+ */
+bool ds_stack_reserve(DsStack *s, size_t capacity);
+
+static inline bool ds_stack_is_empty(const DsStack *s) {
+    return s->size == 0;
+}
+
+static inline size_t ds_stack_size(const DsStack *s) {
+    return s->size;
+}
+
+/**
+ * 삽입 연산 (포화 시 자동 확장)
+ * @return 성공 시 true, 메모리 부족 시 false
+ */
+static inline bool ds_stack_push(DsStack *s, int item) {
+    if (s->size == s->capacity && !ds_stack_reserve(s, s->capacity * 2)) {
+        return false;
+    }
+    s->data[s->size++] = item;
+    return true;
+}
+
+/**
+ * 삭제 연산
+ * @return 성공 시 true, 공백이면 false
+ */
+static inline bool ds_stack_pop(DsStack *s, int *item) {
+    if (s->size == 0) {
+        return false;
+    }
+    *item = s->data[--s->size];
+    return true;
+}
+
+/**
+ * 조회 연산: top 요소 확인
+ * @return 성공 시 true, 공백이면 false
+ */
+static inline bool ds_stack_peek(const DsStack *s, int *item) {
+    if (s->size == 0) {
+        return false;
+    }
+    *item = s->data[s->size - 1];
+    return true;
+}
+
+#endif // DS_STACK_H
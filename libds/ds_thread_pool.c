@@ -0,0 +1,153 @@
+/*
+ * ds_thread_pool.c: 고정 크기 스레드 풀 (POSIX threads)
+ *
+ * 대기열은 LIFO 스택: 재귀 분할에서 가장 최근에 만든(가장 작은) 작업을 먼저
+ * 꺼내므로 캐시에 남아 있는 데이터를 이어서 처리하게 된다.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ds_thread_pool.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define DS_POOL_INIT_CAPACITY 64
+
+typedef struct {
+    void (*fn)(void *arg);
+    void *arg;
+    DsTaskGroup *group;
+} DsTask;
+
+struct DsThreadPool {
+    pthread_mutex_t lock;
+    pthread_cond_t work_available;   // 작업 추가 / 종료 알림
+    pthread_cond_t work_done;        // 작업 완료/추가 알림 (wait 중인 스레드용)
+    DsTask *tasks;                   // LIFO 대기열
+    size_t num_tasks;
+    size_t capacity;
+    bool shutdown;
+    unsigned num_workers;
+    pthread_t *workers;
+};
+
+unsigned ds_cpu_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned)count : 1;
+}
+
+// lock을 잡은 상태에서 호출: 작업 하나를 꺼내 실행하고 완료 처리
+static void run_one_locked(DsThreadPool *pool) {
+    DsTask task = pool->tasks[--pool->num_tasks];
+    pthread_mutex_unlock(&pool->lock);
+    task.fn(task.arg);
+    pthread_mutex_lock(&pool->lock);
+    if (--task.group->pending == 0) {
+        pthread_cond_broadcast(&pool->work_done);
+    }
+}
+
+static void *worker_main(void *arg) {
+    DsThreadPool *pool = arg;
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->num_tasks == 0 && !pool->shutdown) {
+            pthread_cond_wait(&pool->work_available, &pool->lock);
+        }
+        if (pool->num_tasks == 0) {
+            break;   // 종료 요청 + 남은 작업 없음
+        }
+        run_one_locked(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+DsThreadPool *ds_thread_pool_create(unsigned num_workers) {
+    DsThreadPool *pool = calloc(1, sizeof(DsThreadPool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pool->tasks = malloc(DS_POOL_INIT_CAPACITY * sizeof(DsTask));
+    pool->workers = malloc((num_workers ? num_workers : 1) * sizeof(pthread_t));
+    if (pool->tasks == NULL || pool->workers == NULL) {
+        free(pool->tasks);
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+    pool->capacity = DS_POOL_INIT_CAPACITY;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_available, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    for (unsigned i = 0; i < num_workers; i++) {
+        if (pthread_create(&pool->workers[i], NULL, worker_main, pool) != 0) {
+            break;   // 만든 만큼만 사용
+        }
+        pool->num_workers++;
+    }
+    return pool;
+}
+
+void ds_thread_pool_destroy(DsThreadPool *pool) {
+    if (pool == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->work_available);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (unsigned i = 0; i < pool->num_workers; i++) {
+        pthread_join(pool->workers[i], NULL);
+    }
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_available);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool->tasks);
+    free(pool);
+}
+
+unsigned ds_thread_pool_num_workers(const DsThreadPool *pool) {
+    return pool->num_workers;
+}
+
+void ds_thread_pool_submit(DsThreadPool *pool, DsTaskGroup *group,
+                           void (*fn)(void *arg), void *arg) {
+    pthread_mutex_lock(&pool->lock);
+    if (pool->num_tasks == pool->capacity) {
+        DsTask *grown = NULL;
+        if (pool->capacity <= SIZE_MAX / 2 / sizeof(DsTask)) {
+            grown = realloc(pool->tasks, pool->capacity * 2 * sizeof(DsTask));
+        }
+        if (grown == NULL) {
+            pthread_mutex_unlock(&pool->lock);
+            fn(arg);   // 메모리 부족: 병렬성만 포기하고 결과는 동일
+            return;
+        }
+        pool->tasks = grown;
+        pool->capacity *= 2;
+    }
+    pool->tasks[pool->num_tasks++] = (DsTask){fn, arg, group};
+    group->pending++;
+    pthread_cond_signal(&pool->work_available);
+    pthread_cond_signal(&pool->work_done);   // wait 중인 스레드도 새 작업을 도울 수 있게
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void ds_thread_pool_wait(DsThreadPool *pool, DsTaskGroup *group) {
+    pthread_mutex_lock(&pool->lock);
+    while (group->pending > 0) {
+        if (pool->num_tasks > 0) {
+            run_one_locked(pool);   // 놀지 않고 대기열을 돕는다
+        } else {
+            pthread_cond_wait(&pool->work_done, &pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,60 @@
+/**
+ * ds_thread_pool.h: 고정 크기 스레드 풀 (fork-join 작업용)
+ *
+ * - 작업(task) = 함수 포인터 + 인자, 작업 그룹(DsTaskGroup) 단위로 완료를 기다린다
+ * - ds_thread_pool_wait는 기다리는 동안 대기열의 작업을 직접 실행한다
+ *   → 작업 안에서 다시 작업을 만들고 기다려도(재귀 분할) 교착 상태가 없다
+ * - 작업자 0개 풀도 허용: 모든 작업이 wait를 호출한 스레드에서 실행됨
+ *
+ * 사용 예:
+ *   DsTaskGroup group = DS_TASK_GROUP_INIT;
+ *   ds_thread_pool_submit(pool, &group, sort_left, &left);
+ *   sort_right(&right);                     // 호출 스레드도 일을 나눠 맡는다
+ *   ds_thread_pool_wait(pool, &group);
+ */
+
+#ifndef DS_THREAD_POOL_H
+#define DS_THREAD_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct DsThreadPool DsThreadPool;
+
+// 함께 기다릴 작업 묶음 (풀의 뮤텍스로 보호)
+typedef struct {
+    size_t pending;   // 아직 끝나지 않은 작업 수
+} DsTaskGroup;
+
+#define DS_TASK_GROUP_INIT {0}
+
+/**
+ * 온라인 CPU 코어 수 (알 수 없으면 1)
+ */
+unsigned ds_cpu_count(void);
+
+/**
+ * 작업자 스레드 num_workers개로 풀 생성
+ * @return 풀, 실패 시 NULL
+ */
+DsThreadPool *ds_thread_pool_create(unsigned num_workers);
+
+/**
+ * 대기 중인 작업을 모두 마친 뒤 작업자를 종료하고 해제
+ */
+void ds_thread_pool_destroy(DsThreadPool *pool);
+
+unsigned ds_thread_pool_num_workers(const DsThreadPool *pool);
+
+/**
+ * 작업 등록. 대기열을 늘릴 메모리가 없으면 호출 스레드에서 즉시 실행한다.
+ */
+void ds_thread_pool_submit(DsThreadPool *pool, DsTaskGroup *group,
+                           void (*fn)(void *arg), void *arg);
+
+/**
+ * group의 작업이 모두 끝날 때까지 대기 (대기 중에는 대기열의 작업을 대신 실행)
+ */
+void ds_thread_pool_wait(DsThreadPool *pool, DsTaskGroup *group);
+
+#endif // DS_THREAD_POOL_H
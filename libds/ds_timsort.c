@@ -0,0 +1,13 @@
+/*
+ * ds_timsort.c: int 배열용 TimSort (DS_DEFINE_TIM_SORT 특수화)
+ */
+
+#include "ds_timsort.h"
+
+#define INT_LESS(a, b) ((a) < (b))
+
+DS_DEFINE_TIM_SORT(int, int, INT_LESS)
+
+void ds_tim_sort(int arr[], size_t n, DsTimSortStats *stats) {
+    int_tim_sort(arr, n, stats);
+}
@@ -0,0 +1,542 @@
+/**
+ * ds_timsort.h: 자연 런 기반 적응형 안정 정렬 (TimSort, chapter12/merge_sort.c 확장)
+ *
+ * 교재의 병합 정렬은 입력 순서와 무관하게 항상 log2(n)단계를 병합한다.
+ * TimSort는 입력에 이미 있는 정렬 구간(런)을 이용한다.
+ *
+ * 1) 런 감지: 오름차순(같은 값 허용) 또는 엄격한 내림차순 구간을 찾고 내림차순은 뒤집는다
+ * 2) 짧은 런은 minrun(32~64)까지 이진 삽입 정렬로 늘린다
+ * 3) 런 스택의 길이 불변식(len[i-2] > len[i-1] + len[i], len[i-1] > len[i])을 유지하며 병합
+ *    → 병합 비용 O(n log r) (r: 런 수), 이미 정렬된 입력은 O(n)
+ * 4) 병합 전에 갤러핑으로 제자리에 있는 앞/뒤 구간을 잘라내고,
+ *    한쪽 런이 연속으로 이기면 갤러핑 모드(지수 탐색 + 블록 복사)로 전환
+ * 5) 임시 버퍼는 병합할 두 런 중 짧은 쪽 크기만 필요 (최대 n/2, 더 필요할 때만 다시 할당)
+ *    할당에 실패하면 버퍼 없는 제자리 병합(회전)으로 계속하므로 항상 성공한다
+ *
+ * int 배열은 ds_tim_sort, 레코드 등 다른 타입은 DS_DEFINE_TIM_SORT로 특수화한다.
+ *
+ *    #define RECORD_LESS(a, b) ((a).timestamp < (b).timestamp)
+ *    DS_DEFINE_TIM_SORT(record, Record, RECORD_LESS)   // record_tim_sort(arr, n, &stats)
+ */
+
+#ifndef DS_TIMSORT_H
+#define DS_TIMSORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ds_counters.h"
+
+typedef struct {
+    size_t runs;              // 감지한 자연 런 수 (minrun 확장 전)
+    size_t descending_runs;   // 그중 뒤집은 내림차순 런 수
+    size_t longest_run;       // 가장 긴 자연 런 길이
+    size_t min_run;           // 짧은 런을 늘린 최소 길이
+    size_t merges;            // 병합 횟수
+    size_t gallops;           // 갤러핑 모드 진입 횟수
+    size_t temp_peak;         // 임시 버퍼 최대 크기 (원소 수)
+} DsTimSortStats;
+
+/**
+ * int 배열 안정 정렬 (int에서는 안정성이 결과에 드러나지 않지만 런 통계는 같다)
+ * @param stats NULL 허용
+ */
+void ds_tim_sort(int arr[], size_t n, DsTimSortStats *stats);
+
+#define DS_TIM_MIN_GALLOP 7    // 갤러핑 모드 진입 기준 (연속 승리 횟수, 적응적으로 조정)
+#define DS_TIM_MAX_STACK 128   // 런 길이가 피보나치 이상으로 커지므로 size_t 범위에서 충분
+
+/**
+ * DS_DEFINE_TIM_SORT(prefix, TYPE, LESS): void prefix_tim_sort(TYPE arr[], size_t n,
+ *                                                              DsTimSortStats *stats) 생성
+ * LESS(a, b)는 TYPE 값 두 개를 받아 a가 b보다 앞이면 참인 식 (같은 값은 입력 순서 유지)
+ */
+#define DS_DEFINE_TIM_SORT(prefix, TYPE, LESS)                                    \
+    typedef struct {                                                              \
+        TYPE *temp;                                                               \
+        size_t temp_capacity;                                                     \
+        bool temp_failed;        /* 할당 실패 → 이후 제자리 병합 */               \
+        size_t min_gallop;                                                        \
+        size_t stack_size;                                                        \
+        TYPE *run_base[DS_TIM_MAX_STACK];                                         \
+        size_t run_len[DS_TIM_MAX_STACK];                                         \
+        DsTimSortStats *stats;                                                    \
+    } prefix##_TimState_;                                                         \
+                                                                                  \
+    /* a[0..n)에서 key를 넣을 가장 왼쪽 위치 (a[k-1] < key <= a[k]) */            \
+    static inline size_t prefix##_gallop_left_(const TYPE *key, const TYPE *a,    \
+                                               size_t n, size_t hint) {           \
+        size_t lo, hi, ofs = 1, last = 0;                                         \
+        if (DS_CMP(LESS(a[hint], *key))) {                                        \
+            size_t max = n - hint;                                                \
+            while (ofs < max && DS_CMP(LESS(a[hint + ofs], *key))) {              \
+                last = ofs;                                                       \
+                ofs = 2 * ofs + 1;                                                \
+            }                                                                     \
+            if (ofs > max) {                                                      \
+                ofs = max;                                                        \
+            }                                                                     \
+            lo = hint + last + 1;                                                 \
+            hi = hint + ofs;                                                      \
+        } else {                                                                  \
+            size_t max = hint + 1;                                                \
+            while (ofs < max && !DS_CMP(LESS(a[hint - ofs], *key))) {             \
+                last = ofs;                                                       \
+                ofs = 2 * ofs + 1;                                                \
+            }                                                                     \
+            if (ofs > max) {                                                      \
+                ofs = max;                                                        \
+            }                                                                     \
+            lo = hint + 1 - ofs;                                                  \
+            hi = hint - last;                                                     \
+        }                                                                         \
+        while (lo < hi) {                                                         \
+            size_t mid = lo + (hi - lo) / 2;                                      \
+            if (DS_CMP(LESS(a[mid], *key))) {                                     \
+                lo = mid + 1;                                                     \
+            } else {                                                              \
+                hi = mid;                                                         \
+            }                                                                     \
+        }                                                                         \
+        return lo;                                                                \
+    }                                                                             \
+                                                                                  \
+    /* a[0..n)에서 key를 넣을 가장 오른쪽 위치 (a[k-1] <= key < a[k]) */          \
+    static inline size_t prefix##_gallop_right_(const TYPE *key, const TYPE *a,   \
+                                                size_t n, size_t hint) {          \
+        size_t lo, hi, ofs = 1, last = 0;                                         \
+        if (DS_CMP(LESS(*key, a[hint]))) {                                        \
+            size_t max = hint + 1;                                                \
+            while (ofs < max && DS_CMP(LESS(*key, a[hint - ofs]))) {              \
+                last = ofs;                                                       \
+                ofs = 2 * ofs + 1;                                                \
+            }                                                                     \
+            if (ofs > max) {                                                      \
+                ofs = max;                                                        \
+            }                                                                     \
+            lo = hint + 1 - ofs;                                                  \
+            hi = hint - last;                                                     \
+        } else {                                                                  \
+            size_t max = n - hint;                                                \
+            while (ofs < max && !DS_CMP(LESS(*key, a[hint + ofs]))) {             \
+                last = ofs;                                                       \
+                ofs = 2 * ofs + 1;                                                \
+            }                                                                     \
+            if (ofs > max) {                                                      \
+                ofs = max;                                                        \
+            }                                                                     \
+            lo = hint + last + 1;                                                 \
+            hi = hint + ofs;                                                      \
+        }                                                                         \
+        while (lo < hi) {                                                         \
+            size_t mid = lo + (hi - lo) / 2;                                      \
+            if (DS_CMP(LESS(*key, a[mid]))) {                                     \
+                hi = mid;                                                         \
+            } else {                                                              \
+                lo = mid + 1;                                                     \
+            }                                                                     \
+        }                                                                         \
+        return lo;                                                                \
+    }                                                                             \
+                                                                                  \
+    /* a[0..start)가 정렬된 상태에서 a[start..n)을 이진 삽입 (안정) */            \
+    static inline void prefix##_binary_insertion_(TYPE a[], size_t n,             \
+                                                  size_t start) {                 \
+        for (size_t i = start; i < n; i++) {                                      \
+            TYPE pivot = a[i];                                                    \
+            size_t pos = prefix##_gallop_right_(&pivot, a, i, i - 1);             \
+            memmove(&a[pos + 1], &a[pos], (i - pos) * sizeof(TYPE));              \
+            a[pos] = pivot;                                                       \
+            DS_COUNT_MOVE(i - pos + 1);                                           \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_reverse_(TYPE *lo, TYPE *hi) {                    \
+        while (lo < hi) {                                                         \
+            DS_COUNT_SWAP(1);                                                     \
+            TYPE temp = *lo;                                                      \
+            *lo++ = *hi;                                                          \
+            *hi-- = temp;                                                         \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    /* 제자리 병합 (버퍼 없음): 큰 쪽을 반으로 자르고 회전, O(n log n) */         \
+    static void prefix##_inplace_merge_(TYPE *a, size_t na, size_t nb) {          \
+        while (na > 0 && nb > 0) {                                                \
+            if (na + nb == 2) {                                                   \
+                if (DS_CMP(LESS(a[1], a[0]))) {                                   \
+                    prefix##_reverse_(a, a + 1);                                  \
+                }                                                                 \
+                return;                                                           \
+            }                                                                     \
+            size_t cut_a, cut_b;                                                  \
+            if (na >= nb) {                                                       \
+                cut_a = na / 2;                                                   \
+                cut_b = prefix##_gallop_left_(&a[cut_a], a + na, nb, 0);          \
+            } else {                                                              \
+                cut_b = nb / 2;                                                   \
+                cut_a = prefix##_gallop_right_(&a[na + cut_b], a, na, 0);         \
+            }                                                                     \
+            /* a[cut_a..na) 와 b[0..cut_b) 자리 바꿈 (세 번 뒤집기) */            \
+            if (cut_a < na && cut_b > 0) {                                        \
+                prefix##_reverse_(a + cut_a, a + na - 1);                         \
+                prefix##_reverse_(a + na, a + na + cut_b - 1);                    \
+                prefix##_reverse_(a + cut_a, a + na + cut_b - 1);                 \
+            }                                                                     \
+            size_t mid = cut_a + cut_b;                                           \
+            if (cut_a + cut_b < (na - cut_a) + (nb - cut_b)) {                    \
+                prefix##_inplace_merge_(a, cut_a, cut_b);                         \
+                a += mid;                                                         \
+                na -= cut_a;                                                      \
+                nb -= cut_b;                                                      \
+            } else {                                                              \
+                prefix##_inplace_merge_(a + mid, na - cut_a, nb - cut_b);         \
+                na = cut_a;                                                       \
+                nb = cut_b;                                                       \
+            }                                                                     \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline bool prefix##_reserve_temp_(prefix##_TimState_ *ts, size_t n) { \
+        if (n <= ts->temp_capacity) {                                             \
+            return true;                                                          \
+        }                                                                         \
+        if (ts->temp_failed) {                                                    \
+            return false;                                                         \
+        }                                                                         \
+        TYPE *temp = malloc(n * sizeof(TYPE));   /* 딱 필요한 만큼만 */           \
+        if (temp == NULL) {                                                       \
+            ts->temp_failed = true;                                               \
+            return false;                                                         \
+        }                                                                         \
+        free(ts->temp);                                                           \
+        ts->temp = temp;                                                          \
+        ts->temp_capacity = n;                                                    \
+        ts->stats->temp_peak = n;                                                 \
+        return true;                                                              \
+    }                                                                             \
+                                                                                  \
+    /* 앞에서부터 병합, 짧은 쪽(a)만 임시 버퍼로 (na <= nb, pb[0] < pa[0]) */     \
+    static void prefix##_merge_lo_(prefix##_TimState_ *ts, TYPE *pa, size_t na,   \
+                                   TYPE *pb, size_t nb) {                         \
+        TYPE *dest = pa;                                                          \
+        memcpy(ts->temp, pa, na * sizeof(TYPE));                                  \
+        pa = ts->temp;                                                            \
+        size_t min_gallop = ts->min_gallop;                                       \
+                                                                                  \
+        *dest++ = *pb++;                                                          \
+        if (--nb == 0) {                                                          \
+            goto succeed;                                                         \
+        }                                                                         \
+        if (na == 1) {                                                            \
+            goto copy_b;                                                          \
+        }                                                                         \
+        for (;;) {                                                                \
+            size_t a_wins = 0, b_wins = 0;                                        \
+            /* 한 원소씩 병합: 한쪽이 min_gallop번 연속 이기면 갤러핑 */          \
+            for (;;) {                                                            \
+                if (DS_CMP(LESS(*pb, *pa))) {                                     \
+                    *dest++ = *pb++;                                              \
+                    b_wins++;                                                     \
+                    a_wins = 0;                                                   \
+                    if (--nb == 0) {                                              \
+                        goto succeed;                                             \
+                    }                                                             \
+                    if (b_wins >= min_gallop) {                                   \
+                        break;                                                    \
+                    }                                                             \
+                } else {                                                          \
+                    *dest++ = *pa++;                                              \
+                    a_wins++;                                                     \
+                    b_wins = 0;                                                   \
+                    if (--na == 1) {                                              \
+                        goto copy_b;                                              \
+                    }                                                             \
+                    if (a_wins >= min_gallop) {                                   \
+                        break;                                                    \
+                    }                                                             \
+                }                                                                 \
+            }                                                                     \
+            ts->stats->gallops++;                                                 \
+            min_gallop++;                                                         \
+            do {                                                                  \
+                min_gallop -= min_gallop > 1;                                     \
+                ts->min_gallop = min_gallop;                                      \
+                size_t k = prefix##_gallop_right_(pb, pa, na, 0);                 \
+                a_wins = k;                                                       \
+                if (k > 0) {                                                      \
+                    memcpy(dest, pa, k * sizeof(TYPE));                           \
+                    dest += k;                                                    \
+                    pa += k;                                                      \
+                    na -= k;                                                      \
+                    if (na == 1) {                                                \
+                        goto copy_b;                                              \
+                    }                                                             \
+                    if (na == 0) {                                                \
+                        goto succeed;                                             \
+                    }                                                             \
+                }                                                                 \
+                *dest++ = *pb++;                                                  \
+                if (--nb == 0) {                                                  \
+                    goto succeed;                                                 \
+                }                                                                 \
+                k = prefix##_gallop_left_(pa, pb, nb, 0);                         \
+                b_wins = k;                                                       \
+                if (k > 0) {                                                      \
+                    memmove(dest, pb, k * sizeof(TYPE));                          \
+                    dest += k;                                                    \
+                    pb += k;                                                      \
+                    nb -= k;                                                      \
+                    if (nb == 0) {                                                \
+                        goto succeed;                                             \
+                    }                                                             \
+                }                                                                 \
+                *dest++ = *pa++;                                                  \
+                if (--na == 1) {                                                  \
+                    goto copy_b;                                                  \
+                }                                                                 \
+            } while (a_wins >= DS_TIM_MIN_GALLOP || b_wins >= DS_TIM_MIN_GALLOP); \
+            min_gallop++;   /* 갤러핑이 이득 없었으므로 다음 진입 기준을 높임 */  \
+            ts->min_gallop = min_gallop;                                          \
+        }                                                                         \
+    succeed:                                                                      \
+        if (na > 0) {                                                             \
+            memcpy(dest, pa, na * sizeof(TYPE));                                  \
+        }                                                                         \
+        return;                                                                   \
+    copy_b:                                                                       \
+        /* a의 마지막 원소(전체 최댓값)만 남음: b 나머지를 당기고 맨 뒤에 놓음 */ \
+        memmove(dest, pb, nb * sizeof(TYPE));                                     \
+        dest[nb] = *pa;                                                           \
+    }                                                                             \
+                                                                                  \
+    /* merge_lo의 대칭: 뒤에서부터 병합, 짧은 쪽(b)만 임시 버퍼로 (na > nb) */    \
+    static void prefix##_merge_hi_(prefix##_TimState_ *ts, TYPE *pa, size_t na,   \
+                                   TYPE *pb, size_t nb) {                         \
+        TYPE *base_a = pa;                                                        \
+        TYPE *base_b = ts->temp;                                                  \
+        memcpy(base_b, pb, nb * sizeof(TYPE));                                    \
+        TYPE *dest = pb + nb - 1;                                                 \
+        pb = base_b + nb - 1;                                                     \
+        pa += na - 1;                                                             \
+        size_t min_gallop = ts->min_gallop;                                       \
+                                                                                  \
+        *dest-- = *pa--;                                                          \
+        if (--na == 0) {                                                          \
+            goto succeed;                                                         \
+        }                                                                         \
+        if (nb == 1) {                                                            \
+            goto copy_a;                                                          \
+        }                                                                         \
+        for (;;) {                                                                \
+            size_t a_wins = 0, b_wins = 0;                                        \
+            for (;;) {                                                            \
+                if (DS_CMP(LESS(*pb, *pa))) {                                     \
+                    *dest-- = *pa--;                                              \
+                    a_wins++;                                                     \
+                    b_wins = 0;                                                   \
+                    if (--na == 0) {                                              \
+                        goto succeed;                                             \
+                    }                                                             \
+                    if (a_wins >= min_gallop) {                                   \
+                        break;                                                    \
+                    }                                                             \
+                } else {                                                          \
+                    *dest-- = *pb--;                                              \
+                    b_wins++;                                                     \
+                    a_wins = 0;                                                   \
+                    if (--nb == 1) {                                              \
+                        goto copy_a;                                              \
+                    }                                                             \
+                    if (b_wins >= min_gallop) {                                   \
+                        break;                                                    \
+                    }                                                             \
+                }                                                                 \
+            }                                                                     \
+            ts->stats->gallops++;                                                 \
+            min_gallop++;                                                         \
+            do {                                                                  \
+                min_gallop -= min_gallop > 1;                                     \
+                ts->min_gallop = min_gallop;                                      \
+                size_t k = na - prefix##_gallop_right_(pb, base_a, na, na - 1);   \
+                a_wins = k;                                                       \
+                if (k > 0) {                                                      \
+                    dest -= k;                                                    \
+                    pa -= k;                                                      \
+                    memmove(dest + 1, pa + 1, k * sizeof(TYPE));                  \
+                    na -= k;                                                      \
+                    if (na == 0) {                                                \
+                        goto succeed;                                             \
+                    }                                                             \
+                }                                                                 \
+                *dest-- = *pb--;                                                  \
+                if (--nb == 1) {                                                  \
+                    goto copy_a;                                                  \
+                }                                                                 \
+                k = nb - prefix##_gallop_left_(pa, base_b, nb, nb - 1);           \
+                b_wins = k;                                                       \
+                if (k > 0) {                                                      \
+                    dest -= k;                                                    \
+                    pb -= k;                                                      \
+                    memcpy(dest + 1, pb + 1, k * sizeof(TYPE));                   \
+                    nb -= k;                                                      \
+                    if (nb == 1) {                                                \
+                        goto copy_a;                                              \
+                    }                                                             \
+                    if (nb == 0) {                                                \
+                        goto succeed;                                             \
+                    }                                                             \
+                }                                                                 \
+                *dest-- = *pa--;                                                  \
+                if (--na == 0) {                                                  \
+                    goto succeed;                                                 \
+                }                                                                 \
+            } while (a_wins >= DS_TIM_MIN_GALLOP || b_wins >= DS_TIM_MIN_GALLOP); \
+            min_gallop++;                                                         \
+            ts->min_gallop = min_gallop;                                          \
+        }                                                                         \
+    succeed:                                                                      \
+        if (nb > 0) {                                                             \
+            memcpy(dest - (nb - 1), base_b, nb * sizeof(TYPE));                   \
+        }                                                                         \
+        return;                                                                   \
+    copy_a:                                                                       \
+        /* b의 첫 원소(전체 최솟값)만 남음: a 나머지를 밀고 맨 앞에 놓음 */       \
+        dest -= na;                                                               \
+        pa -= na;                                                                 \
+        memmove(dest + 1, pa + 1, na * sizeof(TYPE));                             \
+        *dest = *pb;                                                              \
+    }                                                                             \
+                                                                                  \
+    /* 스택의 i번째와 i+1번째 런 병합 */                                          \
+    static void prefix##_merge_at_(prefix##_TimState_ *ts, size_t i) {            \
+        TYPE *pa = ts->run_base[i];                                               \
+        size_t na = ts->run_len[i];                                               \
+        TYPE *pb = ts->run_base[i + 1];                                           \
+        size_t nb = ts->run_len[i + 1];                                           \
+        ts->run_len[i] = na + nb;                                                 \
+        if (i + 3 == ts->stack_size) {                                            \
+            ts->run_base[i + 1] = ts->run_base[i + 2];                            \
+            ts->run_len[i + 1] = ts->run_len[i + 2];                              \
+        }                                                                         \
+        ts->stack_size--;                                                         \
+        ts->stats->merges++;                                                      \
+                                                                                  \
+        /* a 앞쪽 b[0] 이하, b 뒤쪽 a[끝] 이상은 이미 제자리 → 잘라냄 */          \
+        size_t k = prefix##_gallop_right_(pb, pa, na, 0);                         \
+        pa += k;                                                                  \
+        na -= k;                                                                  \
+        if (na == 0) {                                                            \
+            return;                                                               \
+        }                                                                         \
+        nb = prefix##_gallop_left_(&pa[na - 1], pb, nb, nb - 1);                  \
+        if (nb == 0) {                                                            \
+            return;                                                               \
+        }                                                                         \
+        if (!prefix##_reserve_temp_(ts, na < nb ? na : nb)) {                     \
+            prefix##_inplace_merge_(pa, na, nb);                                  \
+            return;                                                               \
+        }                                                                         \
+        DS_COUNT_MOVE((na < nb ? na : nb) + na + nb);   /* 임시 복사 + 출력 */    \
+        if (na <= nb) {                                                           \
+            prefix##_merge_lo_(ts, pa, na, pb, nb);                               \
+        } else {                                                                  \
+            prefix##_merge_hi_(ts, pa, na, pb, nb);                               \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    /* 런 스택 불변식이 깨진 동안 병합 (Auger 등 2015의 수정판 조건) */           \
+    static void prefix##_merge_collapse_(prefix##_TimState_ *ts) {                \
+        size_t *len = ts->run_len;                                                \
+        while (ts->stack_size > 1) {                                              \
+            size_t i = ts->stack_size - 2;                                        \
+            if ((i > 0 && len[i - 1] <= len[i] + len[i + 1])                      \
+                || (i > 1 && len[i - 2] <= len[i - 1] + len[i])) {                \
+                if (len[i - 1] < len[i + 1]) {                                    \
+                    i--;                                                          \
+                }                                                                 \
+            } else if (len[i] > len[i + 1]) {                                     \
+                break;                                                            \
+            }                                                                     \
+            prefix##_merge_at_(ts, i);                                            \
+        }                                                                         \
+    }                                                                             \
+                                                                                  \
+    static inline void prefix##_tim_sort(TYPE arr[], size_t n,                    \
+                                         DsTimSortStats *stats) {                 \
+        DsTimSortStats local;                                                     \
+        if (stats == NULL) {                                                      \
+            stats = &local;                                                       \
+        }                                                                         \
+        memset(stats, 0, sizeof(*stats));                                         \
+        if (n < 2) {                                                              \
+            stats->runs = n;                                                      \
+            stats->longest_run = n;                                               \
+            return;                                                               \
+        }                                                                         \
+        /* minrun: n / minrun이 2의 거듭제곱에 가깝도록 32~64 사이에서 선택 */    \
+        size_t min_run = n, odd = 0;                                              \
+        while (min_run >= 64) {                                                   \
+            odd |= min_run & 1;                                                   \
+            min_run >>= 1;                                                        \
+        }                                                                         \
+        min_run += odd;                                                           \
+        stats->min_run = min_run;                                                 \
+                                                                                  \
+        prefix##_TimState_ ts;                                                    \
+        ts.temp = NULL;                                                           \
+        ts.temp_capacity = 0;                                                     \
+        ts.temp_failed = false;                                                   \
+        ts.min_gallop = DS_TIM_MIN_GALLOP;                                        \
+        ts.stack_size = 0;                                                        \
+        ts.stats = stats;                                                         \
+                                                                                  \
+        TYPE *lo = arr;                                                           \
+        size_t remaining = n;                                                     \
+        while (remaining > 0) {                                                   \
+            size_t run = 1;                                                       \
+            if (remaining > 1) {                                                  \
+                run = 2;                                                          \
+                if (DS_CMP(LESS(lo[1], lo[0]))) {                                 \
+                    while (run < remaining                                        \
+                           && DS_CMP(LESS(lo[run], lo[run - 1]))) {               \
+                        run++;                                                    \
+                    }                                                             \
+                    prefix##_reverse_(lo, lo + run - 1);                          \
+                    stats->descending_runs++;                                     \
+                } else {                                                          \
+                    while (run < remaining                                        \
+                           && !DS_CMP(LESS(lo[run], lo[run - 1]))) {              \
+                        run++;                                                    \
+                    }                                                             \
+                }                                                                 \
+            }                                                                     \
+            stats->runs++;                                                        \
+            if (run > stats->longest_run) {                                       \
+                stats->longest_run = run;                                         \
+            }                                                                     \
+            if (run < min_run) {                                                  \
+                size_t forced = remaining < min_run ? remaining : min_run;        \
+                prefix##_binary_insertion_(lo, forced, run);                      \
+                run = forced;                                                     \
+            }                                                                     \
+            ts.run_base[ts.stack_size] = lo;                                      \
+            ts.run_len[ts.stack_size] = run;                                      \
+            ts.stack_size++;                                                      \
+            prefix##_merge_collapse_(&ts);                                        \
+            lo += run;                                                            \
+            remaining -= run;                                                     \
+        }                                                                         \
+        while (ts.stack_size > 1) {                                               \
+            size_t i = ts.stack_size - 2;                                         \
+            if (i > 0 && ts.run_len[i - 1] < ts.run_len[i + 1]) {                 \
+                i--;                                                              \
+            }                                                                     \
+            prefix##_merge_at_(&ts, i);                                           \
+        }                                                                         \
+        free(ts.temp);                                                            \
+    }
+
+#endif // DS_TIMSORT_H
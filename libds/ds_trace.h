@@ -0,0 +1,39 @@
+/**
+ * ds_trace.h: 교육용 단계별 출력(trace) 스위치
+ *
+ * 각 장의 알고리즘은 학습을 위해 매 단계를 출력한다. 대용량 입력에서는
+ * 이 출력이 실행 시간의 대부분을 차지하므로 컴파일 시점에 끌 수 있게 한다.
+ *
+ *   DS_TRACE_ENABLED = 1 (기본): 기존과 동일하게 단계별 출력
+ *   DS_TRACE_ENABLED = 0       : 출력 코드가 상수 조건으로 제거됨 (비용 0)
+ *
+ * CMake: -DDS_TRACE=OFF 로 구성하면 모든 장에 DS_TRACE_ENABLED=0이 적용된다.
+ *
+ * 사용법:
+ *   DS_TRACE("피벗=%d\n", pivot);          // 단일 printf
+ *   if (DS_TRACE_ENABLED) {                 // 여러 줄 / 출력 도우미 호출
+ *       print_array_range(arr, low, high);
+ *       printf("\n");
+ *   }
+ *
+ * 조건이 컴파일 상수이므로 끈 상태에서도 인자와 도우미 함수는 타입 검사를 받고
+ * (미사용 경고 없음), 최적화 단계에서 분기째 제거된다.
+ */
+
+#ifndef DS_TRACE_H
+#define DS_TRACE_H
+
+#include <stdio.h>
+
+#ifndef DS_TRACE_ENABLED
+#define DS_TRACE_ENABLED 1
+#endif
+
+#define DS_TRACE(...)                  \
+    do {                               \
+        if (DS_TRACE_ENABLED) {        \
+            printf(__VA_ARGS__);       \
+        }                              \
+    } while (0)
+
+#endif // DS_TRACE_H